@@ -30,6 +30,7 @@ namespace HEXCTRL {
 
 	using SpanByte = std::span<std::byte>;
 	using SpanCByte = std::span<const std::byte>;
+	using SpanSpanCByte = std::span<const SpanCByte>;
 
 	/********************************************************************************************
 	* EHexCmd: Enum of the commands that can be executed within HexCtrl via the ExecuteCmd.     *
@@ -363,13 +364,17 @@ namespace HEXCTRL {
 	* HEXDATA: Main struct for the HexCtrl SetData method.                                      *
 	********************************************************************************************/
 	struct HEXDATA {
-		SpanByte        spnData;                    //Data span to display.
-		IHexVirtData*   pHexVirtData { };           //Pointer for VirtualData mode.
-		IHexVirtColors* pHexVirtColors { };         //Pointer for Custom Colors class.
-		ULONGLONG       ullMaxVirtOffset { };       //Maximum virtual offset.
-		DWORD           dwCacheSize { 0x800000UL }; //Data cache size for VirtualData mode.
-		bool            fMutable { false };         //Is data mutable or read-only.
-		bool            fHighLatency { false };     //Do not redraw until scroll thumb is released.
+		SpanByte        spnData;                         //Data span to display.
+		IHexVirtData*   pHexVirtData { };                //Pointer for VirtualData mode.
+		IHexVirtColors* pHexVirtColors { };              //Pointer for Custom Colors class.
+		ULONGLONG       ullMaxVirtOffset { };            //Maximum virtual offset.
+		DWORD           dwCacheSize { 0x800000UL };      //Data cache size for VirtualData mode.
+		ULONGLONG       ullUndoBudget { 0x10000000ULL }; //Undo/Redo memory budget, in bytes.
+		bool            fMutable { false };              //Is data mutable or read-only.
+		bool            fHighLatency { false };          //Do not redraw until scroll thumb is released.
+		bool            fSearchIndex { false };          //Build search index in background, for repeated searches.
+		bool            fSuffixArray { false };          //Build suffix array in background, for instant Find All in read-only data.
+		bool            fPieceTable { false };           //Keep edits in the piece table over the original data, until CommitData.
 	};
 
 	/********************************************************************************************
@@ -397,7 +402,8 @@ namespace HEXCTRL {
 	* EHexModifyMode: Enum of the data modification mode, used in the HEXMODIFY.                *
 	********************************************************************************************/
 	enum class EHexModifyMode : std::uint8_t {
-		MODIFY_ONCE, MODIFY_REPEAT, MODIFY_OPERATION, MODIFY_RAND_MT19937, MODIFY_RAND_FAST
+		MODIFY_ONCE, MODIFY_REPEAT, MODIFY_OPERATION, MODIFY_RAND_MT19937, MODIFY_RAND_FAST,
+		MODIFY_INSERT, MODIFY_REMOVE
 	};
 
 	/********************************************************************************************
@@ -420,7 +426,7 @@ namespace HEXCTRL {
 	/********************************************************************************************
 	* HEXMODIFY: Main struct to represent data modification parameters.                         *
 	* When eModifyMode is set to MODIFY_ONCE, bytes from spnData.data() just replace            *
-	* corresponding data bytes as is.                                                           *
+	* corresponding data bytes as is, at every vecSpan (e.g. all occurrences in Replace All).   *
 	* If eModifyMode is equal to MODIFY_REPEAT then block by block replacement takes place      *
 	* few times.                                                                                *
 	* For example: if SUM(vecSpan.ullSize) == 9, spnData.size() == 3 and eModifyMode is set     *
@@ -429,6 +435,10 @@ namespace HEXCTRL {
 	* at vecSpan.ullOffset will be `030405030405030405.                                         *
 	* If eModifyMode is equal to MODIFY_OPERATION, then eOperMode comes into play, showing      *
 	* what kind of operation must be performed on the data.                                     *
+	* MODIFY_INSERT inserts vecSpan.ullSize bytes before every vecSpan.ullOffset, the bytes are *
+	* spnData repeated, and MODIFY_REMOVE removes vecSpan bytes. Both change the data size and  *
+	* work only with the HEXDATA::fPieceTable flag. Offsets of vecSpan are the ones before the  *
+	* modification.                                                                             *
 	********************************************************************************************/
 	struct HEXMODIFY {
 		EHexModifyMode eModifyMode { };      //Modify mode.
@@ -439,6 +449,76 @@ namespace HEXCTRL {
 		bool           fBigEndian { false }; //Treat data as the big endian, used if eModifyMode == MODIFY_OPERATION.
 	};
 
+	/********************************************************************************************
+	* EHexSearchMode: Search mode, used in the HEXSEARCH.                                       *
+	********************************************************************************************/
+	enum class EHexSearchMode : std::uint8_t {
+		SEARCH_FORWARD, SEARCH_BACKWARD, SEARCH_ALL
+	};
+
+	/********************************************************************************************
+	* EHexSearchType: Type of the data to search for, used in the HEXSEARCH.                    *
+	********************************************************************************************/
+	enum class EHexSearchType : std::uint8_t {
+		HEXBYTES, TEXT_ASCII, TEXT_UTF8, TEXT_UTF16, NUM_INT8, NUM_UINT8, NUM_INT16, NUM_UINT16,
+		NUM_INT32, NUM_UINT32, NUM_INT64, NUM_UINT64, NUM_FLOAT, NUM_DOUBLE, STRUCT_FILETIME
+	};
+
+	/********************************************************************************************
+	* IHexSearchResult: Pure abstract class to receive results of the IHexCtrl::Search method.  *
+	* Found offsets are delivered in batches, in ascending order for the SEARCH_ALL mode.       *
+	* In the multi-pattern search spnPatterns holds the index of the pattern, in the            *
+	* HEXSEARCH::spnFindMulti, found at the same index offset. In the regex search it holds the *
+	* size of the match found at the same index offset, as in the approximate search.           *
+	* Otherwise it's empty. It's called from the thread the IHexCtrl::Search is called from,    *
+	* and from the SearchTargets' worker threads for the default data mode targets.             *
+	********************************************************************************************/
+	class IHexSearchResult {
+	public:
+		virtual bool OnHexSearchResult(std::span<const ULONGLONG> spnOffsets,
+			std::span<const DWORD> spnPatterns) = 0; //Return false to stop the search.
+	};
+
+	/********************************************************************************************
+	* HEXSEARCH: Main struct for the IHexCtrl::Search method.                                   *
+	* spnFind is the data to search for, in its final binary form (encoding, endianness).       *
+	* If spnFindTo is not empty, it's a search in numbers range, from spnFind to spnFindTo,     *
+	* both must be of the eSearchType's size. It's only for NUM_* search types.                 *
+	* If spnFindMulti is not empty, all its patterns are searched at once, in one data pass,    *
+	* and spnFind is ignored. Only for the SEARCH_ALL mode, without wildcard and inversion.     *
+	* If fRegex is true, spnFind is a regular expression over the raw bytes. The longest        *
+	* match, up to 256 bytes, is taken at the first offset it starts at, and the search goes on *
+	* from past its end, so the matches don't overlap. Only for the SEARCH_FORWARD and          *
+	* SEARCH_ALL modes, without wildcard and inversion.                                         *
+	* If dwMaxErrors > 0, it's an approximate search of the spnFind, with no more than          *
+	* dwMaxErrors mismatched bytes, or edits (substituted, inserted, or deleted bytes) if       *
+	* fEditDist is true. An edit distance match is found once, its end and then its start       *
+	* are the ones of the least edits, and the search goes on from past its end, so the matches *
+	* don't overlap. Only for the SEARCH_FORWARD and SEARCH_ALL modes, without wildcard and     *
+	* inversion.                                                                                *
+	********************************************************************************************/
+	struct HEXSEARCH {
+		SpanCByte         spnFind;              //Data to search for.
+		SpanCByte         spnFindTo;            //Numbers range end (e.g. -1:15), empty for a single value search.
+		SpanSpanCByte     spnFindMulti;         //Patterns for the multi-pattern search, empty for a single pattern search.
+		IHexSearchResult* pHexSearchRes { };    //Results receiver, can be nullptr if only count is needed.
+		HEXSPAN           stRange { };          //Range to search within, ullSize == 0 means the whole data.
+		ULONGLONG         ullStartFrom { };     //Offset to start search from, must be within the stRange.
+		ULONGLONG         ullStep { 1 };        //Search step.
+		DWORD             dwLimit { 10000 };    //Maximum found occurrences in the SEARCH_ALL mode, 0 means no limit.
+		DWORD             dwThreads { };        //Worker threads for the SEARCH_ALL mode, 0 means all available cores.
+		DWORD             dwMaxErrors { };      //Maximum errors in the approximate search, 0 means the exact search.
+		EHexSearchMode    eSearchMode { };      //Search mode.
+		EHexSearchType    eSearchType { };      //Type of the data to search for.
+		std::byte         bWildcard { '?' };    //Wildcard byte, used if fWildcard == true.
+		bool              fWildcard { false };  //Wildcard search, for HEXBYTES, TEXT_ASCII, and TEXT_UTF16.
+		bool              fMatchCase { true };  //Case sensitive search, for TEXT_ASCII and TEXT_UTF16 (TEXT_ASCII only in multi-pattern).
+		bool              fInverted { false };  //Search for the data that doesn't match the spnFind.
+		bool              fBigEndian { false }; //Numbers range data is big-endian, used if spnFindTo is not empty.
+		bool              fRegex { false };     //spnFind is a regular expression, eSearchType and fMatchCase are ignored.
+		bool              fEditDist { false };  //Approximate search errors are edits, not only mismatched bytes.
+	};
+
 	/********************************************************************************************
 	* HEXINFOBAR - Data to show in the Info Bar.                                                *
 	********************************************************************************************/
@@ -462,6 +542,7 @@ namespace HEXCTRL {
 		IHexCtrl& operator=(IHexCtrl&&) = delete;
 		virtual ~IHexCtrl() = default;
 		virtual void ClearData() = 0; //Clears all data from HexCtrl's view (not touching data itself).
+		virtual void CommitData() = 0; //Writes edits from the piece table to the original data.
 		virtual bool Create(const HEXCREATE& hcs) = 0;                         //Main initialization method.
 		virtual bool CreateDialogCtrl(UINT uCtrlID, HWND hWndParent) = 0;      //Сreates custom dialog control.
 		virtual void Delete() = 0;                                             //IHexCtrl object deleter.
@@ -502,10 +583,11 @@ namespace HEXCTRL {
 		[[nodiscard]] virtual bool IsMutable()const = 0;       //Is data mutable or not.
 		[[nodiscard]] virtual bool IsOffsetAsHex()const = 0;   //Are offsets shown as Hex or as Decimal.
 		[[nodiscard]] virtual auto IsOffsetVisible(ULONGLONG ullOffset)const -> HEXVISION = 0; //Ensures that the given offset is visible.
-		[[nodiscard]] virtual bool IsVirtual()const = 0;       //Is working in VirtualData or default mode.		
+		[[nodiscard]] virtual bool IsVirtual()const = 0;       //Is working in VirtualData (or piece table) or default mode.
 		virtual void ModifyData(const HEXMODIFY& hms) = 0;     //Main routine to modify data in IsMutable()==true mode.
 		[[nodiscard]] virtual bool PreTranslateMsg(MSG* pMsg) = 0;
 		virtual void Redraw() = 0;                             //Redraw HexCtrl's window.
+		virtual auto Search(const HEXSEARCH& hss) -> ULONGLONG = 0; //Search without the dialog, from the HexCtrl's thread only (it builds the search index), returns found occurrences count.
 		virtual void SetCapacity(DWORD dwCapacity) = 0;        //Set current capacity.
 		virtual void SetCaretPos(ULONGLONG ullOffset, bool fHighLow = true, bool fRedraw = true) = 0; //Set the caret position.
 		virtual void SetCharsExtraSpace(DWORD dwSpace) = 0;    //Extra space to add between chars, in pixels.
@@ -534,6 +616,23 @@ namespace HEXCTRL {
 	using IHexCtrlPtr = std::unique_ptr<IHexCtrl, IHexCtrlDeleter>;
 	[[nodiscard]] HEXCTRLAPI IHexCtrlPtr CreateHexCtrl();
 
+	/********************************************************************************************
+	* HEXSEARCHTARGET: One of the data sets for the SearchTargets function.                     *
+	* Every data set's results go to its own pHexSearchRes, that tells the data sets apart.     *
+	********************************************************************************************/
+	struct HEXSEARCHTARGET {
+		IHexCtrl*         pHexCtrl { };      //HexCtrl with the data set to search in.
+		IHexSearchResult* pHexSearchRes { }; //Results receiver for this data set, can be nullptr if only count is needed.
+		ULONGLONG         ullFound { };      //Found occurrences in this data set, set by the SearchTargets.
+	};
+
+	//Search in all the data sets with the same hss, in parallel. Returns found occurrences count in all data sets.
+	//Must be called from the thread the HexCtrls were created in, which is blocked until the search is done. The search
+	//indexes are started in the calling thread, the worker threads only use them as far as they're built, and never call
+	//the IHexCtrl::Search. Virtual data sets are searched one by one in the calling thread, and their receivers are called
+	//from it. The default ones are searched in the worker threads, and their receivers are called from these threads.
+	HEXCTRLAPI auto __cdecl SearchTargets(std::span<HEXSEARCHTARGET> spnTargets, const HEXSEARCH& hss) -> ULONGLONG;
+
 	/**************************************************************************
 	* WM_NOTIFY message codes (NMHDR.code values).                            *
 	* These codes are used to notify parent window about HexCtrl's states.    *
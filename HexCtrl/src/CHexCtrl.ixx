@@ -13,6 +13,7 @@ module;
 #include <commctrl.h>
 #include <intrin.h>
 #include <algorithm>
+#include <atomic>
 #include <bit>
 #include <cassert>
 #include <chrono>
@@ -29,8 +30,10 @@ module;
 #include <vector>
 export module HEXCTRL;
 
+import :CHexPieceTable;
 import :CHexScroll;
 import :CHexSelection;
+import :CHexUndo;
 import :CHexDlgBkmMgr;
 import :CHexDlgCodepage;
 import :CHexDlgDataInterp;
@@ -137,6 +140,7 @@ namespace HEXCTRL::INTERNAL {
 		CHexCtrl& operator=(CHexCtrl&&) = delete;
 		~CHexCtrl()override;
 		void ClearData()override;
+		void CommitData()override;
 		bool Create(const HEXCREATE& hcs)override;
 		bool CreateDialogCtrl(UINT uCtrlID, HWND hWndParent)override;
 		void Delete()override;
@@ -179,9 +183,12 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] auto IsOffsetVisible(ULONGLONG ullOffset)const -> HEXVISION override;
 		[[nodiscard]] bool IsVirtual()const override;
 		void ModifyData(const HEXMODIFY& hms)override;
+		void PrepareSearch(const HEXSEARCH& hss); //SearchTargets' index building, in the HexCtrl's thread.
 		[[nodiscard]] bool PreTranslateMsg(MSG* pMsg)override;
 		[[nodiscard]] auto ProcessMsg(const MSG& msg) -> LRESULT;
 		void Redraw()override;
+		auto Search(const HEXSEARCH& hss) -> ULONGLONG override;
+		[[nodiscard]] auto SearchWorker(const HEXSEARCH& hss)const -> ULONGLONG; //SearchTargets' search, in any thread.
 		void SetCapacity(DWORD dwCapacity)override;
 		void SetCaretPos(ULONGLONG ullOffset, bool fHighLow = true, bool fRedraw = true)override;
 		void SetCharsExtraSpace(DWORD dwSpace)override;
@@ -205,7 +212,7 @@ namespace HEXCTRL::INTERNAL {
 		void SetWindowPos(HWND hWndAfter, int iX, int iY, int iWidth, int iHeight, UINT uFlags)override;
 		void ShowInfoBar(bool fShow, HEXINFOBAR hib = { })override;
 	private:
-		struct KEYBIND; struct UNDO; struct MENUITEM; enum class EClipboard : std::uint8_t;
+		struct KEYBIND; struct MENUITEM; enum class EClipboard : std::uint8_t;
 		[[nodiscard]] auto BuildDataToDraw(ULONGLONG ullStartLine, int iLines)const -> std::tuple<std::wstring, std::wstring>;
 		void CaretMoveDown();  //Set caret one line down.
 		void CaretMoveLeft();  //Set caret one chunk left.
@@ -256,6 +263,7 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] auto GetCharWidthNative()const -> int;  //Width of the one char, in px.
 		[[nodiscard]] auto GetCommandFromKey(UINT uKey, bool fCtrl, bool fShift, bool fAlt)const -> std::optional<EHexCmd>; //Get command from keybinding.
 		[[nodiscard]] auto GetCommandFromMenu(WORD wMenuID)const -> std::optional<EHexCmd>; //Get command from menuID.
+		[[nodiscard]] auto GetDataOrig(HEXSPAN hss)const -> SpanByte; //Original data, beneath the piece table, if any.
 		[[nodiscard]] auto GetDataSizeImpl()const -> std::uint64_t;
 		[[nodiscard]] auto GetDigitsOffset()const -> DWORD;
 		[[nodiscard]] auto GetDPIScale()const -> float;
@@ -278,8 +286,11 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] bool IsMutableImpl()const;
 		[[nodiscard]] bool IsOffsetAsHexImpl()const;
 		[[nodiscard]] bool IsPageVisible()const;
+		[[nodiscard]] bool IsPieceTableImpl()const; //Edits are kept in the piece table.
 		[[nodiscard]] bool IsScrollCursor()const;
 		[[nodiscard]] bool IsVirtualImpl()const;
+		void ModifyDataImpl(const HEXMODIFY& hms); //Modification itself, without the Undo snapshot.
+		void ModifySize(const HEXMODIFY& hms); //MODIFY_INSERT and MODIFY_REMOVE modes, in the piece table.
 		void ModifyWorker(const HEXCTRL::HEXMODIFY& hms, const auto& FuncWorker, HEXCTRL::SpanCByte spnOper)const; //Main "Modify" method with different workers.
 		[[nodiscard]] auto OffsetToWstr(ULONGLONG ullOffset)const -> std::wstring; //Format offset as std::wstring.
 		void OnCaretPosChange(ULONGLONG ullOffset); //On changing caret position.
@@ -303,16 +314,21 @@ namespace HEXCTRL::INTERNAL {
 		void SetCodepageImpl(int iCodepage, bool fRedraw = true, bool fNotify = true);
 		bool SetConfigImpl(std::wstring_view wsvPath);
 		void SetDateInfoImpl(std::uint32_t dwFormat, wchar_t wchSepar);
-		void SetDataVirtual(SpanByte spnData, const HEXSPAN& hss)const; //Sets data (notifies back) in VirtualData mode.
+		void SetDataVirtual(SpanByte spnData, const HEXSPAN& hss)const; //Sets data (notifies back) in VirtualData mode, or to the piece table.
 		void SetFontImpl(const LOGFONTW& lf, bool fMain, bool fRedraw = true, bool fNotify = true);
 		void SetFontSizeInPoints(float flSizePoints, bool fMain); //Set font size in points.
 		void SetGroupSizeImpl(DWORD dwSize, bool fRedraw = true, bool fNotify = true);
 		void SetScrollCursor(bool fSet);
 		void SetUnprintableCharImpl(wchar_t wch, bool fRedraw = true);
-		void SnapshotUndo(SpanHexSpan spnHexSpan); //Takes currently modifiable data snapshot.
+		void ShiftOffsets(const ut::COffsetShift& stShift); //Data size has changed, offsets are moved along with the data.
+		[[nodiscard]] bool SnapshotUndo(const HEXMODIFY& hms); //Takes currently modifiable data snapshot, false if canceled.
+		[[nodiscard]] bool SnapshotUndoFile(SpanHexSpan spnHexSpan); //Snapshot that goes to the Undo temporary file.
 		void TextChunkPoint(ULONGLONG ullOffset, int& iCx, int& iCy)const; //Point of the text chunk.
 		void TTTrackShow(bool fShow, bool fTimer, const wchar_t* pwszText = nullptr);
 		void Undo();
+		[[nodiscard]] bool UndoApply(CHexUndo::STEP& stStep); //Puts the step's data back, the step becomes its reverse.
+		[[nodiscard]] bool UndoApplyFile(const CHexUndo::STEP& stStep); //The same, for the step in the Undo temporary file.
+		[[nodiscard]] auto UndoRecord(const HEXSPAN& hss, ULONGLONG ullBytesMax)const -> std::optional<CHexUndo::RECORD>;
 		void UpdateDPIScale(); //Set new DPI scale factor according to current DPI.
 		auto WMChar(const MSG& msg) -> LRESULT;
 		auto WMCommand(const MSG& msg) -> LRESULT;
@@ -361,7 +377,9 @@ namespace HEXCTRL::INTERNAL {
 		CHexDlgModify m_DlgModify;            //"Modify..." dialog.
 		CHexDlgSearch m_DlgSearch;            //"Search..." dialog.
 		CHexDlgTemplMgr m_DlgTemplMgr;        //"Template manager..." dialog.
+		mutable CHexPieceTable m_PieceTable;  //Piece table edit layer, it's set from the const SetDataVirtual.
 		CHexSelection m_Selection;            //Selection class.
+		CHexUndo m_Undo;                      //Undo/Redo journal.
 		CHexScroll m_ScrollV;                 //Vertical scroll bar.
 		CHexScroll m_ScrollH;                 //Horizontal scroll bar.
 		HEXCOLORS m_stColors;                 //All HexCtrl colors.
@@ -372,8 +390,6 @@ namespace HEXCTRL::INTERNAL {
 		GDIUT::CMenu m_MenuMain;              //Main popup menu.
 		GDIUT::CPoint m_ptScrollCursorClick;  //Scroll cursor click coordinates.
 		std::wstring m_wstrPageName;          //Name of the sector/page.
-		std::vector<std::vector<UNDO>> m_vecUndo; //Undo data.
-		std::vector<std::vector<UNDO>> m_vecRedo; //Redo data.
 		std::vector<KEYBIND> m_vecKeyBind;    //Vector of key bindings.
 		std::vector<int> m_vecCharsWidth;     //Vector of chars widths.
 		std::unordered_map<EHexMenuItem, MENUITEM> m_umapMenuItems; //m_MenuMain items.
@@ -443,6 +459,78 @@ export HEXCTRLAPI HEXCTRL::IHexCtrlPtr HEXCTRL::CreateHexCtrl() {
 	return IHexCtrlPtr { new HEXCTRL::INTERNAL::CHexCtrl() };
 }
 
+export HEXCTRLAPI auto __cdecl HEXCTRL::SearchTargets(std::span<HEXSEARCHTARGET> spnTargets, const HEXSEARCH& hss)
+->ULONGLONG
+{
+	//Data sets and their Search dialogs' state belong to the thread the HexCtrls were created in, which is blocked here
+	//until the search is done. The indexes are started here, and the searches themselves go through the SearchWorker,
+	//that never builds or replaces them, so the worker threads only read the dialogs' state. IHexVirtData is not required
+	//to be thread-safe, so the Virtual data sets are searched one by one in this thread, while the default ones are
+	//searched in parallel by the worker threads.
+	std::vector<HEXSEARCHTARGET*> vecTargets;     //Default data mode targets, for the worker threads.
+	std::vector<HEXSEARCHTARGET*> vecTargetsVirt; //Virtual data mode targets, for the calling thread.
+	for (auto& refTarget : spnTargets) {
+		refTarget.ullFound = 0;
+		const auto pHexCtrl = refTarget.pHexCtrl;
+		if (pHexCtrl == nullptr || !pHexCtrl->IsDataSet()) {
+			ut::DBG_REPORT_NO_DATA_SET();
+			continue;
+		}
+
+		if (::GetWindowThreadProcessId(pHexCtrl->GetWndHandle(EHexWnd::WND_MAIN), nullptr) != ::GetCurrentThreadId()) {
+			ut::DBG_REPORT(L"SearchTargets must be called from the thread the HexCtrl was created in.");
+			continue;
+		}
+
+		const auto lmbSameCtrl = [pHexCtrl](const HEXSEARCHTARGET* pTarget) { return pTarget->pHexCtrl == pHexCtrl; };
+		if (std::ranges::any_of(vecTargets, lmbSameCtrl) || std::ranges::any_of(vecTargetsVirt, lmbSameCtrl)) {
+			ut::DBG_REPORT(L"Every HexCtrl can be only one of the targets.");
+			continue;
+		}
+
+		(pHexCtrl->IsVirtual() ? vecTargetsVirt : vecTargets).emplace_back(&refTarget);
+		static_cast<CHexCtrl*>(pHexCtrl)->PrepareSearch(hss); //HexCtrls are only created by the CreateHexCtrl.
+	}
+
+	const auto lmbSearch = [&hss](HEXSEARCHTARGET* pTarget, DWORD dwThreads) {
+		auto hssTarget = hss;
+		hssTarget.pHexSearchRes = pTarget->pHexSearchRes;
+		hssTarget.dwThreads = dwThreads;
+		pTarget->ullFound = static_cast<const CHexCtrl*>(pTarget->pHexCtrl)->SearchWorker(hssTarget);
+		};
+
+	//Data sets are taken by the workers from the biggest to the smallest, so that the biggest ones start first,
+	//and the small ones fill in the gaps. Cores left, when there are fewer data sets than cores, are shared
+	//between the data sets' own searches, so the whole search takes about the time of the biggest data set.
+	std::ranges::sort(vecTargets, std::greater { }, [](const HEXSEARCHTARGET* pTarget) {
+		return pTarget->pHexCtrl->GetDataSize(); });
+	const auto dwCores = hss.dwThreads > 0 ? hss.dwThreads : (std::max)(std::thread::hardware_concurrency(), 1U);
+	const auto dwWorkers = (std::min)(dwCores, static_cast<DWORD>(vecTargets.size()));
+	const auto dwThreadsTarget = dwWorkers > 0 ? (std::max)(dwCores / dwWorkers, 1UL) : 1UL;
+
+	std::atomic<std::size_t> atomNext { 0 };
+	const auto lmbWorker = [&]() {
+		for (auto uzTarget = atomNext.fetch_add(1); uzTarget < vecTargets.size(); uzTarget = atomNext.fetch_add(1)) {
+			lmbSearch(vecTargets[uzTarget], dwThreadsTarget);
+		}
+		};
+
+	std::vector<std::jthread> vecThreads;
+	vecThreads.reserve(dwWorkers);
+	for (auto dwThread { 0U }; dwThread < dwWorkers; ++dwThread) {
+		vecThreads.emplace_back(lmbWorker);
+	}
+
+	for (const auto pTarget : vecTargetsVirt) { //Meanwhile, in the calling thread.
+		lmbSearch(pTarget, 1);
+	}
+	vecThreads.clear(); //Joining.
+
+	return std::accumulate(vecTargets.begin(), vecTargets.end(), 0ULL, [](ULONGLONG ullSum, const HEXSEARCHTARGET* pTarget) {
+		return ullSum + pTarget->ullFound; }) + std::accumulate(vecTargetsVirt.begin(), vecTargetsVirt.end(), 0ULL,
+			[](ULONGLONG ullSum, const HEXSEARCHTARGET* pTarget) { return ullSum + pTarget->ullFound; });
+}
+
 struct CHexCtrl::KEYBIND { //Key bindings.
 	EHexCmd eCmd { };
 	WORD    wMenuID { };
@@ -452,11 +540,6 @@ struct CHexCtrl::KEYBIND { //Key bindings.
 	bool    fAlt { };
 };
 
-struct CHexCtrl::UNDO {
-	ULONGLONG              ullOffset { }; //Start byte to apply Undo to.
-	std::vector<std::byte> vecData;       //Data for Undo.
-};
-
 struct CHexCtrl::MENUITEM {
 	HMENU hMenuSub { }; //If it's not null, then it's popup menu (submenu) of the m_MenuMain.
 	UINT  uMenuID { };  //If hMenuSub is null, then it's menu ID within the m_MenuMain.
@@ -498,13 +581,14 @@ void CHexCtrl::ClearData()
 {
 	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return; }
 
+	m_DlgSearch.StopSearchJob(); //Before the data it reads is gone.
 	m_stData = { };
 	m_fDataSet = false;
 	m_ullCursorPrev = 0;
 	m_ullCaretPos = 0;
 	m_ullCursorNow = 0;
-	m_vecUndo.clear();
-	m_vecRedo.clear();
+	m_Undo.Clear();
+	m_PieceTable.Clear();
 	m_ScrollV.SetScrollPos(0);
 	m_ScrollH.SetScrollPos(0);
 	m_ScrollV.SetScrollSizes(0, 0, 0);
@@ -515,6 +599,36 @@ void CHexCtrl::ClearData()
 	RedrawImpl();
 }
 
+void CHexCtrl::CommitData()
+{
+	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return; }
+	if (!IsDataSetImpl()) { ut::DBG_REPORT_NO_DATA_SET(); return; }
+	if (!IsPieceTableImpl()) { ut::DBG_REPORT(L"Data must be set with the HEXDATA::fPieceTable flag."); return; }
+	if (m_PieceTable.IsLayoutChanged()) { //The original data can't be written in place, it's to be saved anew with the GetData.
+		ut::DBG_REPORT(L"Data size was changed, data can't be committed in place.");
+		return;
+	}
+
+	//Edited spans are written to the original data chunk by chunk of the cache size.
+	//The piece table then starts anew, with the original data as a whole.
+	const auto dwSizeChunk = GetCacheSize();
+	for (const auto& hs : m_PieceTable.GetEdits()) {
+		for (auto ullOffset = hs.ullOffset; ullOffset < hs.ullOffset + hs.ullSize; ullOffset += dwSizeChunk) {
+			const auto ullSize = (std::min)(static_cast<ULONGLONG>(dwSizeChunk), hs.ullOffset + hs.ullSize - ullOffset);
+			const auto spnEdited = GetData({ ullOffset, ullSize });
+			if (const auto spnData = GetDataOrig({ ullOffset, ullSize }); !spnEdited.empty() && !spnData.empty()) {
+				std::copy_n(spnEdited.data(), ullSize, spnData.data());
+				if (m_stData.pHexVirtData != nullptr) {
+					m_stData.pHexVirtData->OnHexSetData({ .hdr { m_Wnd, static_cast<UINT>(m_Wnd.GetDlgCtrlID()) },
+						.stHexSpan { ullOffset, ullSize }, .spnData { spnData } });
+				}
+			}
+		}
+	}
+
+	m_PieceTable.Reset(m_stData.spnData.size());
+}
+
 bool CHexCtrl::Create(const HEXCREATE& hcs)
 {
 	if (IsCreated()) { ut::DBG_REPORT(L"Already created."); return false; }
@@ -917,19 +1031,27 @@ auto CHexCtrl::GetData(HEXSPAN hss)const->SpanByte
 	if (!IsDataSetImpl()) { ut::DBG_REPORT_NO_DATA_SET(); return { }; }
 	assert(hss.ullSize > 0);
 
-	SpanByte spnData;
-	if (!IsVirtualImpl()) {
-		if (hss.ullOffset + hss.ullSize <= GetDataSizeImpl()) {
-			spnData = { m_stData.spnData.data() + hss.ullOffset, static_cast<std::size_t>(hss.ullSize) };
-		}
-	}
-	else {
-		assert(hss.ullSize <= GetCacheSize());
-		HEXDATAINFO hdi { .hdr { m_Wnd, static_cast<UINT>(m_Wnd.GetDlgCtrlID()) }, .stHexSpan { hss } };
-		m_stData.pHexVirtData->OnHexGetData(hdi);
-		spnData = hdi.spnData;
+	if (!IsPieceTableImpl())
+		return GetDataOrig(hss);
+
+	assert(hss.ullSize <= GetCacheSize());
+	if (hss.ullOffset + hss.ullSize > GetDataSizeImpl())
+		return { };
+
+	//Data is stitched from the pieces into the buffer, that is valid until the next call from the same thread,
+	//the same as the IHexVirtData::OnHexGetData data.
+	thread_local std::vector<std::byte> vecData;
+	if (vecData.size() < hss.ullSize) {
+		vecData.resize(static_cast<std::size_t>(hss.ullSize));
 	}
 
+	const SpanByte spnData { vecData.data(), static_cast<std::size_t>(hss.ullSize) };
+	m_PieceTable.Read(hss.ullOffset, spnData, [this](ULONGLONG ullOffset, SpanByte spnTo) {
+		if (const auto spnOrig = GetDataOrig({ ullOffset, spnTo.size() }); !spnOrig.empty()) {
+			std::copy_n(spnOrig.data(), spnTo.size(), spnTo.data());
+		}
+		});
+
 	return spnData;
 }
 
@@ -1207,10 +1329,10 @@ bool CHexCtrl::IsCmdAvail(EHexCmd eCmd)const
 		fAvail = fMutable && fSelection;
 		break;
 	case CMD_MODIFY_UNDO:
-		fAvail = !m_vecUndo.empty();
+		fAvail = IsPieceTableImpl() ? m_PieceTable.CanUndo() : m_Undo.CanUndo();
 		break;
 	case CMD_MODIFY_REDO:
-		fAvail = !m_vecRedo.empty();
+		fAvail = IsPieceTableImpl() ? m_PieceTable.CanRedo() : m_Undo.CanRedo();
 		break;
 	case CMD_BKM_ADD:
 	case CMD_BKM_DLG_MGR:
@@ -1327,309 +1449,97 @@ void CHexCtrl::ModifyData(const HEXMODIFY& hms)
 	if (!IsMutableImpl()) return;
 	if (hms.vecSpan.empty()) { ut::DBG_REPORT(L"Data to modify is empty."); return; }
 
-	m_vecRedo.clear(); //No Redo unless we make Undo.
-	SnapshotUndo(hms.vecSpan);
+	m_DlgSearch.StopSearchJob(); //Its worker must not read the data being modified.
+	if (hms.eModifyMode == EHexModifyMode::MODIFY_INSERT || hms.eModifyMode == EHexModifyMode::MODIFY_REMOVE) {
+		ModifySize(hms);
+		return;
+	}
 
-	SetRedraw(false);
-	using enum EHexModifyMode;
-	switch (hms.eModifyMode) {
-	case MODIFY_ONCE:
-	{
-		const auto stHexSpan = hms.vecSpan.back();
-		const auto ullOffsetToModify = stHexSpan.ullOffset;
-		const auto ullSizeToModify = (std::min)(stHexSpan.ullSize, static_cast<ULONGLONG>(hms.spnData.size()));
+	if (!SnapshotUndo(hms)) //Canceled by the user, data is left untouched.
+		return;
 
-		assert((ullOffsetToModify + ullSizeToModify) <= GetDataSizeImpl());
-		if ((ullOffsetToModify + ullSizeToModify) > GetDataSizeImpl())
-			return;
+	ModifyDataImpl(hms);
+	OnModifyData();
+}
 
-		if (IsVirtualImpl() && ullSizeToModify > GetCacheSize()) {
-			const auto ullSizeCache = GetCacheSize();
-			const auto ullRem = ullSizeToModify % ullSizeCache;
-			auto ullChunks = ullSizeToModify / ullSizeCache + (ullRem > 0 ? 1 : 0);
-			auto ullOffsetCurr = ullOffsetToModify;
-			auto ullOffsetSpanCurr = 0ULL;
-			while (ullChunks-- > 0) {
-				const auto ullSizeToModifyCurr = (ullChunks == 1 && ullRem > 0) ? ullRem : ullSizeCache;
-				const auto spnData = GetData({ ullOffsetCurr, ullSizeToModifyCurr });
-				assert(!spnData.empty());
-				std::copy_n(hms.spnData.data() + ullOffsetSpanCurr, ullSizeToModifyCurr, spnData.data());
-				SetDataVirtual(spnData, { ullOffsetCurr, ullSizeToModifyCurr });
-				ullOffsetCurr += ullSizeToModifyCurr;
-				ullOffsetSpanCurr += ullSizeToModifyCurr;
-			}
-		}
-		else {
-			const auto spnData = GetData({ ullOffsetToModify, ullSizeToModify });
-			assert(!spnData.empty());
-			std::copy_n(hms.spnData.data(), static_cast<std::size_t>(ullSizeToModify), spnData.data());
-			SetDataVirtual(spnData, { ullOffsetToModify, ullSizeToModify });
-		}
-	}
-	break;
-	case MODIFY_RAND_MT19937:
-	case MODIFY_RAND_FAST:
-	{
-		std::mt19937 gen(std::random_device { }());
-		std::uniform_int_distribution<std::uint64_t> distUInt64(0, (std::numeric_limits<std::uint64_t>::max)());
-		const auto lmbRandUInt64 = [&](std::byte* pData, const HEXMODIFY&, SpanCByte) {
-			assert(pData != nullptr);
-			*reinterpret_cast<std::uint64_t*>(pData) = distUInt64(gen);
-			};
-		const auto lmbRandByte = [&](std::byte* pData, const HEXMODIFY&, SpanCByte) {
-			assert(pData != nullptr);
-			*pData = static_cast<std::byte>(distUInt64(gen));
-			};
-		const auto lmbRandFast = [](std::byte* pData, const HEXMODIFY&, SpanCByte spnDataFrom) {
-			assert(pData != nullptr);
-			std::copy_n(spnDataFrom.data(), spnDataFrom.size(), pData);
-			};
+void CHexCtrl::PrepareSearch(const HEXSEARCH& hss)
+{
+	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return; }
+	if (!IsDataSetImpl()) { ut::DBG_REPORT_NO_DATA_SET(); return; }
 
-		const auto& hs = hms.vecSpan.back();
-		if (hms.eModifyMode == MODIFY_RAND_MT19937 && hms.vecSpan.size() == 1 && hs.ullSize >= sizeof(std::uint64_t)) {
-			ModifyWorker(hms, lmbRandUInt64, { static_cast<std::byte*>(nullptr), sizeof(std::uint64_t) });
+	m_DlgSearch.PrepareSearch(hss);
+}
 
-			if (const auto dwRem = hs.ullSize % sizeof(std::uint64_t); dwRem > 0) { //Remainder.
-				const auto ullOffset = hs.ullOffset + hs.ullSize - dwRem;
-				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { dwRem } });
-				for (std::size_t itRem = 0; itRem < dwRem; ++itRem) {
-					spnData.data()[itRem] = static_cast<std::byte>(distUInt64(gen));
-				}
-				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { dwRem } });
-			}
-		}
-		else if (hms.eModifyMode == MODIFY_RAND_FAST && hms.vecSpan.size() == 1 && hs.ullSize >= GetCacheSize()) {
-			//Fill the uptrRandData buffer with true random data of ulSizeRandBuff size.
-			//Then clone this buffer to the destination data.
-			//Buffer is allocated with alignment for maximum performance.
-			constexpr auto ulSizeRandBuff { 1024U * 1024U }; //1MB.
-			const std::unique_ptr < std::byte[], decltype([](std::byte* pData) { ::_aligned_free(pData); }) >
-				uptrRandData(static_cast<std::byte*>(::_aligned_malloc(ulSizeRandBuff, 32)));
-			for (auto it = 0UL; it < ulSizeRandBuff; it += sizeof(std::uint64_t)) {
-				*reinterpret_cast<std::uint64_t*>(&uptrRandData[it]) = distUInt64(gen);
-			};
+bool CHexCtrl::PreTranslateMsg(MSG* pMsg)
+{
+	if (m_DlgBkmMgr.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgDataInterp.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgModify.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgSearch.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgCodepage.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgGoTo.PreTranslateMsg(pMsg)) { return true; }
+	if (m_DlgTemplMgr.PreTranslateMsg(pMsg)) { return true; }
 
-			ModifyWorker(hms, lmbRandFast, { uptrRandData.get(), ulSizeRandBuff });
+	return false;
+}
 
-			//Filling the remainder data.
-			if (const auto ullRem = hs.ullSize % ulSizeRandBuff; ullRem > 0) { //Remainder.
-				if (ullRem <= GetCacheSize()) {
-					const auto ullOffsetCurr = hs.ullOffset + hs.ullSize - ullRem;
-					const auto spnData = GetData({ .ullOffset { ullOffsetCurr }, .ullSize { ullRem } });
-					assert(!spnData.empty());
-					std::copy_n(uptrRandData.get(), ullRem, spnData.data());
-					SetDataVirtual(spnData, { .ullOffset { ullOffsetCurr }, .ullSize { ullRem } });
-				}
-				else {
-					const auto ullSizeCache = GetCacheSize();
-					const auto dwModCache = ullRem % ullSizeCache;
-					auto ullChunks = (ullRem / ullSizeCache) + (dwModCache > 0 ? 1 : 0);
-					auto ullOffsetCurr = hs.ullOffset + hs.ullSize - ullRem;
-					auto ullOffsetRandCurr = 0ULL;
-					while (ullChunks-- > 0) {
-						const auto ullSizeToModify = (ullChunks == 1 && dwModCache > 0) ? dwModCache : ullSizeCache;
-						const auto spnData = GetData({ .ullOffset { ullOffsetCurr }, .ullSize { ullSizeToModify } });
-						assert(!spnData.empty());
-						std::copy_n(uptrRandData.get() + ullOffsetRandCurr, ullSizeToModify, spnData.data());
-						SetDataVirtual(spnData, { .ullOffset { ullOffsetCurr }, .ullSize { ullSizeToModify } });
-						ullOffsetCurr += ullSizeToModify;
-						ullOffsetRandCurr += ullSizeToModify;
-					}
-				}
-			}
-		}
-		else {
-			ModifyWorker(hms, lmbRandByte, { static_cast<std::byte*>(nullptr), sizeof(std::byte) });
-		}
+auto CHexCtrl::ProcessMsg(const MSG& msg)->LRESULT
+{
+	switch (msg.message) {
+	case WM_CHAR: return WMChar(msg);
+	case WM_COMMAND: return WMCommand(msg);
+	case WM_CONTEXTMENU: return WMContextMenu(msg);
+	case WM_DESTROY: return WMDestroy();
+	case WM_DPICHANGED_AFTERPARENT: return WMDPIChangedAfterParent();
+	case WM_ERASEBKGND: return WMEraseBkgnd(msg);
+	case WM_GETDLGCODE: return WMGetDlgCode(msg);
+	case WM_HELP: return WMHelp(msg);
+	case WM_HSCROLL: return WMHScroll(msg);
+	case WM_INITMENUPOPUP: return WMInitMenuPopup(msg);
+	case WM_SYSKEYDOWN:
+	case WM_KEYDOWN: return WMKeyDown(msg);
+	case WM_KEYUP: return WMKeyUp(msg);
+	case WM_LBUTTONDBLCLK: return WMLButtonDblClk(msg);
+	case WM_LBUTTONDOWN: return WMLButtonDown(msg);
+	case WM_LBUTTONUP: return WMLButtonUp(msg);
+	case WM_MBUTTONDOWN: return WMMButtonDown(msg);
+	case WM_MOUSEMOVE: return WMMouseMove(msg);
+	case WM_MOUSEWHEEL: return WMMouseWheel(msg);
+	case WM_NCACTIVATE: return WMNCActivate(msg);
+	case WM_NCCALCSIZE: return WMNCCalcSize(msg);
+	case WM_NCPAINT: return WMNCPaint(msg);
+	case WM_PAINT: return WMPaint();
+	case WM_RBUTTONDOWN: return WMRButtonDown(msg);
+	case WM_SETCURSOR: return WMSetCursor(msg);
+	case WM_SETFOCUS: return WMSetFocus(msg);
+	case WM_SIZE: return WMSize(msg);
+	case WM_TIMER: return WMTimer(msg);
+	case WM_VSCROLL: return WMVScroll(msg);
+	default: return GDIUT::DefWndProc(msg);
 	}
-	break;
-	case MODIFY_REPEAT:
-	{
-		constexpr auto lmbRepeat = [](std::byte* pData, const HEXMODIFY& /**/, SpanCByte spnDataFrom) {
-			assert(pData != nullptr);
-			std::copy_n(spnDataFrom.data(), spnDataFrom.size(), pData);
-			};
+}
 
-		//In cases where only one affected data region (hms.vecSpan.size()==1) is used,
-		//and the size of the repeated data is equal to the extent of 2, we extend that 
-		//repeated data to the ulSizeBuffFastFill size, to speed up the whole process of repeating.
-		//At the end we simply fill up the remainder (ullSizeToModify % ulSizeBuffFastFill).
-		constexpr auto ulSizeBuffFastFill { 256U };
-		const auto ullOffsetToModify = hms.vecSpan.back().ullOffset;
-		const auto ullSizeToModify = hms.vecSpan.back().ullSize;
-		const auto ullSizeToFillWith = hms.spnData.size();
+void CHexCtrl::Redraw()
+{
+	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return; }
 
-		if (hms.vecSpan.size() == 1 && ullSizeToModify > ulSizeBuffFastFill
-			&& ullSizeToFillWith < ulSizeBuffFastFill && (ulSizeBuffFastFill % ullSizeToFillWith) == 0) {
-			alignas(32) std::byte buffFillData[ulSizeBuffFastFill]; //Buffer for fast data fill.
-			for (auto it = 0ULL; it < ulSizeBuffFastFill; it += ullSizeToFillWith) { //Fill the buffer.
-				std::copy_n(hms.spnData.data(), ullSizeToFillWith, buffFillData + it);
-			}
-			ModifyWorker(hms, lmbRepeat, { buffFillData, ulSizeBuffFastFill }); //Worker with the big fast buffer.
+	RedrawImpl();
+}
 
-			if (const auto ullRem = ullSizeToModify % ulSizeBuffFastFill; ullRem >= ullSizeToFillWith) { //Remainder.
-				const auto ullOffset = ullOffsetToModify + ullSizeToModify - ullRem;
-				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { ullRem } });
-				for (std::size_t itRem = 0; itRem < (ullRem / ullSizeToFillWith); ++itRem) { //Works only if ullRem >= ullSizeToFillWith.
-					std::copy_n(hms.spnData.data(), ullSizeToFillWith, spnData.data() + (itRem * ullSizeToFillWith));
-				}
-				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { ullRem - (ullRem % ullSizeToFillWith) } });
-			}
-		}
-		else {
-			ModifyWorker(hms, lmbRepeat, hms.spnData);
-		}
-	}
-	break;
-	case MODIFY_OPERATION:
-	{
-		using enum EHexDataType;
-		using enum EHexOperMode;
-		//Special case for the OPER_ASSIGN operation. This operation can easily be replaced 
-		//with the MODIFY_REPEAT mode, which is significantly faster.
+auto CHexCtrl::Search(const HEXSEARCH& hss)->ULONGLONG
+{
+	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return { }; }
+	if (!IsDataSetImpl()) { ut::DBG_REPORT_NO_DATA_SET(); return { }; }
 
-		if (hms.eOperMode == OPER_ASSIGN) {
-			HEXMODIFY hmsRepeat = hms;
-			hmsRepeat.eModifyMode = MODIFY_REPEAT;
-			std::uint64_t u64Data { };
+	return m_DlgSearch.Search(hss);
+}
 
-			switch (hms.eDataType) {
-			case DATA_INT16:
-			case DATA_UINT16:
-			{
-				auto u16 = *reinterpret_cast<const std::uint16_t*>(hms.spnData.data());
-				if (hms.fBigEndian) { u16 = ut::ByteSwap(u16); }
-				u64Data = u16;
-				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint16_t) };
-			}
-			break;
-			case DATA_INT32:
-			case DATA_UINT32:
-			case DATA_FLOAT:
-			{
-				auto u32 = *reinterpret_cast<const std::uint32_t*>(hms.spnData.data());
-				if (hms.fBigEndian) { u32 = ut::ByteSwap(u32); }
-				u64Data = u32;
-				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint32_t) };
-			}
-			break;
-			case DATA_INT64:
-			case DATA_UINT64:
-			case DATA_DOUBLE:
-			{
-				auto u64 = *reinterpret_cast<const std::uint64_t*>(hms.spnData.data());
-				if (hms.fBigEndian) { u64 = ut::ByteSwap(u64); }
-				u64Data = u64;
-				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint64_t) };
-			}
-			break;
-			default:
-				break;
-			};
-
-			ModifyData(hmsRepeat);
-			return;
-		}
-
-		//In cases where the only one affected data region (hms.vecSpan.size()==1) is used,
-		//and ullSizeToModify > ulSizeOfVec, we use SIMD.
-		//At the end we simply fill up the remainder (ullSizeToModify % ulSizeOfVec).
-		const auto ulSizeOfVec { simd::VecTypeToSize(simd::GetVectorType()) };
-		const auto ullOffsetToModify = hms.vecSpan.back().ullOffset;
-		const auto ullSizeToModify = hms.vecSpan.back().ullSize;
-		const auto ullSizeToFillWith = hms.spnData.size();
-
-		if (hms.vecSpan.size() == 1 && ((ullSizeToModify / ulSizeOfVec) > 0)) {
-			using PFuncWorker = void(*)(std::byte* pData, const HEXCTRL::HEXMODIFY& hms, HEXCTRL::SpanCByte);
-			PFuncWorker pFuncWorker;
-			switch (simd::GetVectorType()) {
-			case simd::EVecType::VECTOR_128:
-				pFuncWorker = simd::ModifyOperVec<simd::EVecType::VECTOR_128>;
-				break;
-			case simd::EVecType::VECTOR_256:
-				pFuncWorker = simd::ModifyOperVec<simd::EVecType::VECTOR_256>;
-				break;
-			default: return;
-			}
-
-			ModifyWorker(hms, pFuncWorker, { static_cast<std::byte*>(nullptr), ulSizeOfVec }); //Vector worker.
-
-			if (const auto ullRem = ullSizeToModify % ulSizeOfVec; ullRem >= ullSizeToFillWith) { //Remainder of the vector data.
-				const auto ullOffset = ullOffsetToModify + ullSizeToModify - ullRem;
-				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { ullRem } });
-				for (std::size_t itRem = 0; itRem < (ullRem / ullSizeToFillWith); ++itRem) { //Works only if ullRem >= ullSizeToFillWith.
-					ModifyOperScalar(spnData.data() + (itRem * ullSizeToFillWith), hms, { });
-				}
-				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { ullRem - (ullRem % ullSizeToFillWith) } });
-			}
-		}
-		else {
-			ModifyWorker(hms, ModifyOperScalar, hms.spnData);
-		}
-	}
-	break;
-	default:
-		break;
-	}
-	SetRedraw(true);
-
-	OnModifyData();
-}
-
-bool CHexCtrl::PreTranslateMsg(MSG* pMsg)
-{
-	if (m_DlgBkmMgr.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgDataInterp.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgModify.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgSearch.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgCodepage.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgGoTo.PreTranslateMsg(pMsg)) { return true; }
-	if (m_DlgTemplMgr.PreTranslateMsg(pMsg)) { return true; }
-
-	return false;
-}
-
-auto CHexCtrl::ProcessMsg(const MSG& msg)->LRESULT
-{
-	switch (msg.message) {
-	case WM_CHAR: return WMChar(msg);
-	case WM_COMMAND: return WMCommand(msg);
-	case WM_CONTEXTMENU: return WMContextMenu(msg);
-	case WM_DESTROY: return WMDestroy();
-	case WM_DPICHANGED_AFTERPARENT: return WMDPIChangedAfterParent();
-	case WM_ERASEBKGND: return WMEraseBkgnd(msg);
-	case WM_GETDLGCODE: return WMGetDlgCode(msg);
-	case WM_HELP: return WMHelp(msg);
-	case WM_HSCROLL: return WMHScroll(msg);
-	case WM_INITMENUPOPUP: return WMInitMenuPopup(msg);
-	case WM_SYSKEYDOWN:
-	case WM_KEYDOWN: return WMKeyDown(msg);
-	case WM_KEYUP: return WMKeyUp(msg);
-	case WM_LBUTTONDBLCLK: return WMLButtonDblClk(msg);
-	case WM_LBUTTONDOWN: return WMLButtonDown(msg);
-	case WM_LBUTTONUP: return WMLButtonUp(msg);
-	case WM_MBUTTONDOWN: return WMMButtonDown(msg);
-	case WM_MOUSEMOVE: return WMMouseMove(msg);
-	case WM_MOUSEWHEEL: return WMMouseWheel(msg);
-	case WM_NCACTIVATE: return WMNCActivate(msg);
-	case WM_NCCALCSIZE: return WMNCCalcSize(msg);
-	case WM_NCPAINT: return WMNCPaint(msg);
-	case WM_PAINT: return WMPaint();
-	case WM_RBUTTONDOWN: return WMRButtonDown(msg);
-	case WM_SETCURSOR: return WMSetCursor(msg);
-	case WM_SETFOCUS: return WMSetFocus(msg);
-	case WM_SIZE: return WMSize(msg);
-	case WM_TIMER: return WMTimer(msg);
-	case WM_VSCROLL: return WMVScroll(msg);
-	default: return GDIUT::DefWndProc(msg);
-	}
-}
-
-void CHexCtrl::Redraw()
+auto CHexCtrl::SearchWorker(const HEXSEARCH& hss)const->ULONGLONG
 {
-	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return; }
+	if (!IsCreated()) { ut::DBG_REPORT_NOT_CREATED(); return { }; }
+	if (!IsDataSetImpl()) { ut::DBG_REPORT_NO_DATA_SET(); return { }; }
 
-	RedrawImpl();
+	return m_DlgSearch.SearchWorker(hss);
 }
 
 void CHexCtrl::SetCapacity(DWORD dwCapacity)
@@ -1704,6 +1614,8 @@ void CHexCtrl::SetData(const HEXDATA& hd, bool fAdjust)
 			ut::DBG_REPORT(L"Data size must be equal to the prior data size.");
 			return;
 		}
+
+		m_DlgSearch.StopSearchJob(); //Its worker must not read the data being replaced.
 	}
 	else { //Clear any previously set data before setting the new data.
 		ClearData();
@@ -1711,6 +1623,11 @@ void CHexCtrl::SetData(const HEXDATA& hd, bool fAdjust)
 
 	m_stData = hd;
 	m_stData.dwCacheSize = (std::max)(hd.dwCacheSize, 1024UL * 64UL); //Minimum cache size for VirtualData mode.
+	m_Undo.SetBudget(hd.ullUndoBudget);
+	if (hd.fPieceTable != m_PieceTable.IsSet()) { //Undo data of the other kind is of no use anymore.
+		m_Undo.Clear();
+		hd.fPieceTable ? m_PieceTable.Reset(hd.spnData.size()) : m_PieceTable.Clear();
+	}
 
 	const auto ullDataSize = hd.pHexVirtData ?
 		(std::max)(hd.ullMaxVirtOffset, static_cast<ULONGLONG>(hd.spnData.size())) : hd.spnData.size();
@@ -1739,6 +1656,7 @@ void CHexCtrl::SetData(const HEXDATA& hd, bool fAdjust)
 	RecalcAll();
 	RedrawImpl();
 	m_DlgDataInterp.UpdateData(); //Update data if DI dialog is opened.
+	m_DlgSearch.EnableIndex(hd.fSearchIndex, hd.fSuffixArray);
 }
 
 void CHexCtrl::SetDateInfo(DWORD dwFormat, wchar_t wchSepar)
@@ -3773,9 +3691,27 @@ auto CHexCtrl::GetCommandFromMenu(WORD wMenuID)const->std::optional<EHexCmd>
 	return std::nullopt;
 }
 
+auto CHexCtrl::GetDataOrig(HEXSPAN hss)const->SpanByte
+{
+	SpanByte spnData;
+	if (m_stData.pHexVirtData == nullptr) {
+		if (hss.ullOffset + hss.ullSize <= m_stData.spnData.size()) {
+			spnData = { m_stData.spnData.data() + hss.ullOffset, static_cast<std::size_t>(hss.ullSize) };
+		}
+	}
+	else {
+		assert(hss.ullSize <= GetCacheSize());
+		HEXDATAINFO hdi { .hdr { m_Wnd, static_cast<UINT>(m_Wnd.GetDlgCtrlID()) }, .stHexSpan { hss } };
+		m_stData.pHexVirtData->OnHexGetData(hdi);
+		spnData = hdi.spnData;
+	}
+
+	return spnData;
+}
+
 auto CHexCtrl::GetDataSizeImpl()const->std::uint64_t
 {
-	return m_stData.spnData.size();
+	return IsPieceTableImpl() ? m_PieceTable.GetDataSize() : m_stData.spnData.size();
 }
 
 auto CHexCtrl::GetDigitsOffset()const->DWORD
@@ -3800,7 +3736,7 @@ auto CHexCtrl::GetHexChars()const->const wchar_t*
 
 auto CHexCtrl::GetOffsetImpl(std::uint64_t u64Offset, bool fGetVirt) const -> std::uint64_t
 {
-	if (IsVirtualImpl()) {
+	if (m_stData.pHexVirtData != nullptr) {
 		HEXDATAINFO hdi { .hdr { m_Wnd, static_cast<UINT>(m_Wnd.GetDlgCtrlID()) }, .stHexSpan { .ullOffset { u64Offset } } };
 		m_stData.pHexVirtData->OnHexGetOffset(hdi, fGetVirt);
 		return hdi.stHexSpan.ullOffset;
@@ -3904,80 +3840,434 @@ auto CHexCtrl::HitTest(POINT pt)const->std::optional<HEXHITTEST>
 				}
 			}
 
-			const auto iCurrChunkBegin = m_iIndentFirstHexChunkXPx + (m_iSizeHexBytePx * itCapacity) + iTotalSpaceBetweenChunks;
-			const auto iCurrChunkEnd = iCurrChunkBegin + m_iSizeHexBytePx +
-				(((itCapacity + 1) % dwGroupSize) == 0 ? GetCharWidthExtras() : 0)
-				+ ((dwGroupSize == 1 && (itCapacity + 1) == m_dwCapacityBlockSize) ? m_iSpaceBetweenBlocksPx : 0);
+			const auto iCurrChunkBegin = m_iIndentFirstHexChunkXPx + (m_iSizeHexBytePx * itCapacity) + iTotalSpaceBetweenChunks;
+			const auto iCurrChunkEnd = iCurrChunkBegin + m_iSizeHexBytePx +
+				(((itCapacity + 1) % dwGroupSize) == 0 ? GetCharWidthExtras() : 0)
+				+ ((dwGroupSize == 1 && (itCapacity + 1) == m_dwCapacityBlockSize) ? m_iSpaceBetweenBlocksPx : 0);
+
+			if (static_cast<unsigned int>(iX) < iCurrChunkEnd) { //If iX lays in-between [iCurrChunkBegin...iCurrChunkEnd).
+				stHit.ullOffset = static_cast<ULONGLONG>(itCapacity) + ((iY - m_iStartWorkAreaYPx) / m_sizeFontMain.cy) *
+					dwCapacity + (ullCurLine * dwCapacity);
+
+				if ((iX - iCurrChunkBegin) < static_cast<DWORD>(GetCharWidthExtras())) { //Check byte's High or Low half was hit.
+					stHit.fIsHigh = true;
+				}
+
+				fHit = true;
+				break;
+			}
+		}
+	}
+	//Or within Text area.
+	else if ((iX >= m_iIndentTextXPx) && (iX < (m_iIndentTextXPx + m_iDistanceBetweenCharsPx * static_cast<int>(dwCapacity)))
+		&& (iY >= m_iStartWorkAreaYPx) && iY <= m_iEndWorkAreaPx) {
+		//Calculate ullOffset Text symbol.
+		stHit.ullOffset = ((iX - static_cast<ULONGLONG>(m_iIndentTextXPx)) / m_iDistanceBetweenCharsPx) +
+			((iY - m_iStartWorkAreaYPx) / m_sizeFontMain.cy) * dwCapacity + (ullCurLine * dwCapacity);
+		stHit.fIsText = true;
+		fHit = true;
+	}
+
+	//If iX is out of end-bound of Hex chunks or Text chars.
+	if (stHit.ullOffset >= GetDataSizeImpl()) {
+		fHit = false;
+	}
+
+	return fHit ? std::optional<HEXHITTEST> { stHit } : std::nullopt;
+}
+
+bool CHexCtrl::IsCurTextArea()const
+{
+	return m_fCursorTextArea;
+}
+
+bool CHexCtrl::IsDataSetImpl()const
+{
+	return m_fDataSet;
+}
+
+bool CHexCtrl::IsDrawable()const
+{
+	return m_fRedraw;
+}
+
+bool CHexCtrl::IsMutableImpl()const
+{
+	return m_stData.fMutable;
+}
+
+bool CHexCtrl::IsOffsetAsHexImpl()const
+{
+	return m_fOffsetHex;
+}
+
+bool CHexCtrl::IsPageVisible()const
+{
+	return GetPageSizeImpl() > 0 && (GetPageSizeImpl() % GetCapacity() == 0) && GetPageSizeImpl() >= GetCapacity();
+}
+
+bool CHexCtrl::IsPieceTableImpl()const
+{
+	return m_PieceTable.IsSet();
+}
+
+bool CHexCtrl::IsScrollCursor()const
+{
+	return m_fScrollCursor;
+}
+
+bool CHexCtrl::IsVirtualImpl()const
+{
+	//With the piece table the data is accessed the same way as in VirtualData mode, chunk by chunk of the cache size.
+	return m_stData.pHexVirtData != nullptr || IsPieceTableImpl();
+}
+
+void CHexCtrl::ModifyDataImpl(const HEXMODIFY& hms)
+{
+	SetRedraw(false);
+	using enum EHexModifyMode;
+	switch (hms.eModifyMode) {
+	case MODIFY_ONCE:
+	{
+		//Bytes from the spnData are set at every span (e.g. Replace All). Sorted spans are grouped into chunks
+		//of up to the cache size (the whole data in the default mode), every chunk is acquired and set only once.
+		const auto& vecSpan = hms.vecSpan;
+		const auto ullSizeData = static_cast<ULONGLONG>(hms.spnData.size());
+		const auto ullSizeChunkMax = IsVirtualImpl() ? static_cast<ULONGLONG>(GetCacheSize()) : GetDataSizeImpl();
+		for (std::size_t itFirst = 0; itFirst < vecSpan.size();) {
+			const auto ullOffsetChunk = vecSpan[itFirst].ullOffset;
+			auto ullEndChunk = ullOffsetChunk;
+			auto itLast = itFirst; //One past the last span in the chunk.
+			for (; itLast < vecSpan.size(); ++itLast) {
+				const auto& hs = vecSpan[itLast];
+				const auto ullEnd = hs.ullOffset + (std::min)(hs.ullSize, ullSizeData);
+				if (itLast > itFirst && (hs.ullOffset < ullEndChunk || ullEnd - ullOffsetChunk > ullSizeChunkMax))
+					break;
+
+				ullEndChunk = ullEnd;
+			}
+
+			assert(ullEndChunk <= GetDataSizeImpl());
+			if (ullEndChunk > GetDataSizeImpl())
+				break;
+
+			const auto ullSizeChunk = ullEndChunk - ullOffsetChunk;
+			if (ullSizeChunk > ullSizeChunkMax) { //Single span that is bigger than the cache, in VirtualData mode.
+				const auto ullSizeCache = GetCacheSize();
+				const auto ullRem = ullSizeChunk % ullSizeCache;
+				auto ullChunks = ullSizeChunk / ullSizeCache + (ullRem > 0 ? 1 : 0);
+				auto ullOffsetCurr = ullOffsetChunk;
+				auto ullOffsetSpanCurr = 0ULL;
+				while (ullChunks-- > 0) {
+					const auto ullSizeToModifyCurr = (ullChunks == 0 && ullRem > 0) ? ullRem : ullSizeCache;
+					const auto spnData = GetData({ ullOffsetCurr, ullSizeToModifyCurr });
+					assert(!spnData.empty());
+					std::copy_n(hms.spnData.data() + ullOffsetSpanCurr, ullSizeToModifyCurr, spnData.data());
+					SetDataVirtual(spnData, { ullOffsetCurr, ullSizeToModifyCurr });
+					ullOffsetCurr += ullSizeToModifyCurr;
+					ullOffsetSpanCurr += ullSizeToModifyCurr;
+				}
+			}
+			else if (ullSizeChunk > 0) {
+				const auto spnData = GetData({ ullOffsetChunk, ullSizeChunk });
+				assert(!spnData.empty());
+				for (auto it = itFirst; it < itLast; ++it) {
+					const auto& hs = vecSpan[it];
+					std::copy_n(hms.spnData.data(), static_cast<std::size_t>((std::min)(hs.ullSize, ullSizeData)),
+						spnData.data() + (hs.ullOffset - ullOffsetChunk));
+				}
+				SetDataVirtual(spnData, { ullOffsetChunk, ullSizeChunk });
+			}
+			itFirst = itLast;
+		}
+	}
+	break;
+	case MODIFY_RAND_MT19937:
+	case MODIFY_RAND_FAST:
+	{
+		std::mt19937 gen(std::random_device { }());
+		std::uniform_int_distribution<std::uint64_t> distUInt64(0, (std::numeric_limits<std::uint64_t>::max)());
+
+		//Workers can be run by many threads at once (see ModifyWorker), so every thread has its own generator.
+		const auto lmbRandUInt64 = [](std::byte* pData, const HEXMODIFY&, SpanCByte) {
+			assert(pData != nullptr);
+			thread_local std::mt19937 genThread(std::random_device { }());
+			thread_local std::uniform_int_distribution<std::uint64_t> distThread(0, (std::numeric_limits<std::uint64_t>::max)());
+			*reinterpret_cast<std::uint64_t*>(pData) = distThread(genThread);
+			};
+		const auto lmbRandByte = [](std::byte* pData, const HEXMODIFY&, SpanCByte) {
+			assert(pData != nullptr);
+			thread_local std::mt19937 genThread(std::random_device { }());
+			*pData = static_cast<std::byte>(genThread());
+			};
+		const auto lmbRandFast = [](std::byte* pData, const HEXMODIFY&, SpanCByte spnDataFrom) {
+			assert(pData != nullptr);
+			std::copy_n(spnDataFrom.data(), spnDataFrom.size(), pData);
+			};
+
+		const auto& hs = hms.vecSpan.back();
+		if (hms.eModifyMode == MODIFY_RAND_MT19937 && hms.vecSpan.size() == 1 && hs.ullSize >= sizeof(std::uint64_t)) {
+			ModifyWorker(hms, lmbRandUInt64, { static_cast<std::byte*>(nullptr), sizeof(std::uint64_t) });
+
+			if (const auto dwRem = hs.ullSize % sizeof(std::uint64_t); dwRem > 0) { //Remainder.
+				const auto ullOffset = hs.ullOffset + hs.ullSize - dwRem;
+				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { dwRem } });
+				for (std::size_t itRem = 0; itRem < dwRem; ++itRem) {
+					spnData.data()[itRem] = static_cast<std::byte>(distUInt64(gen));
+				}
+				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { dwRem } });
+			}
+		}
+		else if (hms.eModifyMode == MODIFY_RAND_FAST && hms.vecSpan.size() == 1 && hs.ullSize >= GetCacheSize()) {
+			//Fill the uptrRandData buffer with true random data of ulSizeRandBuff size.
+			//Then clone this buffer to the destination data.
+			//Buffer is allocated with alignment for maximum performance.
+			constexpr auto ulSizeRandBuff { 1024U * 1024U }; //1MB.
+			const std::unique_ptr < std::byte[], decltype([](std::byte* pData) { ::_aligned_free(pData); }) >
+				uptrRandData(static_cast<std::byte*>(::_aligned_malloc(ulSizeRandBuff, 32)));
+			for (auto it = 0UL; it < ulSizeRandBuff; it += sizeof(std::uint64_t)) {
+				*reinterpret_cast<std::uint64_t*>(&uptrRandData[it]) = distUInt64(gen);
+			};
+
+			ModifyWorker(hms, lmbRandFast, { uptrRandData.get(), ulSizeRandBuff });
+
+			//Filling the remainder data.
+			if (const auto ullRem = hs.ullSize % ulSizeRandBuff; ullRem > 0) { //Remainder.
+				if (ullRem <= GetCacheSize()) {
+					const auto ullOffsetCurr = hs.ullOffset + hs.ullSize - ullRem;
+					const auto spnData = GetData({ .ullOffset { ullOffsetCurr }, .ullSize { ullRem } });
+					assert(!spnData.empty());
+					std::copy_n(uptrRandData.get(), ullRem, spnData.data());
+					SetDataVirtual(spnData, { .ullOffset { ullOffsetCurr }, .ullSize { ullRem } });
+				}
+				else {
+					const auto ullSizeCache = GetCacheSize();
+					const auto dwModCache = ullRem % ullSizeCache;
+					auto ullChunks = (ullRem / ullSizeCache) + (dwModCache > 0 ? 1 : 0);
+					auto ullOffsetCurr = hs.ullOffset + hs.ullSize - ullRem;
+					auto ullOffsetRandCurr = 0ULL;
+					while (ullChunks-- > 0) {
+						const auto ullSizeToModify = (ullChunks == 1 && dwModCache > 0) ? dwModCache : ullSizeCache;
+						const auto spnData = GetData({ .ullOffset { ullOffsetCurr }, .ullSize { ullSizeToModify } });
+						assert(!spnData.empty());
+						std::copy_n(uptrRandData.get() + ullOffsetRandCurr, ullSizeToModify, spnData.data());
+						SetDataVirtual(spnData, { .ullOffset { ullOffsetCurr }, .ullSize { ullSizeToModify } });
+						ullOffsetCurr += ullSizeToModify;
+						ullOffsetRandCurr += ullSizeToModify;
+					}
+				}
+			}
+		}
+		else {
+			ModifyWorker(hms, lmbRandByte, { static_cast<std::byte*>(nullptr), sizeof(std::byte) });
+		}
+	}
+	break;
+	case MODIFY_REPEAT:
+	{
+		constexpr auto lmbRepeat = [](std::byte* pData, const HEXMODIFY& /**/, SpanCByte spnDataFrom) {
+			assert(pData != nullptr);
+			std::copy_n(spnDataFrom.data(), spnDataFrom.size(), pData);
+			};
+
+		//In cases where only one affected data region (hms.vecSpan.size()==1) is used,
+		//and the size of the repeated data is equal to the extent of 2, we extend that 
+		//repeated data to the ulSizeBuffFastFill size, to speed up the whole process of repeating.
+		//At the end we simply fill up the remainder (ullSizeToModify % ulSizeBuffFastFill).
+		constexpr auto ulSizeBuffFastFill { 256U };
+		const auto ullOffsetToModify = hms.vecSpan.back().ullOffset;
+		const auto ullSizeToModify = hms.vecSpan.back().ullSize;
+		const auto ullSizeToFillWith = hms.spnData.size();
+
+		if (hms.vecSpan.size() == 1 && ullSizeToModify > ulSizeBuffFastFill
+			&& ullSizeToFillWith < ulSizeBuffFastFill && (ulSizeBuffFastFill % ullSizeToFillWith) == 0) {
+			alignas(32) std::byte buffFillData[ulSizeBuffFastFill]; //Buffer for fast data fill.
+			for (auto it = 0ULL; it < ulSizeBuffFastFill; it += ullSizeToFillWith) { //Fill the buffer.
+				std::copy_n(hms.spnData.data(), ullSizeToFillWith, buffFillData + it);
+			}
+			ModifyWorker(hms, lmbRepeat, { buffFillData, ulSizeBuffFastFill }); //Worker with the big fast buffer.
+
+			if (const auto ullRem = ullSizeToModify % ulSizeBuffFastFill; ullRem >= ullSizeToFillWith) { //Remainder.
+				const auto ullOffset = ullOffsetToModify + ullSizeToModify - ullRem;
+				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { ullRem } });
+				for (std::size_t itRem = 0; itRem < (ullRem / ullSizeToFillWith); ++itRem) { //Works only if ullRem >= ullSizeToFillWith.
+					std::copy_n(hms.spnData.data(), ullSizeToFillWith, spnData.data() + (itRem * ullSizeToFillWith));
+				}
+				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { ullRem - (ullRem % ullSizeToFillWith) } });
+			}
+		}
+		else {
+			ModifyWorker(hms, lmbRepeat, hms.spnData);
+		}
+	}
+	break;
+	case MODIFY_OPERATION:
+	{
+		using enum EHexDataType;
+		using enum EHexOperMode;
+		//Special case for the OPER_ASSIGN operation. This operation can easily be replaced 
+		//with the MODIFY_REPEAT mode, which is significantly faster.
+
+		if (hms.eOperMode == OPER_ASSIGN) {
+			HEXMODIFY hmsRepeat = hms;
+			hmsRepeat.eModifyMode = MODIFY_REPEAT;
+			std::uint64_t u64Data { };
+
+			switch (hms.eDataType) {
+			case DATA_INT16:
+			case DATA_UINT16:
+			{
+				auto u16 = *reinterpret_cast<const std::uint16_t*>(hms.spnData.data());
+				if (hms.fBigEndian) { u16 = ut::ByteSwap(u16); }
+				u64Data = u16;
+				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint16_t) };
+			}
+			break;
+			case DATA_INT32:
+			case DATA_UINT32:
+			case DATA_FLOAT:
+			{
+				auto u32 = *reinterpret_cast<const std::uint32_t*>(hms.spnData.data());
+				if (hms.fBigEndian) { u32 = ut::ByteSwap(u32); }
+				u64Data = u32;
+				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint32_t) };
+			}
+			break;
+			case DATA_INT64:
+			case DATA_UINT64:
+			case DATA_DOUBLE:
+			{
+				auto u64 = *reinterpret_cast<const std::uint64_t*>(hms.spnData.data());
+				if (hms.fBigEndian) { u64 = ut::ByteSwap(u64); }
+				u64Data = u64;
+				hmsRepeat.spnData = { reinterpret_cast<const std::byte*>(&u64Data), sizeof(std::uint64_t) };
+			}
+			break;
+			default:
+				break;
+			};
+
+			ModifyDataImpl(hmsRepeat);
+			return;
+		}
 
-			if (static_cast<unsigned int>(iX) < iCurrChunkEnd) { //If iX lays in-between [iCurrChunkBegin...iCurrChunkEnd).
-				stHit.ullOffset = static_cast<ULONGLONG>(itCapacity) + ((iY - m_iStartWorkAreaYPx) / m_sizeFontMain.cy) *
-					dwCapacity + (ullCurLine * dwCapacity);
+		//In cases where the only one affected data region (hms.vecSpan.size()==1) is used,
+		//and ullSizeToModify > ulSizeOfVec, we use SIMD.
+		//At the end we simply fill up the remainder (ullSizeToModify % ulSizeOfVec).
+		const auto ulSizeOfVec { simd::VecTypeToSize(simd::GetVectorTypeMax()) };
+		const auto ullOffsetToModify = hms.vecSpan.back().ullOffset;
+		const auto ullSizeToModify = hms.vecSpan.back().ullSize;
+		const auto ullSizeToFillWith = hms.spnData.size();
 
-				if ((iX - iCurrChunkBegin) < static_cast<DWORD>(GetCharWidthExtras())) { //Check byte's High or Low half was hit.
-					stHit.fIsHigh = true;
+		if (hms.vecSpan.size() == 1 && ((ullSizeToModify / ulSizeOfVec) > 0)) {
+			using PFuncWorker = void(*)(std::byte* pData, const HEXCTRL::HEXMODIFY& hms, HEXCTRL::SpanCByte);
+			static const auto pFuncWorker = []()->PFuncWorker { //Vector worker of the CPU's widest tier, chosen once.
+				switch (simd::GetVectorTypeMax()) {
+				case simd::EVecType::VECTOR_128:
+					return simd::ModifyOperVec<simd::EVecType::VECTOR_128>;
+				case simd::EVecType::VECTOR_256:
+					return simd::ModifyOperVec<simd::EVecType::VECTOR_256>;
+				case simd::EVecType::VECTOR_512:
+					return simd::ModifyOperVec<simd::EVecType::VECTOR_512>;
+				default:
+					return nullptr;
 				}
+				}();
+			if (pFuncWorker == nullptr)
+				return;
 
-				fHit = true;
-				break;
+			ModifyWorker(hms, pFuncWorker, { static_cast<std::byte*>(nullptr), ulSizeOfVec }); //Vector worker.
+
+			if (const auto ullRem = ullSizeToModify % ulSizeOfVec; ullRem >= ullSizeToFillWith) { //Remainder of the vector data.
+				const auto ullOffset = ullOffsetToModify + ullSizeToModify - ullRem;
+				const auto spnData = GetData({ .ullOffset { ullOffset }, .ullSize { ullRem } });
+				for (std::size_t itRem = 0; itRem < (ullRem / ullSizeToFillWith); ++itRem) { //Works only if ullRem >= ullSizeToFillWith.
+					ModifyOperScalar(spnData.data() + (itRem * ullSizeToFillWith), hms, { });
+				}
+				SetDataVirtual(spnData, { .ullOffset { ullOffset }, .ullSize { ullRem - (ullRem % ullSizeToFillWith) } });
 			}
 		}
+		else {
+			ModifyWorker(hms, ModifyOperScalar, hms.spnData);
+		}
 	}
-	//Or within Text area.
-	else if ((iX >= m_iIndentTextXPx) && (iX < (m_iIndentTextXPx + m_iDistanceBetweenCharsPx * static_cast<int>(dwCapacity)))
-		&& (iY >= m_iStartWorkAreaYPx) && iY <= m_iEndWorkAreaPx) {
-		//Calculate ullOffset Text symbol.
-		stHit.ullOffset = ((iX - static_cast<ULONGLONG>(m_iIndentTextXPx)) / m_iDistanceBetweenCharsPx) +
-			((iY - m_iStartWorkAreaYPx) / m_sizeFontMain.cy) * dwCapacity + (ullCurLine * dwCapacity);
-		stHit.fIsText = true;
-		fHit = true;
+	break;
+	default:
+		break;
 	}
+	SetRedraw(true);
+}
 
-	//If iX is out of end-bound of Hex chunks or Text chars.
-	if (stHit.ullOffset >= GetDataSizeImpl()) {
-		fHit = false;
+void CHexCtrl::ModifySize(const HEXMODIFY& hms)
+{
+	if (!IsPieceTableImpl()) {
+		ut::DBG_REPORT(L"Data size can only be changed with the HEXDATA::fPieceTable flag.");
+		return;
 	}
 
-	return fHit ? std::optional<HEXHITTEST> { stHit } : std::nullopt;
-}
+	const auto fInsert = hms.eModifyMode == EHexModifyMode::MODIFY_INSERT;
+	if (fInsert && hms.spnData.empty()) { ut::DBG_REPORT(L"Data to insert is empty."); return; }
 
-bool CHexCtrl::IsCurTextArea()const
-{
-	return m_fCursorTextArea;
-}
+	//Spans are sorted, and the ones at the same offset (to insert), or overlapping (to remove), are merged.
+	auto vecSpan = hms.vecSpan;
+	std::erase_if(vecSpan, [](const HEXSPAN& hs) { return hs.ullSize == 0; });
+	std::sort(vecSpan.begin(), vecSpan.end(), [](const HEXSPAN& lhs, const HEXSPAN& rhs) {
+		return lhs.ullOffset < rhs.ullOffset; });
+	VecHexSpan vecEdits;
+	for (const auto& hs : vecSpan) {
+		if (vecEdits.empty()) {
+			vecEdits.emplace_back(hs);
+			continue;
+		}
 
-bool CHexCtrl::IsDataSetImpl()const
-{
-	return m_fDataSet;
-}
+		auto& hsLast = vecEdits.back();
+		if (fInsert && hs.ullOffset == hsLast.ullOffset) {
+			hsLast.ullSize += hs.ullSize;
+		}
+		else if (!fInsert && hs.ullOffset <= hsLast.ullOffset + hsLast.ullSize) {
+			hsLast.ullSize = (std::max)(hsLast.ullSize, hs.ullOffset + hs.ullSize - hsLast.ullOffset);
+		}
+		else {
+			vecEdits.emplace_back(hs);
+		}
+	}
 
-bool CHexCtrl::IsDrawable()const
-{
-	return m_fRedraw;
-}
+	if (vecEdits.empty()) { ut::DBG_REPORT(L"Data to modify is empty."); return; }
+	if (const auto& hsLast = vecEdits.back(); (fInsert ? hsLast.ullOffset : hsLast.ullOffset + hsLast.ullSize)
+		> GetDataSizeImpl()) {
+		ut::DBG_REPORT(L"Span is out of the data bounds.");
+		return;
+	}
 
-bool CHexCtrl::IsMutableImpl()const
-{
-	return m_stData.fMutable;
-}
+	m_PieceTable.Snapshot();
 
-bool CHexCtrl::IsOffsetAsHexImpl()const
-{
-	return m_fOffsetHex;
-}
+	//Inserted bytes are the spnData repeated, the same as in the MODIFY_REPEAT mode. They are inserted chunk by chunk,
+	//of the cache size rounded to the spnData size. Edits go from the last one, so that the other offsets stay valid.
+	std::vector<std::byte> vecFill;
+	if (fInsert) {
+		const auto ullSizeData = static_cast<ULONGLONG>(hms.spnData.size());
+		vecFill.resize(static_cast<std::size_t>((std::max)(GetCacheSize() / ullSizeData, 1ULL) * ullSizeData));
+		for (std::size_t itFill = 0; itFill < vecFill.size(); itFill += hms.spnData.size()) {
+			std::copy_n(hms.spnData.data(), hms.spnData.size(), vecFill.data() + itFill);
+		}
+	}
 
-bool CHexCtrl::IsPageVisible()const
-{
-	return GetPageSizeImpl() > 0 && (GetPageSizeImpl() % GetCapacity() == 0) && GetPageSizeImpl() >= GetCapacity();
-}
+	for (auto it = vecEdits.rbegin(); it != vecEdits.rend(); ++it) {
+		if (!fInsert) {
+			m_PieceTable.Erase(it->ullOffset, it->ullSize);
+			continue;
+		}
 
-bool CHexCtrl::IsScrollCursor()const
-{
-	return m_fScrollCursor;
-}
+		for (auto ullSizeDone = 0ULL; ullSizeDone < it->ullSize; ullSizeDone += vecFill.size()) {
+			const auto ullSize = (std::min)(static_cast<ULONGLONG>(vecFill.size()), it->ullSize - ullSizeDone);
+			m_PieceTable.Insert(it->ullOffset + ullSizeDone, { vecFill.data(), static_cast<std::size_t>(ullSize) });
+		}
+	}
 
-bool CHexCtrl::IsVirtualImpl()const
-{
-	return m_stData.pHexVirtData != nullptr;
+	const ut::COffsetShift stShift(vecEdits, fInsert);
+	m_PieceTable.SetUndoShift(stShift);
+	ShiftOffsets(stShift);
+	OnModifyData();
 }
 
 void CHexCtrl::ModifyWorker(const HEXCTRL::HEXMODIFY& hms, const auto& FuncWorker, const HEXCTRL::SpanCByte spnOper)const
@@ -4101,8 +4391,68 @@ void CHexCtrl::ModifyWorker(const HEXCTRL::HEXMODIFY& hms, const auto& FuncWorke
 		dlgProg.OnCancel();
 		};
 
+	//Big modifications in the default data mode are done by all available cores.
+	//Spans are split into tiles of the cache size, aligned to the spnOper size, so that every tile
+	//is modified exactly as it would be by the sequential worker. Worker threads take tiles in order.
+	//Only for non-overlapping spans, in the default data mode, where GetData can be called concurrently.
+	const auto lmbModifyTiles = [&]() {
+		const auto ullSizeDataOper = static_cast<ULONGLONG>(spnOper.size());
+		const auto ullSizeTile = (std::max)(GetCacheSize() - (GetCacheSize() % ullSizeDataOper), ullSizeDataOper);
+		const auto ullDataSize = GetDataSizeImpl();
+		std::vector<HEXSPAN> vecTiles;
+		for (const auto& hs : vecSpan) {
+			if (ullSizeDataOper > hs.ullSize) //The same as in the sequential worker.
+				break;
+
+			const auto ullEnd = (std::min)(hs.ullOffset + hs.ullSize, ullDataSize);
+			for (auto ullOffset = hs.ullOffset; ullOffset + ullSizeDataOper <= ullEnd; ullOffset += ullSizeTile) {
+				vecTiles.emplace_back(ullOffset, (std::min)(ullSizeTile, ullEnd - ullOffset));
+			}
+		}
+
+		const auto dwThreads = static_cast<DWORD>((std::min)(static_cast<std::size_t>(
+			(std::max)(std::thread::hardware_concurrency(), 1U)), vecTiles.size()));
+		std::atomic<std::size_t> atomNext { 0 }; //Next tile to take.
+		std::atomic<ULONGLONG> atomDone { 0 };   //Bytes processed, for the progress dialog.
+		std::atomic<DWORD> atomWorkers { dwThreads }; //Workers still running.
+		const auto lmbWorker = [&]() {
+			for (auto uzTile = atomNext.fetch_add(1); uzTile < vecTiles.size() && !dlgProg.IsCanceled();
+				uzTile = atomNext.fetch_add(1)) {
+				const auto& hsTile = vecTiles[uzTile];
+				const auto spnData = GetData(hsTile);
+				assert(!spnData.empty());
+				for (auto ullIndex { 0ULL }; ullIndex + ullSizeDataOper <= hsTile.ullSize; ullIndex += ullSizeDataOper) {
+					FuncWorker(spnData.data() + ullIndex, hms, spnOper);
+				}
+				atomDone += hsTile.ullSize;
+			}
+			--atomWorkers;
+			};
+
+		std::vector<std::jthread> vecThreads;
+		vecThreads.reserve(dwThreads);
+		for (auto dwThread { 0U }; dwThread < dwThreads; ++dwThread) {
+			vecThreads.emplace_back(lmbWorker);
+		}
+
+		//Progress is published from this thread only, workers just sum it up.
+		while (atomWorkers.load() > 0) {
+			dlgProg.SetCurrent(vecSpan.back().ullOffset + atomDone.load());
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+		vecThreads.clear(); //Joining.
+		dlgProg.OnCancel();
+		};
+
 	constexpr auto uSizeToRunThread { 1024U * 1024U * 50U }; //50MB.
-	if (ullTotalSize > uSizeToRunThread) { //Spawning new thread only if data size is big enough.
+	if (ullTotalSize > uSizeToRunThread && !IsVirtualImpl() && std::ranges::adjacent_find(vecSpan,
+		[](const HEXSPAN& hsPrev, const HEXSPAN& hsNext) { return hsNext.ullOffset < hsPrev.ullOffset + hsPrev.ullSize; })
+		== vecSpan.end()) {
+		std::thread thrd(lmbModifyTiles);
+		dlgProg.DoModal(m_Wnd, m_hInstRes);
+		thrd.join();
+	}
+	else if (ullTotalSize > uSizeToRunThread) { //Spawning new thread only if data size is big enough.
 		std::thread thrd(lmbModify);
 		dlgProg.DoModal(m_Wnd, m_hInstRes);
 		thrd.join();
@@ -4133,6 +4483,7 @@ void CHexCtrl::OnCaretPosChange(ULONGLONG ullOffset)
 
 void CHexCtrl::OnModifyData()
 {
+	m_DlgSearch.InvalidateIndex();
 	ParentNotify(HEXCTRL_MSG_SETDATA);
 	m_DlgTemplMgr.UpdateData();
 	m_DlgDataInterp.UpdateData();
@@ -4378,44 +4729,22 @@ void CHexCtrl::RecalcClientArea(int iWidth, int iHeight)
 
 void CHexCtrl::Redo()
 {
-	if (m_vecRedo.empty())
-		return;
-
-	const auto& vecRedo = m_vecRedo.back();
-	VecHexSpan vecSpan;
-	vecSpan.reserve(vecRedo.size());
-	std::transform(vecRedo.begin(), vecRedo.end(), std::back_inserter(vecSpan), [](const UNDO& undo) {
-		return HEXSPAN { undo.ullOffset, undo.vecData.size() }; });
-	SnapshotUndo(vecSpan); //Creating new Undo data snapshot.
-
-	for (const auto& redo : vecRedo) {
-		const auto& vecRedoData = redo.vecData;
-
-		if (IsVirtualImpl() && vecRedoData.size() > GetCacheSize()) { //In VirtualData mode processing data chunk by chunk.
-			const auto dwSizeChunk = GetCacheSize();
-			const auto uzMod = vecRedoData.size() % dwSizeChunk;
-			auto ullChunks = vecRedoData.size() / dwSizeChunk + (uzMod > 0 ? 1 : 0);
-			std::size_t uzOffset = 0;
-			while (ullChunks-- > 0) {
-				const auto ullSize = (ullChunks == 1 && uzMod > 0) ? uzMod : dwSizeChunk;
-				if (const auto spnData = GetData({ uzOffset, ullSize }); !spnData.empty()) {
-					std::copy_n(vecRedoData.begin() + uzOffset, ullSize, spnData.data());
-					SetDataVirtual(spnData, { uzOffset, ullSize });
-				}
-				uzOffset += ullSize;
-			}
-		}
-		else {
-			if (const auto spnData = GetData({ redo.ullOffset, vecRedoData.size() }); !spnData.empty()) {
-				std::copy_n(vecRedoData.begin(), vecRedoData.size(), spnData.data());
-				SetDataVirtual(spnData, { redo.ullOffset, vecRedoData.size() });
+	m_DlgSearch.StopSearchJob(); //Its worker must not read the data being modified.
+	if (IsPieceTableImpl()) {
+		if (const auto optShift = m_PieceTable.Redo(); optShift) {
+			if (!optShift->IsEmpty()) {
+				ShiftOffsets(*optShift);
 			}
+			OnModifyData();
+			RedrawImpl();
 		}
+		return;
 	}
 
-	m_vecRedo.pop_back();
-	OnModifyData();
-	RedrawImpl();
+	if (m_Undo.Redo([this](CHexUndo::STEP& stStep) { return UndoApply(stStep); })) {
+		OnModifyData();
+		RedrawImpl();
+	}
 }
 
 void CHexCtrl::RedrawImpl() {
@@ -5051,6 +5380,11 @@ void CHexCtrl::SetDataVirtual(SpanByte spnData, const HEXSPAN& hss)const
 	//the SendMesage(parent, ...) is impossible here because receiver window
 	//must be run in the same thread as a sender.
 
+	if (IsPieceTableImpl()) {
+		m_PieceTable.Replace(hss.ullOffset, { spnData.data(), static_cast<std::size_t>(hss.ullSize) });
+		return;
+	}
+
 	if (!IsVirtualImpl())
 		return;
 
@@ -5163,58 +5497,138 @@ void CHexCtrl::SetUnprintableCharImpl(wchar_t wch, bool fRedraw)
 	if (fRedraw) { RedrawImpl(); }
 }
 
-void CHexCtrl::SnapshotUndo(SpanHexSpan spnHexSpan)
+void CHexCtrl::ShiftOffsets(const ut::COffsetShift& stShift)
 {
-	constexpr auto dwUndoMax { 512U }; //Undo's max limit.
-	const auto ullTotalSize = std::reduce(spnHexSpan.begin(), spnHexSpan.end(), 0ULL,
-		[](ULONGLONG ullSumm, const HEXSPAN& hs) { return ullSumm + hs.ullSize; });
-
-	//Check for very big undo size.
-	if (ullTotalSize > 1024 * 1024 * 10)
-		return;
+	m_DlgBkmMgr.ShiftOffsets(stShift);
+	m_DlgSearch.ShiftOffsets(stShift);
+	m_DlgTemplMgr.ShiftOffsets(stShift);
+	m_Selection.ClearAll();
+	const auto ullDataSize = GetDataSizeImpl();
+	m_ullCaretPos = ullDataSize > 0 ? (std::min)(stShift.Offset(m_ullCaretPos), ullDataSize - 1) : 0;
+	m_ullCursorPrev = m_ullCursorNow = m_ullCaretPos;
+	RecalcAll(); //Scroll sizes.
+}
 
-	//If Undo vec's size is exceeding Undo's max limit, remove first 64 snapshots (the oldest ones).
-	if (m_vecUndo.size() >= static_cast<std::size_t>(dwUndoMax)) {
-		const auto itFirst = m_vecUndo.begin();
-		const auto itLast = itFirst + 64U;
-		m_vecUndo.erase(itFirst, itLast);
+bool CHexCtrl::SnapshotUndo(const HEXMODIFY& hms)
+{
+	if (IsPieceTableImpl()) { //Undo snapshot is the piece table's current state, no data is copied.
+		m_PieceTable.Snapshot();
+		return true;
 	}
 
-	//Making new Undo data snapshot.
-	auto& vecUndo = m_vecUndo.emplace_back();
+	using enum EHexOperMode;
+	CHexUndo::STEP stStep;
+	if (hms.eModifyMode == EHexModifyMode::MODIFY_OPERATION && hms.eDataType != EHexDataType::DATA_FLOAT
+		&& hms.eDataType != EHexDataType::DATA_DOUBLE && (hms.eOperMode == OPER_XOR || hms.eOperMode == OPER_NOT
+			|| hms.eOperMode == OPER_BITREV || hms.eOperMode == OPER_SWAP)) {
+		//Self-inverse operation on integers, no data is taken at all, whatever the size.
+		stStep.optOper = CHexUndo::OPER { .vecSpan { hms.vecSpan }, .vecOperand { hms.spnData.begin(), hms.spnData.end() },
+			.eOperMode { hms.eOperMode }, .eDataType { hms.eDataType }, .fBigEndian { hms.fBigEndian } };
+		m_Undo.Push(std::move(stStep));
+		return true;
+	}
 
 	//Bad alloc may happen here!!!
+	bool fFile { false }; //The data doesn't fit into the Undo budget, it goes to the temporary file.
 	try {
-		for (const auto& hs : spnHexSpan) { //spnHexSpan.size() is the amount of continuous areas to preserve.
-			auto& undo = vecUndo.emplace_back(UNDO { hs.ullOffset, { } });
-			undo.vecData.resize(static_cast<std::size_t>(hs.ullSize));
-
-			//In VirtualData mode processing data chunk by chunk.
-			if (IsVirtualImpl() && hs.ullSize > GetCacheSize()) {
-				const auto dwSizeChunk = GetCacheSize();
-				const auto ullMod = hs.ullSize % dwSizeChunk;
-				auto ullChunks = hs.ullSize / dwSizeChunk + (ullMod > 0 ? 1 : 0);
-				ULONGLONG ullOffset { 0 };
-				while (ullChunks-- > 0) {
-					const auto ullSize = (ullChunks == 1 && ullMod > 0) ? ullMod : dwSizeChunk;
-					if (const auto spnData = GetData({ ullOffset, ullSize }); !spnData.empty()) {
-						std::copy_n(spnData.data(), ullSize, undo.vecData.data() + static_cast<std::size_t>(ullOffset));
-					}
-					ullOffset += ullSize;
-				}
-			}
-			else {
-				if (const auto spnData = GetData(hs); !spnData.empty()) {
-					std::copy_n(spnData.data(), hs.ullSize, undo.vecData.data());
-				}
+		auto ullBytes = 0ULL;
+		for (const auto& hs : hms.vecSpan) { //hms.vecSpan.size() is the amount of continuous areas to preserve.
+			auto optRec = UndoRecord(hs, m_Undo.GetBudget() - ullBytes);
+			if (!optRec) {
+				fFile = true;
+				break;
 			}
+
+			ullBytes += optRec->vecData.size();
+			stStep.vecRecords.emplace_back(std::move(*optRec));
 		}
 	}
 	catch (const std::bad_alloc&) {
-		m_vecUndo.clear();
-		m_vecRedo.clear();
-		return;
+		fFile = true;
+	}
+
+	if (fFile) {
+		stStep = { };
+		return SnapshotUndoFile(hms.vecSpan);
+	}
+
+	m_Undo.Push(std::move(stStep));
+	return true;
+}
+
+bool CHexCtrl::SnapshotUndoFile(SpanHexSpan spnHexSpan)
+{
+	//Records' data is swapped in place on Undo/Redo, so the spans are sorted and the overlapping ones are merged.
+	VecHexSpan vecSpan;
+	VecHexSpan vecSorted(spnHexSpan.begin(), spnHexSpan.end());
+	std::sort(vecSorted.begin(), vecSorted.end(), [](const HEXSPAN& lhs, const HEXSPAN& rhs) {
+		return lhs.ullOffset < rhs.ullOffset; });
+	for (const auto& hs : vecSorted) {
+		if (hs.ullSize == 0)
+			continue;
+
+		if (!vecSpan.empty() && hs.ullOffset <= vecSpan.back().ullOffset + vecSpan.back().ullSize) {
+			auto& hsLast = vecSpan.back();
+			hsLast.ullSize = (std::max)(hsLast.ullSize, hs.ullOffset + hs.ullSize - hsLast.ullOffset);
+		}
+		else {
+			vecSpan.emplace_back(hs);
+		}
+	}
+
+	const auto ullTotalSize = std::reduce(vecSpan.begin(), vecSpan.end(), 0ULL,
+		[](ULONGLONG ullSumm, const HEXSPAN& hs) { return ullSumm + hs.ullSize; });
+	CHexUndo::STEP stStep;
+	bool fFailed { false };
+	bool fCanceled { false };
+	CHexDlgProgress dlgProg(L"Saving Undo data...", L"", 0, ullTotalSize);
+	const auto lmbSave = [&]() {
+		const auto dwSizeChunk = GetCacheSize();
+		auto ullDone = 0ULL;
+		for (const auto& hs : vecSpan) {
+			const auto optFileOffset = m_Undo.FileReserve(hs.ullSize);
+			if (!optFileOffset) {
+				fFailed = true;
+				break;
+			}
+
+			stStep.vecRecords.emplace_back(CHexUndo::RECORD { .ullOffset { hs.ullOffset }, .ullSize { hs.ullSize },
+				.ullFileOffset { *optFileOffset }, .fFile { true } });
+			for (auto ullOffset = 0ULL; ullOffset < hs.ullSize && !fFailed && !dlgProg.IsCanceled(); ullOffset += dwSizeChunk) {
+				const auto ullSize = (std::min)(static_cast<ULONGLONG>(dwSizeChunk), hs.ullSize - ullOffset);
+				const auto spnData = GetData({ hs.ullOffset + ullOffset, ullSize });
+				fFailed = spnData.empty() || !m_Undo.FileWrite(*optFileOffset + ullOffset, spnData);
+				dlgProg.SetCurrent(ullDone += ullSize);
+			}
+
+			if (fFailed || dlgProg.IsCanceled())
+				break;
+		}
+		fCanceled = !fFailed && dlgProg.IsCanceled();
+		dlgProg.OnCancel();
+		};
+
+	constexpr auto uSizeToRunThread { 1024U * 1024U * 50U }; //50MB.
+	if (ullTotalSize > uSizeToRunThread) {
+		std::thread thrd(lmbSave);
+		dlgProg.DoModal(m_Wnd, m_hInstRes);
+		thrd.join();
+	}
+	else {
+		lmbSave();
+	}
+
+	if (fCanceled)
+		return false;
+
+	if (fFailed) { //Modification goes on, but it can't be undone, as well as anything before it.
+		ut::DBG_REPORT(L"Undo data can't be saved to the temporary file.");
+		m_Undo.Clear();
+		return true;
 	}
+
+	m_Undo.Push(std::move(stStep));
+	return true;
 }
 
 void CHexCtrl::TextChunkPoint(ULONGLONG ullOffset, int& iCx, int& iCy)const
@@ -5258,50 +5672,144 @@ void CHexCtrl::TTTrackShow(bool fShow, bool fTimer, const wchar_t* pwszText)
 
 void CHexCtrl::Undo()
 {
-	if (m_vecUndo.empty())
+	m_DlgSearch.StopSearchJob(); //Its worker must not read the data being modified.
+	if (IsPieceTableImpl()) {
+		if (const auto optShift = m_PieceTable.Undo(); optShift) {
+			if (!optShift->IsEmpty()) {
+				ShiftOffsets(*optShift);
+			}
+			OnModifyData();
+			RedrawImpl();
+		}
 		return;
+	}
 
-	//Bad alloc may happen here! If there is no more free memory, just clear the vec and return.
+	if (m_Undo.Undo([this](CHexUndo::STEP& stStep) { return UndoApply(stStep); })) {
+		OnModifyData();
+		RedrawImpl();
+	}
+}
+
+bool CHexCtrl::UndoApply(CHexUndo::STEP& stStep)
+{
+	if (stStep.optOper) { //Self-inverse operation is applied once again.
+		const auto& stOper = *stStep.optOper;
+		ModifyDataImpl({ .eModifyMode { EHexModifyMode::MODIFY_OPERATION }, .eOperMode { stOper.eOperMode },
+			.eDataType { stOper.eDataType }, .spnData { stOper.vecOperand }, .vecSpan { stOper.vecSpan },
+			.fBigEndian { stOper.fBigEndian } });
+		return true;
+	}
+
+	if (!stStep.vecRecords.empty() && stStep.vecRecords.front().fFile)
+		return UndoApplyFile(stStep);
+
+	//Current data is taken first, for all records, as the records' spans may overlap.
+	//Then the records' data is put back, and the current data takes the records' place, to be put back on the reverse.
+	std::vector<CHexUndo::RECORD> vecCurr;
 	try {
-		//Creating new Redo data snapshot.
-		auto& vecRedo = m_vecRedo.emplace_back();
-		for (const auto& undo : m_vecUndo.back()) {
-			auto& redo = vecRedo.emplace_back(UNDO { undo.ullOffset, { } });
-			redo.vecData.resize(undo.vecData.size());
-			const auto& vecUndoData = undo.vecData;
-
-			if (IsVirtualImpl() && vecUndoData.size() > GetCacheSize()) { //In VirtualData mode processing data chunk by chunk.
-				const auto dwSizeChunk = GetCacheSize();
-				const auto uzMod = vecUndoData.size() % dwSizeChunk;
-				auto ullChunks = vecUndoData.size() / dwSizeChunk + (uzMod > 0 ? 1 : 0);
-				std::size_t ullOffset = 0;
-				while (ullChunks-- > 0) {
-					const auto ullSize = (ullChunks == 1 && uzMod > 0) ? uzMod : dwSizeChunk;
-					if (const auto spnData = GetData({ ullOffset, ullSize }); !spnData.empty()) {
-						std::copy_n(spnData.data(), ullSize, redo.vecData.begin() + ullOffset); //Fill Redo with the data.
-						std::copy_n(vecUndoData.begin() + ullOffset, ullSize, spnData.data()); //Undo the data.
-						SetDataVirtual(spnData, { ullOffset, ullSize });
-					}
-					ullOffset += ullSize;
+		vecCurr.reserve(stStep.vecRecords.size());
+		for (const auto& stRec : stStep.vecRecords) {
+			auto optRec = UndoRecord({ stRec.ullOffset, stRec.ullSize }, (std::numeric_limits<ULONGLONG>::max)());
+			if (!optRec)
+				return false;
+
+			vecCurr.emplace_back(std::move(*optRec));
+		}
+	}
+	catch (const std::bad_alloc&) {
+		return false;
+	}
+
+	const auto dwSizeChunk = GetCacheSize();
+	for (const auto& stRec : stStep.vecRecords) {
+		for (auto ullOffset = 0ULL; ullOffset < stRec.ullSize; ullOffset += dwSizeChunk) {
+			const auto ullSize = (std::min)(static_cast<ULONGLONG>(dwSizeChunk), stRec.ullSize - ullOffset);
+			const HEXSPAN hs { stRec.ullOffset + ullOffset, ullSize };
+			if (const auto spnData = GetData(hs); !spnData.empty()) {
+				if (stRec.vecData.empty()) {
+					std::fill_n(spnData.data(), ullSize, stRec.bFill);
 				}
-			}
-			else {
-				if (const auto spnData = GetData({ undo.ullOffset, vecUndoData.size() }); !spnData.empty()) {
-					std::copy_n(spnData.data(), vecUndoData.size(), redo.vecData.begin()); //Fill Redo with the data.
-					std::copy_n(vecUndoData.begin(), vecUndoData.size(), spnData.data()); //Undo the data.
-					SetDataVirtual(spnData, { undo.ullOffset, vecUndoData.size() });
+				else {
+					std::copy_n(stRec.vecData.data() + ullOffset, ullSize, spnData.data());
 				}
+				SetDataVirtual(spnData, hs);
 			}
 		}
 	}
+	stStep.vecRecords = std::move(vecCurr);
+
+	return true;
+}
+
+bool CHexCtrl::UndoApplyFile(const CHexUndo::STEP& stStep)
+{
+	//Records' data in the file and the current data are swapped in place, chunk by chunk, so the records stay as is.
+	//It's not stopped by the Cancel button, the data would be left half swapped.
+	std::vector<std::byte> vecBuff;
+	try {
+		vecBuff.resize(GetCacheSize());
+	}
 	catch (const std::bad_alloc&) {
-		m_vecRedo.clear();
-		return;
+		return false;
+	}
+
+	const auto ullTotalSize = std::reduce(stStep.vecRecords.begin(), stStep.vecRecords.end(), 0ULL,
+		[](ULONGLONG ullSumm, const CHexUndo::RECORD& stRec) { return ullSumm + stRec.ullSize; });
+	bool fFailed { false };
+	CHexDlgProgress dlgProg(L"Restoring Undo data...", L"", 0, ullTotalSize);
+	const auto lmbSwap = [&]() {
+		auto ullDone = 0ULL;
+		for (const auto& stRec : stStep.vecRecords) {
+			for (auto ullOffset = 0ULL; ullOffset < stRec.ullSize && !fFailed; ullOffset += vecBuff.size()) {
+				const auto ullSize = (std::min)(static_cast<ULONGLONG>(vecBuff.size()), stRec.ullSize - ullOffset);
+				const HEXSPAN hs { stRec.ullOffset + ullOffset, ullSize };
+				const auto spnData = GetData(hs);
+				fFailed = spnData.empty() || !m_Undo.FileRead(stRec.ullFileOffset + ullOffset, { vecBuff.data(), spnData.size() })
+					|| !m_Undo.FileWrite(stRec.ullFileOffset + ullOffset, spnData);
+				if (!fFailed) {
+					std::copy_n(vecBuff.data(), spnData.size(), spnData.data());
+					SetDataVirtual(spnData, hs);
+				}
+				dlgProg.SetCurrent(ullDone += ullSize);
+			}
+		}
+		dlgProg.OnCancel();
+		};
+
+	constexpr auto uSizeToRunThread { 1024U * 1024U * 50U }; //50MB.
+	if (ullTotalSize > uSizeToRunThread) {
+		std::thread thrd(lmbSwap);
+		dlgProg.DoModal(m_Wnd, m_hInstRes);
+		thrd.join();
+	}
+	else {
+		lmbSwap();
 	}
 
-	m_vecUndo.pop_back();
-	OnModifyData();
-	RedrawImpl();
+	if (fFailed) {
+		ut::DBG_REPORT(L"Undo data can't be restored from the temporary file.");
+	}
+
+	return !fFailed;
+}
+
+auto CHexCtrl::UndoRecord(const HEXSPAN& hss, ULONGLONG ullBytesMax)const->std::optional<CHexUndo::RECORD>
+{
+	//Data of the span is taken chunk by chunk, std::nullopt if it can't be taken or it takes more than ullBytesMax.
+	CHexUndo::RECORD stRec { .ullOffset { hss.ullOffset } };
+	const auto dwSizeChunk = GetCacheSize();
+	for (auto ullOffset = 0ULL; ullOffset < hss.ullSize; ullOffset += dwSizeChunk) {
+		const auto ullSize = (std::min)(static_cast<ULONGLONG>(dwSizeChunk), hss.ullSize - ullOffset);
+		const auto spnData = GetData({ hss.ullOffset + ullOffset, ullSize });
+		if (spnData.empty())
+			return std::nullopt;
+
+		CHexUndo::RecordAppend(stRec, spnData);
+		if (stRec.vecData.size() > ullBytesMax)
+			return std::nullopt;
+	}
+
+	return stRec;
 }
 
 void CHexCtrl::UpdateDPIScale()
@@ -5390,8 +5898,7 @@ auto CHexCtrl::WMDestroy()->LRESULT
 	m_DlgTemplMgr.DestroyDlg();
 	m_DlgTemplMgr.UnloadAll(); //Templates could be loaded without creating the dialog itself.
 	m_vecKeyBind.clear();
-	m_vecUndo.clear();
-	m_vecRedo.clear();
+	m_Undo.Clear();
 	m_vecCharsWidth.clear();
 	m_umapMenuItems.clear();
 	m_MenuMain.DestroyMenu();
@@ -48,6 +48,7 @@ namespace HEXCTRL::INTERNAL {
 		void RemoveByID(ULONGLONG ullID)override;
 		void SetDlgProperties(std::uint64_t u64Flags);
 		void SetVirtualBkm(IHexVirtBookmarks* pVirtBkm)override;
+		void ShiftOffsets(const ut::COffsetShift& stShift); //Moves bookmarks along with the data, when its size changes.
 		void ShowWindow(int iCmdShow);
 		void Update(ULONGLONG ullID, const HEXBKM& bkm);
 	private:
@@ -383,6 +384,23 @@ void CHexDlgBkmMgr::SetVirtualBkm(IHexVirtBookmarks* pVirtBkm)
 	UpdateListCount();
 }
 
+void CHexDlgBkmMgr::ShiftOffsets(const ut::COffsetShift& stShift)
+{
+	if (IsVirtual()) //Virtual bookmarks are the client's responsibility.
+		return;
+
+	//Spans, all bytes of which were removed, are removed, and so are the bookmarks without spans.
+	for (auto& bkm : m_vecBookmarks) {
+		for (auto& hs : bkm.vecSpan) {
+			hs = stShift.Span(hs);
+		}
+		std::erase_if(bkm.vecSpan, [](const HEXSPAN& hs) { return hs.ullSize == 0; });
+	}
+	std::erase_if(m_vecBookmarks, [](const HEXBKM& bkm) { return bkm.vecSpan.empty(); });
+
+	UpdateListCount(true);
+}
+
 void CHexDlgBkmMgr::ShowWindow(int iCmdShow)
 {
 	if (!m_Wnd.IsWindow()) {
@@ -8,6 +8,7 @@ module;
 #include <SDKDDKVer.h>
 #include "res/HexCtrlRes.h"
 #include <Windows.h>
+#include <atomic>
 #include <cassert>
 #include <format>
 #include <string>
@@ -22,6 +23,7 @@ namespace HEXCTRL::INTERNAL {
 		explicit CHexDlgProgress(std::wstring_view wsvOperName, std::wstring_view wsvCountName,
 			ULONGLONG ullMin, ULONGLONG ullMax);
 		auto DoModal(HWND hWndParent, HINSTANCE hInstRes) -> INT_PTR;
+		[[nodiscard]] auto GetCurrent()const -> ULONGLONG;
 		[[nodiscard]] bool IsCanceled()const;
 		void OnCancel();
 		[[nodiscard]] auto ProcessMsg(const MSG& msg) -> INT_PTR;
@@ -44,11 +46,11 @@ namespace HEXCTRL::INTERNAL {
 		std::wstring m_wstrCountName; //Count name (e.g. Found, Replaced, etc...).
 		ULONGLONG m_ullMin { };       //Minimum data amount. 
 		ULONGLONG m_ullPrev { };      //Previous data in bytes.
-		ULONGLONG m_ullCurr { };      //Current data amount processed.
-		ULONGLONG m_ullMax { };       //Max data amount.
-		ULONGLONG m_ullThousands { }; //How many thousands in the whole data diapason.
-		ULONGLONG m_ullCount { };     //Count of found/replaced items.
-		bool m_fCancel { false };     //"Cancel" button pressed.
+		std::atomic<ULONGLONG> m_ullCurr { };  //Current data amount processed, set by the working thread.
+		ULONGLONG m_ullMax { };                //Max data amount.
+		ULONGLONG m_ullThousands { };          //How many thousands in the whole data diapason.
+		std::atomic<ULONGLONG> m_ullCount { }; //Count of found/replaced items, set by the working thread.
+		std::atomic<bool> m_fCancel { false }; //"Cancel" button pressed.
 	};
 }
 
@@ -63,14 +65,19 @@ auto CHexDlgProgress::DoModal(HWND hWndParent, HINSTANCE hInstRes)->INT_PTR {
 		hWndParent, GDIUT::DlgProc<CHexDlgProgress>, reinterpret_cast<LPARAM>(this));
 }
 
+auto CHexDlgProgress::GetCurrent()const->ULONGLONG
+{
+	return m_ullCurr.load(std::memory_order_relaxed);
+}
+
 bool CHexDlgProgress::IsCanceled()const
 {
-	return m_fCancel;
+	return m_fCancel.load(std::memory_order_relaxed);
 }
 
 void CHexDlgProgress::OnCancel()
 {
-	m_fCancel = true;
+	m_fCancel.store(true, std::memory_order_relaxed);
 }
 
 auto CHexDlgProgress::ProcessMsg(const MSG& msg)->INT_PTR
@@ -88,12 +95,12 @@ auto CHexDlgProgress::ProcessMsg(const MSG& msg)->INT_PTR
 
 void CHexDlgProgress::SetCount(ULONGLONG ullCount)
 {
-	m_ullCount = ullCount;
+	m_ullCount.store(ullCount, std::memory_order_relaxed);
 }
 
 void CHexDlgProgress::SetCurrent(ULONGLONG ullCurr)
 {
-	m_ullCurr = ullCurr;
+	m_ullCurr.store(ullCurr, std::memory_order_relaxed);
 }
 
 
@@ -158,13 +165,14 @@ auto CHexDlgProgress::WMTimer(const MSG& msg)->INT_PTR
 	if (msg.wParam != m_uIDTCancelCheck)
 		return FALSE;
 
-	if (m_fCancel) {
+	if (IsCanceled()) {
 		m_Wnd.KillTimer(m_uIDTCancelCheck);
 		m_Wnd.EndDialog(IDCANCEL);
 		return TRUE;
 	}
 
-	const auto ullCurr = m_ullCurr - m_ullMin;
+	const auto ullCurrAbs = GetCurrent();
+	const auto ullCurr = ullCurrAbs - m_ullMin;
 	const auto iPos = static_cast<int>(ullCurr / m_ullThousands); //How many thousandth parts have already been passed.
 	m_stProgBar.SetPos(iPos);
 
@@ -172,8 +180,8 @@ auto CHexDlgProgress::WMTimer(const MSG& msg)->INT_PTR
 	constexpr auto uBInMB { uBInKB * 1024U }; //Bytes in MB.
 	constexpr auto uBInGB { uBInMB * 1024U }; //Bytes in GB.
 	constexpr auto uTicksInSec = 1000U / m_uElapse;
-	const auto ullSpeedBS = (m_ullCurr - m_ullPrev) * uTicksInSec; //Speed in Bytes/s.
-	m_ullPrev = m_ullCurr;
+	const auto ullSpeedBS = (ullCurrAbs - m_ullPrev) * uTicksInSec; //Speed in Bytes/s.
+	m_ullPrev = ullCurrAbs;
 
 	std::wstring wstrDisplay;
 	if (ullSpeedBS < uBInMB) { //Less than 1 MB/s.
@@ -187,8 +195,8 @@ auto CHexDlgProgress::WMTimer(const MSG& msg)->INT_PTR
 	}
 	m_WndOper.SetWndText(wstrDisplay);
 
-	if (m_ullCount > 0) {
-		m_WndCount.SetWndText(std::format(ut::GetLocale(), L"{} {:L}", m_wstrCountName, m_ullCount));
+	if (const auto ullCount = m_ullCount.load(std::memory_order_relaxed); ullCount > 0) {
+		m_WndCount.SetWndText(std::format(ut::GetLocale(), L"{} {:L}", m_wstrCountName, ullCount));
 	}
 
 	return TRUE;
@@ -9,16 +9,28 @@ module;
 #include "../HexCtrl.h"
 #include "res/HexCtrlRes.h"
 #include <Windows.h>
+#include <ShObjIdl.h>
 #include <commctrl.h>
 #include <intrin.h>
 #include <algorithm>
+#include <atomic>
+#include <bitset>
 #include <cassert>
 #include <chrono>
+#include <cstring>
 #include <cwctype>
 #include <format>
+#include <fstream>
+#include <iterator>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <type_traits>
 export module HEXCTRL:CHexDlgSearch;
 
@@ -26,44 +38,121 @@ import :HexUtility;
 import :CHexDlgProgress;
 
 namespace HEXCTRL::INTERNAL {
+	//Sorted search results, the offsets are delta-encoded in blocks to store millions of them compactly.
+	class CSearchResults final {
+	public:
+		void Assign(const std::vector<ULONGLONG>& vecOffsets); //Offsets must be sorted.
+		void Clear();
+		[[nodiscard]] auto Find(ULONGLONG ullOffset)const -> std::optional<std::size_t>; //Index of the offset.
+		[[nodiscard]] auto GetAt(std::size_t uzIndex)const -> ULONGLONG;
+		[[nodiscard]] auto GetSize()const -> std::size_t;
+		auto Insert(ULONGLONG ullOffset) -> std::size_t; //Index of the inserted, or already existing, offset.
+		[[nodiscard]] bool IsEmpty()const;
+	private:
+		struct BLOCK {
+			std::vector<std::uint8_t> vecDeltas; //LEB128 encoded deltas of all offsets after the first one.
+			std::size_t uzIndex { };             //Index of the block's first offset among all offsets.
+			std::size_t uzCount { };             //Offsets in the block.
+			ULONGLONG   ullFirst { };
+			ULONGLONG   ullLast { };
+		};
+		[[nodiscard]] auto DecodeBlock(std::size_t uzBlock)const -> const std::vector<ULONGLONG>&;
+		[[nodiscard]] auto FindBlock(ULONGLONG ullOffset)const -> std::size_t; //Block the offset belongs to.
+		static void EncodeBlock(BLOCK& stBlock, std::span<const ULONGLONG> spnOffsets);
+		static void PushDelta(std::vector<std::uint8_t>& vecDeltas, ULONGLONG ullDelta);
+	private:
+		static constexpr auto m_uzBlockMax { 256U }; //Maximum offsets in a block.
+		static constexpr auto m_uzNoBlock { (std::numeric_limits<std::size_t>::max)() };
+		std::vector<BLOCK> m_vecBlocks;
+		std::size_t m_uzSize { };                      //All offsets.
+		mutable std::vector<ULONGLONG> m_vecCache;     //Offsets of the last decoded block.
+		mutable std::size_t m_uzCacheBlock { m_uzNoBlock };
+	};
+
+	//Array in the heap, or in the memory mapped temporary file if it's bigger than the m_uzHeapMax.
+	//Pages of the mapped file are paged in and out by the system, so big arrays don't take the process memory.
+	template<typename T>
+	class CMapArray final {
+	public:
+		explicit CMapArray(std::size_t uzSize); //Zero-filled, the span is empty if the array can't be allocated.
+		CMapArray(const CMapArray&) = delete;
+		CMapArray& operator=(const CMapArray&) = delete;
+		~CMapArray();
+		[[nodiscard]] auto GetSpan()const -> std::span<T>;
+	private:
+		static constexpr auto m_uzHeapMax { 64U * 1024U * 1024U };
+		std::vector<T> m_vecData; //Small arrays.
+		HANDLE m_hFile { INVALID_HANDLE_VALUE };
+		HANDLE m_hMap { };
+		T* m_pData { };
+		std::size_t m_uzSize { };
+	};
+
 	class CHexDlgSearch final {
 	public:
 		void ClearData();
 		void CreateDlg()const;
 		void DestroyDlg();
+		//Search index for the repeated searches, and suffix array for the FindAll, in the default data mode only.
+		void EnableIndex(bool fIndex, bool fSuffixArray);
 		[[nodiscard]] auto GetDlgItemHandle(EHexDlgItem eItem)const -> HWND;
 		[[nodiscard]] auto GetHWND()const -> HWND;
 		void Initialize(IHexCtrl &HexCtrl, HINSTANCE hInstRes);
+		void InvalidateIndex(); //Data was modified, the index and suffix array are rebuilt on the next search.
 		[[nodiscard]] bool IsSearchAvail()const; //Can we do search next/prev?
 		[[nodiscard]] bool PreTranslateMsg(MSG* pMsg);
 		[[nodiscard]] auto ProcessMsg(const MSG& msg) -> INT_PTR;
+		void PrepareSearch(const HEXSEARCH& hss); //Starts building the index that the hss search uses, HexCtrl's thread only.
+		auto Search(const HEXSEARCH& hss) -> ULONGLONG; //Search without the dialog, HexCtrl's thread only.
 		void SearchNextPrev(bool fForward);
+		//Search without the dialog, from any thread while the HexCtrl's thread is waiting for it to finish.
+		//The index is used as far as it's built, it's never built or replaced here.
+		[[nodiscard]] auto SearchWorker(const HEXSEARCH& hss)const -> ULONGLONG;
 		void SetDlgProperties(std::uint64_t u64Flags);
+		void ShiftOffsets(const ut::COffsetShift& stShift); //Moves found offsets along with the data, when its size changes.
 		void ShowWindow(int iCmdShow);
+		void StopSearchJob(); //Stops the background search, before the data it reads is modified or cleared.
 	private:
 		enum class ESearchMode : std::uint8_t; //Forward declarations.
-		enum class ESearchType : std::uint8_t;
 		enum class EMenuID : std::uint16_t;
 		struct SEARCHFUNCDATA;
 		struct FINDRESULT;
+		struct KERNELS;
+		struct MULTISEARCH;
+		struct MYERSSEARCH;
+		struct REGEXSEARCH;
+		struct REGEXPARSER;
+		struct TEXTFILTER;
+		struct SEARCHINDEX;
+		struct SEARCHJOB;
+		struct SUFFIXARRAY;
 		using PtrSearchFunc = auto(*)(const SEARCHFUNCDATA&)->FINDRESULT;
 		using VecSearchResult = std::vector<ULONGLONG>;
 
 		void AddToList(ULONGLONG ullOffset);
-		void CalcMemChunks(SEARCHFUNCDATA& sfd)const;
+		void BuildIndex(); //Starts building the index and suffix array in the background, if enabled and not built yet.
 		void ClearComboSearchType();
 		void ClearList();
 		void ComboFindFill(LPCWSTR pwsz);
 		void ComboReplaceFill(LPCWSTR pwsz);
+		[[nodiscard]] auto CreateHexSearch(bool fFwd)const -> HEXSEARCH; //HEXSEARCH from the dialog's current state.
 		[[nodiscard]] auto CreateSearchData(CHexDlgProgress* pDlgProg = nullptr)const -> SEARCHFUNCDATA;
+		void ExportResults(); //Export all found offsets to a text file.
 		void FindAll();
-		void FindForward();
-		void FindBackward();
+		//Up to dwLimit first exact matches from the suffix array, std::nullopt if it's not built or not applicable
+		//for the search. Progress goes to the sfd.pDlgProg, if any, and its cancel stops the lookup.
+		[[nodiscard]] auto FindAllSA(const SEARCHFUNCDATA& sfd, const HEXSEARCH& hss, DWORD dwLimit)const
+			-> std::optional<VecSearchResult>;
+		void FindForward(bool fWrap = false);  //fWrap: search from the beginning, after the end is reached.
+		void FindForwardDone(const FINDRESULT& findRes, bool fWrap);
+		void FindBackward(bool fWrap = false); //fWrap: search from the end, after the beginning is reached.
+		void FindBackwardDone(const FINDRESULT& findRes, bool fWrap);
 		[[nodiscard]] auto GetHexCtrl()const -> IHexCtrl*;
 		[[nodiscard]] auto GetLastSearchOffset()const -> ULONGLONG;
 		[[nodiscard]] auto GetRngStart()const -> ULONGLONG;
 		[[nodiscard]] auto GetRngEnd()const -> ULONGLONG;
 		[[nodiscard]] auto GetRngSize()const -> ULONGLONG;     //Size of the range to search within.
+		[[nodiscard]] auto GetResultSpans()const -> VecHexSpan; //All found occurrences, overlapping ones merged.
 		[[nodiscard]] auto GetReplaceDataSize()const -> DWORD; //Replace vec data size.
 		[[nodiscard]] auto GetReplaceSpan()const -> SpanCByte;
 		[[nodiscard]] auto GetSearchDataFrom()const -> SpanCByte;
@@ -71,13 +160,9 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] auto GetSearchDataSize()const -> DWORD;  //Search vec data size.
 		[[nodiscard]] auto GetSearchRngSize()const -> ULONGLONG;
 		[[nodiscard]] auto GetSearchFunc(bool fFwd, bool fDlgProg)const -> PtrSearchFunc;
-		template<bool fDlgProg, simd::EVecType eVecType>
-		[[nodiscard]] auto GetSearchFuncFwd()const -> PtrSearchFunc;
-		template<bool fDlgProg, simd::EVecType eVecType>
-		[[nodiscard]] auto GetSearchFuncBack()const -> PtrSearchFunc;
 		[[nodiscard]] auto GetSearchMode()const -> ESearchMode; //Get current search mode.
 		[[nodiscard]] auto GetSearchModePrev()const -> ESearchMode; //Get previous search mode.
-		[[nodiscard]] auto GetSearchType()const -> ESearchType; //Get current search type.
+		[[nodiscard]] auto GetSearchType()const -> EHexSearchType; //Get current search type.
 		[[nodiscard]] auto GetSentinel()const -> ULONGLONG;
 		[[nodiscard]] auto GetStartFrom()const -> ULONGLONG; //Start search from.
 		[[nodiscard]] auto GetStep()const -> ULONGLONG;
@@ -97,6 +182,7 @@ namespace HEXCTRL::INTERNAL {
 		void OnButtonSearchF();
 		void OnButtonSearchB();
 		void OnButtonFindAll();
+		void OnButtonPause();
 		void OnButtonReplace();
 		void OnButtonReplaceAll();
 		void OnCancel();
@@ -120,9 +206,18 @@ namespace HEXCTRL::INTERNAL {
 		void ReplaceAll();
 		void ResetSearch();
 		void Search();
+		void SearchDone(); //Replaces the found occurrence, if it's Replace, and shows the search results.
+		[[nodiscard]] auto SearchFuzzy(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const -> ULONGLONG; //Approximate search.
+		[[nodiscard]] auto SearchMulti(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const -> ULONGLONG; //Multi-pattern search.
+		[[nodiscard]] auto SearchRegex(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const -> ULONGLONG;  //Regex search.
+		//Search only within the blocks that the index can't rule out, sfd chunks must be already calculated.
+		[[nodiscard]] auto SearchIndexed(const SEARCHFUNCDATA& sfd, PtrSearchFunc pSearchFunc, const HEXSEARCH& hss)const -> FINDRESULT;
 		void SetEditStartFrom(ULONGLONG ullOffset); //Start search offset edit set.
+		//Starts the big search in the background, hss.eSearchMode is the job's mode.
+		void StartSearchJob(const SEARCHFUNCDATA& sfd, const HEXSEARCH& hss, bool fWrap);
 		void UpdateControlsState();
 		void UpdateCueBanners();
+		void UpdateSearchJob(); //Takes the background search results, finishes it when it's done.
 		void UpdateTTState();
 		auto WMActivate(const MSG& msg) -> INT_PTR;
 		auto WMClose() -> INT_PTR;
@@ -139,17 +234,21 @@ namespace HEXCTRL::INTERNAL {
 		void WMNotifyListItemChanged(NMHDR* pNMHDR);
 		void WMNotifyListRClick(NMHDR* pNMHDR);
 		void WMNotifyTT(NMHDR* pNMHDR);
+		auto WMTimer(const MSG& msg) -> INT_PTR;
 	private:
 		enum class EMemCmp : std::uint8_t {
 			DATA_INT8, DATA_UINT8, DATA_INT16, DATA_UINT16, DATA_INT32, DATA_UINT32,
 			DATA_INT64, DATA_UINT64, DATA_FLOAT, DATA_DOUBLE, DATA_ASCII, DATA_WCHAR
 		};
+		template<EMemCmp eMemCmp> //Numeric type of the DATA_INT8 - DATA_DOUBLE.
+		using TMemCmpNum = std::tuple_element_t<static_cast<std::size_t>(eMemCmp), std::tuple<std::int8_t, std::uint8_t,
+			std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float, double>>;
 		struct SEARCHTYPE { //Compile time struct for template parameters in the SearchFunc and MemCmp*.
 			constexpr SEARCHTYPE() = default;
 			constexpr SEARCHTYPE(EMemCmp eMemCmp, simd::EVecType eVecType, bool fDlgProg = false, bool fMatchCase = false,
-				bool fWildcard = false, bool fInverted = false) :
+				bool fWildcard = false, bool fInverted = false, bool fBigEndian = false) :
 				eMemCmp { eMemCmp }, eVecType { eVecType }, fDlgProg { fDlgProg }, fMatchCase { fMatchCase },
-				fWildcard { fWildcard }, fInverted { fInverted } { }
+				fWildcard { fWildcard }, fInverted { fInverted }, fBigEndian { fBigEndian } { }
 			constexpr ~SEARCHTYPE() = default;
 			EMemCmp eMemCmp { };
 			simd::EVecType eVecType { };
@@ -157,9 +256,36 @@ namespace HEXCTRL::INTERNAL {
 			bool fMatchCase { false };
 			bool fWildcard { false };
 			bool fInverted { false };
+			bool fBigEndian { false }; //Data is byte-swapped before comparison, numbers range only.
 		};
 
 		//Static functions.
+		static void CalcMemChunks(SEARCHFUNCDATA& sfd, bool fFwd = true);
+		//Aho-Corasick automaton from the patterns, for the multi-pattern search.
+		[[nodiscard]] static auto CreateMultiSearch(SpanSpanCByte spnPatterns, bool fMatchCase) -> std::optional<MULTISEARCH>;
+		//Anchored DFA from the regex, for the regex search.
+		[[nodiscard]] static auto CreateRegexSearch(SpanCByte spnRegex) -> std::optional<REGEXSEARCH>;
+		[[nodiscard]] static auto GetKernels() -> const KERNELS&; //Kernels of the CPU's vector tier, chosen once.
+		[[nodiscard]] static auto GetSearchFunc(const HEXSEARCH& hss, bool fDlgProg) -> PtrSearchFunc;
+		template<bool fDlgProg, simd::EVecType eVecType>
+		[[nodiscard]] static auto GetSearchFuncFwd(const HEXSEARCH& hss) -> PtrSearchFunc;
+		template<bool fDlgProg, simd::EVecType eVecType>
+		[[nodiscard]] static auto GetSearchFuncBack(const HEXSEARCH& hss) -> PtrSearchFunc;
+		template<bool fDlgProg, simd::EVecType eVecType, bool fFwd, bool fBigEndian>
+		[[nodiscard]] static auto GetSearchFuncRng(const HEXSEARCH& hss) -> PtrSearchFunc;
+		template<bool fDlgProg> //Forward search functions of the VECTOR_512 tier, the VECTOR_256 ones if there is none for the hss.
+		[[nodiscard]] static auto GetSearchFuncVec512(const HEXSEARCH& hss) -> PtrSearchFunc;
+		template<simd::EVecType eVecType>
+		[[nodiscard]] static auto MakeKernels() -> KERNELS;
+		[[nodiscard]] static constexpr bool IsVecStep(ULONGLONG ullStep) { //Steps for the vectorized step search.
+			return ullStep == 2 || ullStep == 4 || ullStep == 8 || ullStep == 16;
+		}
+		//Multi-threaded FindAll, search function must be the one without the progress dialog.
+		//Found offsets go to the pHexSearchRes in ascending order, returns their count.
+		static auto FindAllMT(const SEARCHFUNCDATA& sfd, PtrSearchFunc pSearchFunc, IHexSearchResult* pHexSearchRes,
+			DWORD dwLimit, DWORD dwThreads = 0) -> ULONGLONG;
+		template<SEARCHTYPE st> //Candidates filter for the vectorized text search functions.
+		[[nodiscard]] static auto MakeTextFilter(SpanCByte spnFind, std::byte bWildcard) -> TEXTFILTER;
 		template<SEARCHTYPE st> //For comparing numbers.
 		[[nodiscard]] static auto __forceinline MemCmpEQNum(const std::byte* pWhere, const std::byte* pWhat)->bool;
 		template<SEARCHTYPE st> //For comparing numbers ranges.
@@ -168,10 +294,22 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] static auto __forceinline MemCmpEQText(const std::byte* pWhere, const std::byte* pWhat,
 			std::size_t uzSize, std::byte bWildcard)->bool;
 		static void Replace(IHexCtrl* pHexCtrl, ULONGLONG ullIndex, SpanCByte spnReplace);
+		//Replace at all offsets at once, with only one Undo snapshot. Offsets must be sorted and not overlapped.
+		static void Replace(IHexCtrl* pHexCtrl, const VecSearchResult& vecOffsets, SpanCByte spnReplace);
+		//Edit distance search with the Myers' bit-vector algorithm.
+		[[nodiscard]] static auto SearchEditFwd(const HEXSEARCH& hss, IHexCtrl* pHexCtrl, ULONGLONG ullRngEnd) -> ULONGLONG;
+		template<simd::EVecType eVecType> //Hamming distance search.
+		[[nodiscard]] static auto SearchHammingFwd(const HEXSEARCH& hss, IHexCtrl* pHexCtrl, ULONGLONG ullRngEnd) -> ULONGLONG;
+		template<simd::EVecType eVecType>
+		[[nodiscard]] static auto SearchMultiFwd(const MULTISEARCH& stMulti, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+			ULONGLONG ullRngEnd) -> ULONGLONG;
 		template<SEARCHTYPE st>
 		[[nodiscard]] static auto SearchNumFwd(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
 		template<SEARCHTYPE st>
 		[[nodiscard]] static auto SearchNumRngFwd(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<simd::EVecType eVecType>
+		[[nodiscard]] static auto SearchRegexFwd(const REGEXSEARCH& stRegex, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+			ULONGLONG ullRngEnd) -> ULONGLONG;
 		template<SEARCHTYPE st>
 		[[nodiscard]] static auto SearchTextFwd(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
 		template<SEARCHTYPE st>
@@ -188,9 +326,25 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] static auto SearchFwdVec2(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
 		template<SEARCHTYPE st>
 		[[nodiscard]] static auto SearchFwdVec4(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For the data of any other size, with the first and the last bytes filter.
+		[[nodiscard]] static auto SearchFwdVecN(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For the case insensitive and wildcard texts.
+		[[nodiscard]] static auto SearchFwdVecText(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For numbers of any size, and texts of any kind.
+		[[nodiscard]] static auto SearchBackVec(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For data of 1, 2, 4, or 8 bytes with the IsVecStep steps.
+		[[nodiscard]] static auto SearchFwdVecStep(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For data of 1, 2, 4, or 8 bytes with the IsVecStep steps.
+		[[nodiscard]] static auto SearchBackVecStep(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For numbers range, with the step 1 and the IsVecStep steps.
+		[[nodiscard]] static auto SearchFwdVecRng(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
+		template<SEARCHTYPE st> //For numbers range, with the step 1 and the IsVecStep steps.
+		[[nodiscard]] static auto SearchBackVecRng(const SEARCHFUNCDATA& sfd) -> FINDRESULT;
 	private:
 		static constexpr auto m_uSearchSizeLimit { 256U }; //Search size limit.
 		static constexpr auto m_pwszWrongInput { L"Wrong input data format." };
+		static constexpr UINT_PTR m_uIDTSearchJob { 0x1 };
+		static constexpr auto m_uSearchJobElapse { 100U }; //Milliseconds between the background search updates.
 		HINSTANCE m_hInstRes { };
 		GDIUT::CWnd m_Wnd;                 //Main window.
 		GDIUT::CWnd m_WndStatResult;       //Static text "Result:".
@@ -204,6 +358,7 @@ namespace HEXCTRL::INTERNAL {
 		GDIUT::CWndBtn m_WndBtnInv;        //Check box "Inverted".
 		GDIUT::CWndBtn m_WndBtnBE;         //Check box "Big-endian".
 		GDIUT::CWndBtn m_WndBtnMC;         //Check box "Match case".
+		GDIUT::CWndBtn m_WndBtnPause;      //Button "Pause"/"Resume".
 		GDIUT::CWndEdit m_WndEditStart;    //Edit box "Start from".
 		GDIUT::CWndEdit m_WndEditStep;     //Edit box "Step".
 		GDIUT::CWndEdit m_WndEditRngBegin; //Edit box "Range begin".
@@ -212,7 +367,7 @@ namespace HEXCTRL::INTERNAL {
 		GDIUT::CWndEdit m_WndEditWC;       //Edit box "Wildcard".
 		GDIUT::CMenu m_MenuList;           //Menu for the list control.
 		LISTEX::CListEx m_ListEx;
-		VecSearchResult m_vecSearchRes; //Search results.
+		CSearchResults m_SearchRes;     //Search results.
 		//When it's in range search (e.g. -1:15) it's a data range start. In this case the size of the m_vecSearchDataFrom
 		//is always equal to the m_vecSearchDataTo. When it's a single search, it's just search data.
 		std::vector<std::byte> m_vecSearchDataFrom;
@@ -221,6 +376,9 @@ namespace HEXCTRL::INTERNAL {
 		std::wstring m_wstrSearch;      //Text from "Search" box.
 		std::wstring m_wstrReplace;     //Text from "Replace with..." box.
 		IHexCtrl* m_pHexCtrl { };
+		std::unique_ptr<SEARCHINDEX> m_pIndex; //Search index, built in the background.
+		std::unique_ptr<SUFFIXARRAY> m_pSuffixArray; //Suffix array, built in the background.
+		std::unique_ptr<SEARCHJOB> m_pSearchJob;     //Big search that goes on in the background.
 		std::uint64_t m_u64Flags { };   //Data from SetDlgProperties.
 		ULONGLONG m_ullStartFrom { };   //"Start form" search offset.
 		ULONGLONG m_ullRngBegin { };
@@ -240,6 +398,8 @@ namespace HEXCTRL::INTERNAL {
 		bool m_fSearchNext { false };   //Search through Next/Prev menu.
 		bool m_fFreshSearch { true };
 		bool m_fSearchNumRng { false }; //Search in numbers range (e.g. -1:15).
+		bool m_fIndex { false };        //Search index is enabled.
+		bool m_fSuffixArray { false };  //Suffix array is enabled.
 	};
 }
 
@@ -249,13 +409,9 @@ enum class CHexDlgSearch::ESearchMode : std::uint8_t {
 	MODE_HEXBYTES, MODE_TEXT, MODE_NUMBERS, MODE_STRUCTS
 };
 
-enum class CHexDlgSearch::ESearchType : std::uint8_t {
-	HEXBYTES, TEXT_ASCII, TEXT_UTF8, TEXT_UTF16, NUM_INT8, NUM_UINT8, NUM_INT16, NUM_UINT16,
-	NUM_INT32, NUM_UINT32, NUM_INT64, NUM_UINT64, NUM_FLOAT, NUM_DOUBLE, STRUCT_FILETIME
-};
-
 enum class CHexDlgSearch::EMenuID : std::uint16_t {
-	IDM_SEARCH_ADDBKM = 0x8000, IDM_SEARCH_SELECTALL, IDM_SEARCH_CLEARALL
+	IDM_SEARCH_ADDBKM = 0x8000, IDM_SEARCH_SELECTALL, IDM_SEARCH_CLEARALL, IDM_SEARCH_BKMALL, IDM_SEARCH_SELDATA,
+	IDM_SEARCH_MODIFYALL, IDM_SEARCH_EXPORT
 };
 
 struct CHexDlgSearch::FINDRESULT {
@@ -282,8 +438,609 @@ struct CHexDlgSearch::SEARCHFUNCDATA {
 	bool fInverted { }; //Vectorized functions use templated st.fInverted, non-vectorized use runtime fInverted.
 };
 
+struct CHexDlgSearch::KERNELS {
+	//Search kernels of one vector tier, and the getters of the search functions, [fDlgProg] indexed.
+	using PtrGetSearchFunc = auto(*)(const HEXSEARCH& hss)->PtrSearchFunc;
+	using PtrSearchHamming = auto(*)(const HEXSEARCH& hss, IHexCtrl* pHexCtrl, ULONGLONG ullRngEnd)->ULONGLONG;
+	using PtrSearchMulti = auto(*)(const MULTISEARCH& stMulti, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+		ULONGLONG ullRngEnd)->ULONGLONG;
+	using PtrSearchRegex = auto(*)(const REGEXSEARCH& stRegex, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+		ULONGLONG ullRngEnd)->ULONGLONG;
+	PtrGetSearchFunc arrGetFuncFwd[2] { };
+	PtrGetSearchFunc arrGetFuncBack[2] { };
+	PtrSearchHamming pSearchHamming { };
+	PtrSearchMulti pSearchMulti { };
+	PtrSearchRegex pSearchRegex { };
+};
+
+struct CHexDlgSearch::MULTISEARCH {
+	static constexpr auto u32FlagOut { 0x80000000U }; //Transition's flag: some patterns end in the target state.
+	std::vector<std::uint32_t> vecTrans;    //Transitions: [state * dwClasses + byte class] -> next state | u32FlagOut.
+	std::vector<std::uint32_t> vecOutIdx;   //Patterns ending in a state are in vecOutPatt[vecOutIdx[state]...vecOutIdx[state + 1]).
+	std::vector<DWORD> vecOutPatt;          //Patterns indexes.
+	std::vector<std::uint32_t> vecPattSize; //Patterns sizes.
+	simd::NIBBLESET stFirstBytes;           //Bytes that can start a pattern, to skip data while in the root state.
+	std::uint16_t arrClass[256] { };        //Byte to byte class, bytes that are not in any pattern are all of class 0.
+	DWORD dwClasses { };                    //Byte classes amount.
+	bool fPrefilter { };                    //Use the stFirstBytes to skip data.
+};
+
+struct CHexDlgSearch::MYERSSEARCH {
+	//Myers' bit-vector edit distance, in blocks of 64 pattern bytes: a column of the edit distance matrix
+	//is kept as its vertical deltas, +1 bits in the arrPv, and -1 bits in the arrMv.
+	static constexpr auto uWordsMax { m_uSearchSizeLimit / 64 };
+	void Advance(std::uint8_t u8Byte, int iHin); //Next column, iHin is the top row's delta: 0 to search, 1 to match from the start.
+	void Reset();
+	std::uint64_t arrPeq[256][uWordsMax] { }; //Bits of the pattern bytes equal to the byte.
+	std::uint64_t arrPv[uWordsMax] { };
+	std::uint64_t arrMv[uWordsMax] { };
+	std::uint64_t u64HighBit { }; //Bit of the last pattern byte in the last word.
+	std::uint32_t u32Words { };
+	std::uint32_t u32Size { };    //Pattern size.
+	int iScore { };               //Edit distance in the last row of the column.
+};
+
+struct CHexDlgSearch::REGEXSEARCH {
+	static constexpr auto u32FlagMatch { 0x80000000U }; //Transition's flag: the target state is a match.
+	std::vector<std::uint32_t> vecTrans; //Anchored DFA: [state * dwClasses + byte class] -> next state | u32FlagMatch.
+	std::vector<std::byte> vecPrefix;    //Literal bytes that every match starts with.
+	simd::NIBBLESET stFirstBytes;        //Bytes that can start a match, to skip data.
+	std::uint16_t arrClass[256] { };     //Byte to byte class, bytes of a class are not distinguished by the regex.
+	DWORD dwClasses { };                 //Byte classes amount.
+	DWORD dwMaxSize { };                 //Maximum match size.
+	std::uint32_t u32Start { };          //Start state, state 0 is the dead state.
+	bool fPrefilter { };                 //Use the stFirstBytes to skip data.
+};
+
+struct CHexDlgSearch::REGEXPARSER {
+	//Recursive descent parser of the byte regular expression into the tree of nodes, and then into the NFA:
+	//alternation := concatenation ('|' concatenation)*, concatenation := repetition*,
+	//repetition := atom ('*' | '+' | '?' | '{n}' | '{n,}' | '{n,m}')*, atom := (alternation) | [class] | . | \escape | byte.
+	enum class ENode : std::uint8_t { NODE_SET, NODE_CAT, NODE_ALT, NODE_REPEAT };
+	struct NODE {
+		std::bitset<256> bsSet;            //Bytes of the NODE_SET.
+		std::vector<std::uint32_t> vecSub; //Sub-nodes of the NODE_CAT, NODE_ALT, and NODE_REPEAT.
+		std::uint32_t u32Min { };          //Repetitions of the NODE_REPEAT.
+		std::uint32_t u32Max { };          //u32Inf for the unbounded repetitions.
+		ENode eNode { };
+	};
+	struct NFASTATE {
+		std::vector<std::uint32_t> vecEps; //Epsilon transitions.
+		std::uint32_t u32Node { u32None }; //NODE_SET node to match a byte with, u32None for the epsilon only states.
+		std::uint32_t u32Next { };         //Next state after the matched byte.
+	};
+	static constexpr auto u32Inf { 0xFFFFFFFFU };
+	static constexpr auto u32None { 0xFFFFFFFFU };
+	static constexpr auto u32RepeatMax { 256U };       //Maximum n and m in the {n,m}.
+	static constexpr auto uzNFAStatesMax { 0x10000U }; //Repetitions multiply the states.
+	[[nodiscard]] auto Compile(std::uint32_t u32Node, std::uint32_t u32Next) -> std::uint32_t; //NFA start state.
+	[[nodiscard]] auto GetSizeMinMax(std::uint32_t u32Node)const -> std::pair<ULONGLONG, ULONGLONG>;
+	[[nodiscard]] auto Parse() -> std::uint32_t; //Root node.
+	[[nodiscard]] auto ParseAlt() -> std::uint32_t;
+	[[nodiscard]] auto ParseAtom() -> std::uint32_t;
+	[[nodiscard]] auto ParseCat() -> std::uint32_t;
+	[[nodiscard]] auto ParseEscape() -> std::bitset<256>; //After the '\'.
+	[[nodiscard]] auto ParseNumber() -> std::uint32_t;
+	[[nodiscard]] auto ParseRepeat() -> std::uint32_t;
+	[[nodiscard]] bool IsEnd()const { return uzPos >= spnRegex.size(); }
+	[[nodiscard]] auto Peek()const -> char { return IsEnd() ? '\0' : static_cast<char>(spnRegex[uzPos]); }
+	auto AddNode(NODE&& stNode) -> std::uint32_t {
+		vecNodes.emplace_back(std::move(stNode));
+		return static_cast<std::uint32_t>(vecNodes.size() - 1);
+	}
+	SpanCByte spnRegex;
+	std::vector<NODE> vecNodes;
+	std::vector<NFASTATE> vecNFA;
+	std::size_t uzPos { };
+	bool fError { false };
+};
+
+struct CHexDlgSearch::TEXTFILTER {
+	std::byte    arrWCMask[m_uSearchSizeLimit] { }; //Wildcards mask, 0xFF for every byte of the wildcard char.
+	std::size_t  uzFirst { };   //The first byte that is not a wildcard.
+	std::size_t  uzLast { };    //The last byte that is not a wildcard.
+	std::uint8_t u8First { };   //Value of the uzFirst byte, lower-cased if it's not a Match-case search.
+	std::uint8_t u8Last { };    //Value of the uzLast byte, lower-cased if it's not a Match-case search.
+	bool         fAnyOffset { }; //Search data is all wildcards, and matches at any offset.
+};
+
+struct CHexDlgSearch::SEARCHINDEX {
+	//Every data block has a Bloom filter of the hashes of all 3-byte sequences (trigrams) that start within the block.
+	//Search data can't start within a block if any of its trigrams is missing in both, this and the next block's, filters.
+	static constexpr auto ullBlockSize { 1024ULL * 1024ULL }; //Must be bigger than the m_uSearchSizeLimit.
+	static constexpr auto u32HashBits { 17U };                //Filter of 2^17 bits, 16KB per block.
+	static constexpr std::size_t uzFilterWords { (1U << u32HashBits) / 64 };
+	[[nodiscard]] static constexpr auto Hash(const std::byte* pData) -> std::uint32_t {
+		const auto u32Trigram = std::to_integer<std::uint32_t>(pData[0]) | (std::to_integer<std::uint32_t>(pData[1]) << 8)
+			| (std::to_integer<std::uint32_t>(pData[2]) << 16);
+		return (u32Trigram * 0x9E3779B1U) >> (32 - u32HashBits); //Fibonacci hashing.
+	}
+	[[nodiscard]] bool IsCandidate(ULONGLONG ullBlock, std::span<const std::uint32_t> spnHashes)const {
+		const auto ullBuilt = atomBlocksBuilt.load(std::memory_order_acquire);
+		if (ullBlock >= ullBuilt || (ullBlock + 1 < ullBlocks && ullBlock + 1 >= ullBuilt))
+			return true; //Blocks that are not built yet can contain anything.
+
+		const auto pFilter = vecFilters.data() + ullBlock * uzFilterWords;
+		const auto pFilterNext = ullBlock + 1 < ullBlocks ? pFilter + uzFilterWords : pFilter;
+		return std::all_of(spnHashes.begin(), spnHashes.end(), [=](std::uint32_t u32Hash) {
+			return ((pFilter[u32Hash >> 6] | pFilterNext[u32Hash >> 6]) & (1ULL << (u32Hash & 63))) != 0; });
+	}
+	std::vector<std::uint64_t> vecFilters;      //Filters of all blocks: [block * uzFilterWords + word].
+	ULONGLONG ullBlocks { };                    //Blocks amount.
+	std::atomic<ULONGLONG> atomBlocksBuilt { }; //Blocks are built in order, this many are ready.
+	std::jthread thrdBuild;                     //Must be the last, to be joined before the filters are freed.
+};
+
+struct CHexDlgSearch::SEARCHJOB final : public IHexSearchResult {
+	//The big search goes on in the background, and the dialog takes its results on the timer, in the UI thread.
+	//In the default data mode it's the worker thread that reads the data, it posts the found offsets to the vecPending.
+	//The IHexVirtData is not required to be thread-safe, it's also called for painting, so in the Virtual mode
+	//the search goes on slice by slice on the timer itself. Found occurrences can be navigated meanwhile.
+	~SEARCHJOB() { Cancel(); } //The thrdWorker is joined right after.
+	bool OnHexSearchResult(std::span<const ULONGLONG> spnOffsets, [[maybe_unused]] std::span<const DWORD> spnPatterns)override {
+		{
+			const std::scoped_lock lock(mtxPending);
+			vecPending.insert(vecPending.end(), spnOffsets.begin(), spnOffsets.end());
+		}
+		atomPause.wait(true); //Paused worker waits here, and the other FindAllMT threads are soon waiting for it.
+		return !pDlgProg->IsCanceled();
+	}
+	void Cancel() {
+		if (pDlgProg) {
+			pDlgProg->OnCancel();
+		}
+		atomPause.store(false);
+		atomPause.notify_all();
+	}
+	std::vector<std::byte> vecFindFrom; //Copies of the search data, the dialog's ones can change meanwhile.
+	std::vector<std::byte> vecFindTo;
+	HEXSEARCH hss;                      //Its spans are the vecFindFrom and vecFindTo, eSearchMode is the job's mode.
+	SEARCHFUNCDATA sfd;                 //Its spans are the vecFindFrom and vecFindTo.
+	PtrSearchFunc pSearchFunc { };
+	FINDRESULT findRes;                 //Result of the SEARCH_FORWARD and SEARCH_BACKWARD jobs.
+	ULONGLONG ullStart { };             //Offset to search the next slice from.
+	ULONGLONG ullFirstOffset { };       //The first offset search can start from.
+	ULONGLONG ullLastOffset { };        //The last offset search can start from.
+	ULONGLONG ullTail { };              //Search data size - 1.
+	ULONGLONG ullSlice { };             //Offsets in one slice.
+	DWORD dwLimit { };
+	DWORD dwFound { };
+	bool fWrap { };                     //It's the search from the other end, after the first one found nothing.
+	bool fStopped { };                  //Stopped before it's done, SEARCH_FORWARD and SEARCH_BACKWARD are dropped then.
+	bool fDone { };
+	std::unique_ptr<CHexDlgProgress> pDlgProg; //Worker's progress and cancel, the dialog itself is never shown.
+	std::mutex mtxPending;
+	VecSearchResult vecPending;         //Offsets found by the worker, not yet taken by the dialog.
+	std::atomic<bool> atomPause;
+	std::atomic<bool> atomDone;         //The worker is done.
+	std::jthread thrdWorker;            //Must be the last, to be joined before the rest is freed.
+};
+
+struct CHexDlgSearch::SUFFIXARRAY {
+	//Offsets of all the data suffixes, in the lexicographical order of the suffixes. All occurrences of the
+	//search data are then the contiguous run of the suffixes that start with it, found by the binary search.
+	//Entries are 4 bytes for the data up to 2GB, and 8 bytes above. Big arrays, the suffix array itself and the build's
+	//working ones, are in the memory mapped temporary files, so the build takes a few hundred MB of memory at most.
+	static constexpr auto ullSize32Max { static_cast<ULONGLONG>((std::numeric_limits<std::int32_t>::max)()) - 1 };
+	template<typename TIdx>
+	struct STRDATA { //Data bytes as the [1, 256] values, with the unique 0 sentinel after the last byte.
+		SpanCByte spnData;
+		[[nodiscard]] auto operator()(TIdx iIndex)const -> TIdx {
+			return static_cast<std::size_t>(iIndex) == spnData.size() ? 0 : std::to_integer<TIdx>(spnData[iIndex]) + 1; }
+	};
+	template<typename TIdx>
+	struct STRREDUCED { //String of the LMS substrings' names, its last name is the unique 0 sentinel too.
+		std::span<const TIdx> spnStr;
+		[[nodiscard]] auto operator()(TIdx iIndex)const -> TIdx { return spnStr[iIndex]; }
+	};
+	//Str(i) values must be within the [0, iUpper], and the last one must be the unique 0 sentinel.
+	//The spnSA size is the string size, returns false if the build was stopped or failed.
+	template<typename TIdx, typename TStr>
+	[[nodiscard]] static bool SAIS(const TStr& Str, std::span<TIdx> spnSA, TIdx iUpper, std::stop_token stop);
+	//FuncFound(ULONGLONG ullOffset, ULONGLONG ullLeft) for every occurrence, in the suffixes order,
+	//ullLeft occurrences are after this one. FuncFound returns false to stop.
+	template<typename TFunc>
+	void Find(SpanCByte spnData, SpanCByte spnFind, const TFunc& FuncFound)const {
+		const auto lmbFind = [&](auto spnSA) {
+			using TIdx = std::remove_const_t<typename decltype(spnSA)::element_type>;
+			const auto lmbCmp = [spnData, spnFind](TIdx iSuff) { //Suffix's beginning compared to the spnFind.
+				const auto uzSizeSuff = spnData.size() - static_cast<std::size_t>(iSuff);
+				const auto iRes = std::memcmp(spnData.data() + static_cast<std::size_t>(iSuff), spnFind.data(),
+					(std::min)(uzSizeSuff, spnFind.size()));
+				return iRes != 0 ? iRes : (uzSizeSuff < spnFind.size() ? -1 : 0);
+				};
+			const auto spnSuff = spnSA.subspan(1); //The first suffix is the empty one, of the sentinel.
+			const auto itFirst = std::partition_point(spnSuff.begin(), spnSuff.end(), [&](TIdx iSuff) {
+				return lmbCmp(iSuff) < 0; });
+			const auto itLast = std::partition_point(itFirst, spnSuff.end(), [&](TIdx iSuff) {
+				return lmbCmp(iSuff) == 0; });
+			for (auto it = itFirst; it != itLast; ++it) {
+				if (!FuncFound(static_cast<ULONGLONG>(*it), static_cast<ULONGLONG>(itLast - it - 1)))
+					break;
+			}
+			};
+
+		if (optSA32) {
+			lmbFind(std::span<const std::int32_t> { optSA32->GetSpan() });
+		}
+		else if (optSA64) {
+			lmbFind(std::span<const std::int64_t> { optSA64->GetSpan() });
+		}
+	}
+	std::optional<CMapArray<std::int32_t>> optSA32; //Data up to the ullSize32Max.
+	std::optional<CMapArray<std::int64_t>> optSA64; //Bigger data.
+	std::atomic<bool> atomReady { };                //The suffix array is built.
+	std::jthread thrdBuild;                         //Must be the last, to be joined before the arrays are freed.
+};
+
+template<typename TIdx, typename TStr>
+bool CHexDlgSearch::SUFFIXARRAY::SAIS(const TStr& Str, std::span<TIdx> spnSA, TIdx iUpper, std::stop_token stop)
+{
+	//SA-IS: suffixes are of the S-type if they are smaller than the next suffix, or of the L-type otherwise.
+	//The leftmost S-type (LMS) suffixes are sorted first, by induced sorting of their LMS substrings, and recursively
+	//by the reduced string of the LMS substrings' names if names are not unique. All the other suffixes are
+	//then induced from the sorted LMS suffixes. The reduced string and its suffix array are kept in the spnSA
+	//itself, since there are at most half as many LMS suffixes as the string size.
+	const auto iSize = static_cast<TIdx>(spnSA.size());
+	if (iSize == 1) { //The sentinel only.
+		spnSA[0] = 0;
+		return true;
+	}
+
+	CMapArray<std::uint64_t> arrS((static_cast<std::size_t>(iSize) + 63) / 64); //Bits: suffix is of the S-type.
+	CMapArray<TIdx> arrBucket(static_cast<std::size_t>(iUpper) + 1);
+	const auto spnS = arrS.GetSpan();
+	const auto spnBucket = arrBucket.GetSpan();
+	if (spnS.empty() || spnBucket.empty()) {
+		ut::DBG_REPORT(L"Suffix array memory allocation failed.");
+		return false;
+	}
+
+	const auto lmbIsS = [spnS](TIdx iIndex) { return ((spnS[iIndex >> 6] >> (iIndex & 63)) & 1) != 0; };
+	const auto lmbIsLMS = [&lmbIsS](TIdx iIndex) { return iIndex > 0 && lmbIsS(iIndex) && !lmbIsS(iIndex - 1); };
+	spnS[(iSize - 1) >> 6] |= 1ULL << ((iSize - 1) & 63); //The sentinel is of the S-type.
+	for (auto i = iSize - 2; i >= 0; --i) {
+		const auto iCurr = Str(i);
+		const auto iNext = Str(i + 1);
+		if (iCurr < iNext || (iCurr == iNext && lmbIsS(i + 1))) {
+			spnS[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+
+	const auto lmbBuckets = [&](bool fEnd) { //Buckets' starts, or ends.
+		std::fill(spnBucket.begin(), spnBucket.end(), TIdx { 0 });
+		for (TIdx i = 0; i < iSize; ++i) {
+			++spnBucket[Str(i)];
+		}
+		TIdx iSum { 0 };
+		for (auto& refBucket : spnBucket) {
+			iSum += refBucket;
+			refBucket = fEnd ? iSum : iSum - refBucket;
+		}
+		};
+	const auto lmbInduce = [&]() { //L-type suffixes from left to right, then S-type ones from right to left.
+		lmbBuckets(false);
+		for (TIdx i = 0; i < iSize; ++i) {
+			if (const auto iPrev = spnSA[i] - 1; iPrev >= 0 && !lmbIsS(iPrev)) {
+				spnSA[spnBucket[Str(iPrev)]++] = iPrev;
+			}
+		}
+		lmbBuckets(true);
+		for (auto i = iSize - 1; i >= 0; --i) {
+			if (const auto iPrev = spnSA[i] - 1; iPrev >= 0 && lmbIsS(iPrev)) {
+				spnSA[--spnBucket[Str(iPrev)]] = iPrev;
+			}
+		}
+		};
+
+	//Sorting the LMS substrings.
+	lmbBuckets(true);
+	std::fill(spnSA.begin(), spnSA.end(), TIdx { -1 });
+	for (TIdx i = 1; i < iSize; ++i) {
+		if (lmbIsLMS(i)) {
+			spnSA[--spnBucket[Str(i)]] = i;
+		}
+	}
+	lmbInduce();
+	if (stop.stop_requested())
+		return false;
+
+	//Sorted LMS substrings are moved to the beginning, and named, equal substrings get equal names.
+	//Names are put at the [iLMS + i / 2], the LMS suffixes are at least two apart, so they don't collide.
+	TIdx iLMS { 0 };
+	for (TIdx i = 0; i < iSize; ++i) {
+		if (lmbIsLMS(spnSA[i])) {
+			spnSA[iLMS++] = spnSA[i];
+		}
+	}
+	std::fill(spnSA.begin() + iLMS, spnSA.end(), TIdx { -1 });
+	TIdx iNames { 0 };
+	TIdx iPrevLMS { -1 };
+	for (TIdx i = 0; i < iLMS; ++i) {
+		const auto iPos = spnSA[i];
+		auto fDiff = iPrevLMS == -1;
+		for (TIdx iOff = 0; !fDiff; ++iOff) { //The sentinel is unique, the loop always ends.
+			if (Str(iPos + iOff) != Str(iPrevLMS + iOff) || lmbIsS(iPos + iOff) != lmbIsS(iPrevLMS + iOff)) {
+				fDiff = true;
+			}
+			else if (iOff > 0 && (lmbIsLMS(iPos + iOff) || lmbIsLMS(iPrevLMS + iOff)))
+				break;
+		}
+		if (fDiff) {
+			++iNames;
+			iPrevLMS = iPos;
+		}
+		spnSA[iLMS + iPos / 2] = iNames - 1;
+	}
+	for (auto i = iSize - 1, j = iSize - 1; i >= iLMS; --i) { //The reduced string, at the end of the spnSA.
+		if (spnSA[i] >= 0) {
+			spnSA[j--] = spnSA[i];
+		}
+	}
+	if (stop.stop_requested())
+		return false;
+
+	//Sorting the LMS suffixes, by the reduced string's suffix array, at the beginning of the spnSA.
+	const auto spnSARed = spnSA.first(static_cast<std::size_t>(iLMS));
+	const auto spnStrRed = spnSA.last(static_cast<std::size_t>(iLMS));
+	if (iNames < iLMS) {
+		if (!SAIS<TIdx>(STRREDUCED<TIdx> { spnStrRed }, spnSARed, iNames - 1, stop))
+			return false;
+	}
+	else { //All names are unique, the reduced string is its own inverse suffix array.
+		for (TIdx i = 0; i < iLMS; ++i) {
+			spnSARed[spnStrRed[i]] = i;
+		}
+	}
+
+	//All the suffixes are induced from the sorted LMS ones.
+	for (TIdx i = 1, j = 0; i < iSize; ++i) {
+		if (lmbIsLMS(i)) {
+			spnStrRed[j++] = i;
+		}
+	}
+	for (TIdx i = 0; i < iLMS; ++i) {
+		spnSARed[i] = spnStrRed[spnSARed[i]];
+	}
+	std::fill(spnSA.begin() + iLMS, spnSA.end(), TIdx { -1 });
+	lmbBuckets(true);
+	for (auto i = iLMS - 1; i >= 0; --i) {
+		const auto iSuff = spnSA[i];
+		spnSA[i] = -1;
+		spnSA[--spnBucket[Str(iSuff)]] = iSuff;
+	}
+	lmbInduce();
+
+	return !stop.stop_requested();
+}
+
+template<typename T>
+CMapArray<T>::CMapArray(std::size_t uzSize)
+{
+	if (uzSize * sizeof(T) <= m_uzHeapMax) {
+		m_vecData.resize(uzSize);
+		m_pData = m_vecData.data();
+		m_uzSize = uzSize;
+		return;
+	}
+
+	wchar_t buffPath[MAX_PATH];
+	wchar_t buffName[MAX_PATH];
+	if (::GetTempPathW(MAX_PATH, buffPath) == 0 || ::GetTempFileNameW(buffPath, L"hex", 0, buffName) == 0) {
+		ut::DBG_REPORT(L"GetTempFileNameW failed.");
+		return;
+	}
+
+	m_hFile = ::CreateFileW(buffName, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+		FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+	if (m_hFile == INVALID_HANDLE_VALUE) {
+		::DeleteFileW(buffName);
+		ut::DBG_REPORT(L"CreateFileW failed.");
+		return;
+	}
+
+	//The file is extended to the mapping size and zero-filled by the system.
+	const auto ullBytes = static_cast<ULONGLONG>(uzSize) * sizeof(T);
+	m_hMap = ::CreateFileMappingW(m_hFile, nullptr, PAGE_READWRITE, static_cast<DWORD>(ullBytes >> 32),
+		static_cast<DWORD>(ullBytes), nullptr);
+	if (m_hMap == nullptr) {
+		ut::DBG_REPORT(L"CreateFileMappingW failed.");
+		return;
+	}
+
+	m_pData = static_cast<T*>(::MapViewOfFile(m_hMap, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, 0));
+	if (m_pData == nullptr) {
+		ut::DBG_REPORT(L"MapViewOfFile failed.");
+		return;
+	}
+
+	m_uzSize = uzSize;
+}
+
+template<typename T>
+CMapArray<T>::~CMapArray()
+{
+	if (m_pData != nullptr && m_vecData.empty()) {
+		::UnmapViewOfFile(m_pData);
+	}
+
+	if (m_hMap != nullptr) {
+		::CloseHandle(m_hMap);
+	}
+
+	if (m_hFile != INVALID_HANDLE_VALUE) {
+		::CloseHandle(m_hFile); //The file is deleted on close.
+	}
+}
+
+template<typename T>
+auto CMapArray<T>::GetSpan()const->std::span<T>
+{
+	return { m_pData, m_uzSize };
+}
+
+void CSearchResults::Assign(const std::vector<ULONGLONG>& vecOffsets)
+{
+	Clear();
+	for (const auto ullOffset : vecOffsets) {
+		Insert(ullOffset);
+	}
+}
+
+void CSearchResults::Clear()
+{
+	m_vecBlocks.clear();
+	m_vecCache.clear();
+	m_uzSize = 0;
+	m_uzCacheBlock = m_uzNoBlock;
+}
+
+auto CSearchResults::Find(ULONGLONG ullOffset)const->std::optional<std::size_t>
+{
+	if (IsEmpty())
+		return std::nullopt;
+
+	const auto uzBlock = FindBlock(ullOffset);
+	const auto& vecOffsets = DecodeBlock(uzBlock);
+	const auto it = std::lower_bound(vecOffsets.begin(), vecOffsets.end(), ullOffset);
+	if (it == vecOffsets.end() || *it != ullOffset)
+		return std::nullopt;
+
+	return m_vecBlocks[uzBlock].uzIndex + static_cast<std::size_t>(it - vecOffsets.begin());
+}
+
+auto CSearchResults::GetAt(std::size_t uzIndex)const->ULONGLONG
+{
+	assert(uzIndex < m_uzSize);
+	const auto itBlock = std::upper_bound(m_vecBlocks.begin(), m_vecBlocks.end(), uzIndex,
+		[](std::size_t uzIdx, const BLOCK& stBlock) { return uzIdx < stBlock.uzIndex; }) - 1;
+	return DecodeBlock(static_cast<std::size_t>(itBlock - m_vecBlocks.begin()))[uzIndex - itBlock->uzIndex];
+}
+
+auto CSearchResults::GetSize()const->std::size_t
+{
+	return m_uzSize;
+}
+
+auto CSearchResults::Insert(ULONGLONG ullOffset)->std::size_t
+{
+	if (IsEmpty() || ullOffset > m_vecBlocks.back().ullLast) { //Appending, as FindAll does.
+		if (IsEmpty() || m_vecBlocks.back().uzCount == m_uzBlockMax) {
+			m_vecBlocks.emplace_back(BLOCK { .uzIndex { m_uzSize }, .uzCount { 1 }, .ullFirst { ullOffset },
+				.ullLast { ullOffset } });
+		}
+		else {
+			auto& refBlock = m_vecBlocks.back();
+			PushDelta(refBlock.vecDeltas, ullOffset - refBlock.ullLast);
+			refBlock.ullLast = ullOffset;
+			++refBlock.uzCount;
+			if (m_uzCacheBlock == m_vecBlocks.size() - 1) {
+				m_vecCache.emplace_back(ullOffset);
+			}
+		}
+
+		return m_uzSize++;
+	}
+
+	const auto uzBlock = FindBlock(ullOffset);
+	auto vecOffsets = DecodeBlock(uzBlock);
+	const auto it = std::lower_bound(vecOffsets.begin(), vecOffsets.end(), ullOffset);
+	const auto uzIndex = m_vecBlocks[uzBlock].uzIndex + static_cast<std::size_t>(it - vecOffsets.begin());
+	if (it != vecOffsets.end() && *it == ullOffset)
+		return uzIndex; //Already exists.
+
+	vecOffsets.insert(it, ullOffset);
+	m_uzCacheBlock = m_uzNoBlock;
+	auto uzBlockNext = uzBlock + 1;
+	if (vecOffsets.size() > m_uzBlockMax) { //Splitting the block in two halves.
+		const auto uzHalf = vecOffsets.size() / 2;
+		BLOCK stBlockNew { .uzIndex { m_vecBlocks[uzBlock].uzIndex + uzHalf } };
+		EncodeBlock(stBlockNew, { vecOffsets.data() + uzHalf, vecOffsets.size() - uzHalf });
+		EncodeBlock(m_vecBlocks[uzBlock], { vecOffsets.data(), uzHalf });
+		m_vecBlocks.insert(m_vecBlocks.begin() + static_cast<std::ptrdiff_t>(uzBlockNext++), std::move(stBlockNew));
+	}
+	else {
+		EncodeBlock(m_vecBlocks[uzBlock], vecOffsets);
+	}
+
+	for (auto itBlock = m_vecBlocks.begin() + static_cast<std::ptrdiff_t>(uzBlockNext); itBlock != m_vecBlocks.end(); ++itBlock) {
+		++itBlock->uzIndex;
+	}
+	++m_uzSize;
+
+	return uzIndex;
+}
+
+bool CSearchResults::IsEmpty()const
+{
+	return m_uzSize == 0;
+}
+
+auto CSearchResults::DecodeBlock(std::size_t uzBlock)const->const std::vector<ULONGLONG>&
+{
+	if (uzBlock == m_uzCacheBlock)
+		return m_vecCache;
+
+	const auto& refBlock = m_vecBlocks[uzBlock];
+	m_vecCache.clear();
+	m_vecCache.reserve(refBlock.uzCount);
+	m_vecCache.emplace_back(refBlock.ullFirst);
+	auto ullOffset = refBlock.ullFirst;
+	ULONGLONG ullDelta { };
+	auto iShift { 0 };
+	for (const auto u8 : refBlock.vecDeltas) {
+		ullDelta |= static_cast<ULONGLONG>(u8 & 0x7FU) << iShift;
+		if ((u8 & 0x80U) != 0) {
+			iShift += 7;
+			continue;
+		}
+
+		ullOffset += ullDelta;
+		m_vecCache.emplace_back(ullOffset);
+		ullDelta = 0;
+		iShift = 0;
+	}
+	m_uzCacheBlock = uzBlock;
+
+	return m_vecCache;
+}
+
+void CSearchResults::EncodeBlock(BLOCK& stBlock, std::span<const ULONGLONG> spnOffsets)
+{
+	stBlock.vecDeltas.clear();
+	stBlock.uzCount = spnOffsets.size();
+	stBlock.ullFirst = spnOffsets.front();
+	stBlock.ullLast = spnOffsets.back();
+	for (std::size_t i = 1; i < spnOffsets.size(); ++i) {
+		PushDelta(stBlock.vecDeltas, spnOffsets[i] - spnOffsets[i - 1]);
+	}
+	stBlock.vecDeltas.shrink_to_fit();
+}
+
+auto CSearchResults::FindBlock(ULONGLONG ullOffset)const->std::size_t
+{
+	const auto itBlock = std::upper_bound(m_vecBlocks.begin(), m_vecBlocks.end(), ullOffset,
+		[](ULONGLONG ullOff, const BLOCK& stBlock) { return ullOff < stBlock.ullFirst; });
+	return itBlock == m_vecBlocks.begin() ? 0 : static_cast<std::size_t>(itBlock - m_vecBlocks.begin()) - 1;
+}
+
+void CSearchResults::PushDelta(std::vector<std::uint8_t>& vecDeltas, ULONGLONG ullDelta)
+{
+	while (ullDelta >= 0x80U) {
+		vecDeltas.emplace_back(static_cast<std::uint8_t>(ullDelta | 0x80U));
+		ullDelta >>= 7;
+	}
+	vecDeltas.emplace_back(static_cast<std::uint8_t>(ullDelta));
+}
+
 void CHexDlgSearch::ClearData()
 {
+	StopSearchJob();
+	m_pIndex.reset(); //Stops the index building, if it's in progress.
+	m_pSuffixArray.reset();
+	m_fIndex = false;
+	m_fSuffixArray = false;
+
 	if (!m_Wnd.IsWindow())
 		return;
 
@@ -307,6 +1064,16 @@ void CHexDlgSearch::DestroyDlg()
 	}
 }
 
+void CHexDlgSearch::EnableIndex(bool fIndex, bool fSuffixArray)
+{
+	StopSearchJob();
+	m_pIndex.reset();
+	m_pSuffixArray.reset();
+	m_fIndex = fIndex;
+	m_fSuffixArray = fSuffixArray;
+	BuildIndex();
+}
+
 auto CHexDlgSearch::GetDlgItemHandle(EHexDlgItem eItem)const->HWND
 {
 	if (!m_Wnd.IsWindow()) {
@@ -347,6 +1114,13 @@ void CHexDlgSearch::Initialize(IHexCtrl &HexCtrl, HINSTANCE hInstRes)
 	m_hInstRes = hInstRes;
 }
 
+void CHexDlgSearch::InvalidateIndex()
+{
+	StopSearchJob(); //Found offsets are not for the modified data.
+	m_pIndex.reset(); //Stops the index building, if it's in progress.
+	m_pSuffixArray.reset();
+}
+
 bool CHexDlgSearch::IsSearchAvail()const
 {
 	return m_Wnd.IsWindow() && GetHexCtrl()->IsDataSet();
@@ -370,11 +1144,25 @@ auto CHexDlgSearch::ProcessMsg(const MSG& msg)->INT_PTR
 	case WM_MEASUREITEM: return WMMeasureItem(msg);
 	case WM_MOUSEACTIVATE: return WMMouseActivate(msg);
 	case WM_NOTIFY: return WMNotify(msg);
+	case WM_TIMER: return WMTimer(msg);
 	default:
 		return 0;
 	}
 }
 
+void CHexDlgSearch::PrepareSearch(const HEXSEARCH& hss)
+{
+	if (hss.spnFindMulti.empty() && !hss.fRegex && hss.dwMaxErrors == 0) { //Only the exact search uses the index.
+		BuildIndex();
+	}
+}
+
+auto CHexDlgSearch::Search(const HEXSEARCH& hss)->ULONGLONG
+{
+	PrepareSearch(hss);
+	return SearchWorker(hss);
+}
+
 void CHexDlgSearch::SearchNextPrev(bool fForward)
 {
 	m_fForward = fForward;
@@ -384,85 +1172,273 @@ void CHexDlgSearch::SearchNextPrev(bool fForward)
 	Prepare();
 }
 
-void CHexDlgSearch::SetDlgProperties(std::uint64_t u64Flags)
+auto CHexDlgSearch::SearchWorker(const HEXSEARCH& hss)const->ULONGLONG
 {
-	m_u64Flags = u64Flags;
-}
+	const auto pHexCtrl = GetHexCtrl();
+	if (pHexCtrl == nullptr || !pHexCtrl->IsDataSet()) { ut::DBG_REPORT_NO_DATA_SET(); return { }; }
 
-void CHexDlgSearch::ShowWindow(int iCmdShow)
-{
-	if (!m_Wnd.IsWindow()) {
-		CreateDlg();
+	const auto fMulti = !hss.spnFindMulti.empty();
+	const auto uzSizeSearch = hss.spnFind.size();
+	if (!fMulti && (uzSizeSearch == 0 || uzSizeSearch > m_uSearchSizeLimit)) {
+		ut::DBG_REPORT(L"Search data size is wrong.");
+		return { };
 	}
 
-	m_Wnd.ShowWindow(iCmdShow);
-}
-
-
-//Private methods.
+	using enum EHexSearchType;
+	const auto eType = hss.eSearchType;
+	const auto fText = eType == TEXT_ASCII || eType == TEXT_UTF16;
+	const auto fNumRng = !hss.spnFindTo.empty();
+	if (fNumRng && (eType < NUM_INT8 || eType > NUM_DOUBLE || hss.spnFindTo.size() != uzSizeSearch)) {
+		ut::DBG_REPORT(L"Numbers range search data is wrong.");
+		return { };
+	}
 
-void CHexDlgSearch::AddToList(ULONGLONG ullOffset)
-{
-	int iHighlight { -1 };
-	if (const auto it = std::find(m_vecSearchRes.begin(), m_vecSearchRes.end(), ullOffset);
-		it == m_vecSearchRes.end()) { //Max-found search occurences.
-		if (m_vecSearchRes.size() < static_cast<std::size_t>(m_dwLimit)) {
-			m_vecSearchRes.emplace_back(ullOffset);
-			iHighlight = static_cast<int>(m_vecSearchRes.size());
-			m_ListEx.SetItemCountEx(iHighlight--);
-		}
+	if (hss.ullStep == 0) {
+		ut::DBG_REPORT(L"Search step is wrong.");
+		return { };
 	}
-	else {
-		iHighlight = static_cast<int>(it - m_vecSearchRes.begin());
+
+	const auto ullDataSize = pHexCtrl->GetDataSize();
+	const auto ullRngStart = hss.stRange.ullSize > 0 ? hss.stRange.ullOffset : 0ULL;
+	const auto ullRngEnd = hss.stRange.ullSize > 0 ? hss.stRange.ullOffset + hss.stRange.ullSize - 1 : ullDataSize - 1;
+	if (ullRngStart > ullRngEnd || ullRngEnd >= ullDataSize) {
+		ut::DBG_REPORT(L"Search range is out of data bounds.");
+		return { };
 	}
 
-	if (iHighlight != -1) {
-		m_ListEx.SetItemState(-1, 0, LVIS_SELECTED);
-		m_ListEx.SetItemState(iHighlight, LVIS_SELECTED, LVIS_SELECTED);
-		m_ListEx.EnsureVisible(iHighlight, true);
+	if (hss.ullStartFrom < ullRngStart || hss.ullStartFrom > ullRngEnd) {
+		ut::DBG_REPORT(L"Start offset is not within the search range.");
+		return { };
 	}
-}
 
-void CHexDlgSearch::CalcMemChunks(SEARCHFUNCDATA& sfd)const
-{
-	const auto uzSizeSearch = sfd.spnFindFrom.size();
-	if (sfd.ullStartFrom + uzSizeSearch > GetSentinel()) {
-		sfd.ullChunks = { };
-		sfd.ullChunkSize = { };
-		sfd.ullChunkMaxOffset = { };
-		return;
+	if (fMulti) {
+		return SearchMulti(hss, ullRngEnd);
 	}
 
-	const auto ullSizeTotal = GetSearchRngSize(); //Depends on search direction.
-	const auto pHexCtrl = sfd.pHexCtrl;
-	const auto ullStep = sfd.ullStep;
-	ULONGLONG ullChunks;
-	ULONGLONG ullChunkSize;
-	ULONGLONG ullChunkMaxOffset;
-	bool fBigStep { false };
+	if (hss.fRegex) {
+		return SearchRegex(hss, ullRngEnd);
+	}
 
-	if (!pHexCtrl->IsVirtual()) {
-		ullChunks = 1;
-		ullChunkSize = ullSizeTotal;
-		ullChunkMaxOffset = ullSizeTotal - uzSizeSearch;
+	if (hss.dwMaxErrors > 0) {
+		return SearchFuzzy(hss, ullRngEnd);
 	}
-	else {
-		ullChunkSize = (std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize()), ullSizeTotal);
-		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
-		if (ullStep > ullChunkMaxOffset) { //For very big steps.
-			ullChunks = ullSizeTotal > ullStep ? (ullSizeTotal / ullStep) + ((ullSizeTotal % ullStep) ? 1 : 0) : 1;
-			fBigStep = true;
+
+	//Kernels expect search data to be lowercase when case doesn't matter, the same way the dialog prepares it.
+	std::vector<std::byte> vecFind(hss.spnFind.begin(), hss.spnFind.end());
+	HEXSEARCH hssFunc = hss;
+	hssFunc.fMatchCase = !fText || hss.fMatchCase;
+	hssFunc.fWildcard = (fText || eType == HEXBYTES) && hss.fWildcard;
+	if (!hssFunc.fMatchCase) {
+		if (eType == TEXT_ASCII) {
+			std::transform(vecFind.begin(), vecFind.end(), vecFind.begin(), [](std::byte byte) {
+				const auto ch = static_cast<char>(byte);
+				return (ch >= 'A' && ch <= 'Z') ? static_cast<std::byte>(ch + 32) : byte; });
 		}
 		else {
-			ullChunks = ullSizeTotal > ullChunkMaxOffset ? (ullSizeTotal / ullChunkMaxOffset)
-				+ ((ullSizeTotal % ullChunkMaxOffset) ? 1 : 0) : 1;
+			const auto pWch = reinterpret_cast<wchar_t*>(vecFind.data());
+			std::transform(pWch, pWch + (vecFind.size() / sizeof(wchar_t)), pWch, [](wchar_t wch) {
+				return (wch >= L'A' && wch <= L'Z') ? static_cast<wchar_t>(wch + 32) : wch; });
 		}
 	}
-
-	sfd.ullChunks = ullChunks;
-	sfd.ullChunkSize = ullChunkSize;
-	sfd.ullChunkMaxOffset = ullChunkMaxOffset;
-	sfd.fBigStep = fBigStep;
+	hssFunc.spnFind = vecFind;
+
+	SEARCHFUNCDATA sfd { .ullStartFrom { hss.ullStartFrom }, .ullRngStart { ullRngStart }, .ullRngEnd { ullRngEnd },
+		.ullStep { hss.ullStep }, .pHexCtrl { pHexCtrl }, .spnFindFrom { vecFind }, .spnFindTo { hss.spnFindTo },
+		.bWildcard { hss.bWildcard }, .fInverted { hss.fInverted } };
+	const auto pSearchFunc = GetSearchFunc(hssFunc, false);
+	if (pSearchFunc == nullptr) {
+		ut::DBG_REPORT(L"Search type is wrong.");
+		return { };
+	}
+
+	if (hss.eSearchMode != EHexSearchMode::SEARCH_ALL) {
+		CalcMemChunks(sfd, hss.eSearchMode == EHexSearchMode::SEARCH_FORWARD);
+		const auto findRes = SearchIndexed(sfd, pSearchFunc, hssFunc);
+		if (!findRes)
+			return { };
+
+		if (hss.pHexSearchRes != nullptr) {
+			hss.pHexSearchRes->OnHexSearchResult({ &findRes.ullOffset, 1 }, { });
+		}
+
+		return 1;
+	}
+
+	//Results are delivered to the receiver in batches of this size.
+	constexpr auto uzSizeBatch { 1024U };
+	const auto dwLimit = hss.dwLimit > 0 ? hss.dwLimit : (std::numeric_limits<DWORD>::max)();
+	if (const auto optRes = FindAllSA(sfd, hssFunc, dwLimit); optRes) {
+		const std::span<const ULONGLONG> spnRes { *optRes };
+		if (hss.pHexSearchRes == nullptr)
+			return spnRes.size();
+
+		std::size_t uzCount { };
+		while (uzCount < spnRes.size()) {
+			const auto spnBatch = spnRes.subspan(uzCount, (std::min)(static_cast<std::size_t>(uzSizeBatch), spnRes.size() - uzCount));
+			uzCount += spnBatch.size();
+			if (!hss.pHexSearchRes->OnHexSearchResult(spnBatch, { }))
+				break;
+		}
+
+		return uzCount;
+	}
+
+	if (!pHexCtrl->IsVirtual() && hss.dwThreads != 1) {
+		return FindAllMT(sfd, pSearchFunc, hss.pHexSearchRes, dwLimit, hss.dwThreads);
+	}
+
+	VecSearchResult vecBatch;
+	vecBatch.reserve(uzSizeBatch);
+	const auto ullLastOffset = ullRngEnd + 1 - uzSizeSearch;
+	ULONGLONG ullCount { };
+	while (true) {
+		CalcMemChunks(sfd);
+		const auto findRes = pSearchFunc(sfd);
+		if (!findRes)
+			break;
+
+		++ullCount;
+		vecBatch.emplace_back(findRes.ullOffset);
+		if (vecBatch.size() == uzSizeBatch) {
+			if (hss.pHexSearchRes != nullptr && !hss.pHexSearchRes->OnHexSearchResult(vecBatch, { })) {
+				vecBatch.clear();
+				break;
+			}
+			vecBatch.clear();
+		}
+
+		const auto ullNext = findRes.ullOffset + hss.ullStep;
+		if (ullNext > ullLastOffset || ullCount >= dwLimit)
+			break;
+
+		sfd.ullStartFrom = ullNext;
+	}
+
+	if (hss.pHexSearchRes != nullptr && !vecBatch.empty()) {
+		hss.pHexSearchRes->OnHexSearchResult(vecBatch, { });
+	}
+
+	return ullCount;
+}
+
+void CHexDlgSearch::SetDlgProperties(std::uint64_t u64Flags)
+{
+	m_u64Flags = u64Flags;
+}
+
+void CHexDlgSearch::ShiftOffsets(const ut::COffsetShift& stShift)
+{
+	if (!m_Wnd.IsWindow())
+		return;
+
+	//Offsets keep their order, the ones whose byte was removed are dropped.
+	StopSearchJob();
+	VecSearchResult vecOffsets;
+	vecOffsets.reserve(m_SearchRes.GetSize());
+	for (std::size_t uzIndex = 0; uzIndex < m_SearchRes.GetSize(); ++uzIndex) {
+		if (const auto hs = stShift.Span({ m_SearchRes.GetAt(uzIndex), 1 }); hs.ullSize == 1) {
+			vecOffsets.emplace_back(hs.ullOffset);
+		}
+	}
+
+	m_SearchRes.Assign(vecOffsets);
+	m_ListEx.SetItemCountEx(static_cast<int>(m_SearchRes.GetSize()), LVSICF_NOSCROLL);
+	m_ullStartFrom = stShift.Offset(m_ullStartFrom);
+}
+
+void CHexDlgSearch::ShowWindow(int iCmdShow)
+{
+	if (!m_Wnd.IsWindow()) {
+		CreateDlg();
+	}
+
+	m_Wnd.ShowWindow(iCmdShow);
+}
+
+
+//Private methods.
+
+void CHexDlgSearch::AddToList(ULONGLONG ullOffset)
+{
+	int iHighlight { -1 };
+	if (const auto optIndex = m_SearchRes.Find(ullOffset); !optIndex) { //Max-found search occurences.
+		if (m_SearchRes.GetSize() < static_cast<std::size_t>(m_dwLimit)) {
+			iHighlight = static_cast<int>(m_SearchRes.Insert(ullOffset)); //Results are sorted by offsets.
+			m_ListEx.SetItemCountEx(static_cast<int>(m_SearchRes.GetSize()));
+		}
+	}
+	else {
+		iHighlight = static_cast<int>(*optIndex);
+	}
+
+	if (iHighlight != -1) {
+		m_ListEx.SetItemState(-1, 0, LVIS_SELECTED);
+		m_ListEx.SetItemState(iHighlight, LVIS_SELECTED, LVIS_SELECTED);
+		m_ListEx.EnsureVisible(iHighlight, true);
+	}
+}
+
+void CHexDlgSearch::BuildIndex()
+{
+	const auto pHexCtrl = GetHexCtrl();
+	if (pHexCtrl == nullptr || !pHexCtrl->IsDataSet() || pHexCtrl->IsVirtual())
+		return;
+
+	if (m_pSearchJob) //The background search's worker reads the index and suffix array as they are.
+		return;
+
+	const auto ullDataSize = pHexCtrl->GetDataSize();
+	const auto spnData = pHexCtrl->GetData({ 0, ullDataSize }); //The whole data, in the default data mode.
+
+	//Suffix array is only for the read-only data, that can't be modified while it's being built.
+	if (m_fSuffixArray && !m_pSuffixArray && !pHexCtrl->IsMutable()) {
+		m_pSuffixArray = std::make_unique<SUFFIXARRAY>();
+		const auto pSA = m_pSuffixArray.get();
+		pSA->thrdBuild = std::jthread([pSA, spnData](std::stop_token stop) {
+			const auto lmbBuild = [&]<typename TIdx>(std::optional<CMapArray<TIdx>>& optSA) {
+				const auto spnSA = optSA.emplace(spnData.size() + 1).GetSpan(); //Plus the sentinel's suffix.
+				if (spnSA.empty())
+					return;
+
+				if (SUFFIXARRAY::SAIS<TIdx>(SUFFIXARRAY::STRDATA<TIdx> { spnData }, spnSA, TIdx { 256 }, stop)) {
+					pSA->atomReady.store(true, std::memory_order_release);
+				}
+				};
+
+			if (spnData.size() <= SUFFIXARRAY::ullSize32Max) {
+				lmbBuild(pSA->optSA32);
+			}
+		#if defined(_WIN64) //The data above 2GB is only in the 64-bit processes.
+			else {
+				lmbBuild(pSA->optSA64);
+			}
+		#endif //^^^ _WIN64
+			});
+	}
+
+	if (!m_fIndex || m_pIndex || ullDataSize <= SEARCHINDEX::ullBlockSize) //Small data is searched fast enough without the index.
+		return;
+
+	m_pIndex = std::make_unique<SEARCHINDEX>();
+	const auto pIndex = m_pIndex.get();
+	pIndex->ullBlocks = (ullDataSize + SEARCHINDEX::ullBlockSize - 1) / SEARCHINDEX::ullBlockSize;
+	pIndex->vecFilters.resize(static_cast<std::size_t>(pIndex->ullBlocks) * SEARCHINDEX::uzFilterWords);
+	pIndex->thrdBuild = std::jthread([pIndex, spnData](std::stop_token stop) {
+		const auto ullLastTrigram = static_cast<ULONGLONG>(spnData.size() - 3); //The last offset a trigram can start at.
+		for (auto ullBlock = 0ULL; ullBlock < pIndex->ullBlocks; ++ullBlock) {
+			if (stop.stop_requested())
+				return;
+
+			const auto pFilter = pIndex->vecFilters.data() + ullBlock * SEARCHINDEX::uzFilterWords;
+			const auto ullFirst = ullBlock * SEARCHINDEX::ullBlockSize;
+			const auto ullLast = (std::min)(ullFirst + SEARCHINDEX::ullBlockSize - 1, ullLastTrigram);
+			for (auto ullOffset = ullFirst; ullOffset <= ullLast; ++ullOffset) {
+				const auto u32Hash = SEARCHINDEX::Hash(spnData.data() + ullOffset);
+				pFilter[u32Hash >> 6] |= 1ULL << (u32Hash & 63);
+			}
+			pIndex->atomBlocksBuilt.store(ullBlock + 1, std::memory_order_release);
+		}
+		});
 }
 
 void CHexDlgSearch::ClearComboSearchType()
@@ -476,8 +1452,9 @@ void CHexDlgSearch::ClearComboSearchType()
 
 void CHexDlgSearch::ClearList()
 {
+	StopSearchJob();
 	m_ListEx.SetItemCountEx(0);
-	m_vecSearchRes.clear();
+	m_SearchRes.Clear();
 }
 
 void CHexDlgSearch::ComboFindFill(LPCWSTR pwsz)
@@ -502,6 +1479,15 @@ void CHexDlgSearch::ComboReplaceFill(LPCWSTR pwsz)
 	}
 }
 
+auto CHexDlgSearch::CreateHexSearch(bool fFwd)const->HEXSEARCH
+{
+	return { .spnFind { GetSearchDataFrom() }, .spnFindTo { IsNumRangeSearch() ? GetSearchDataTo() : SpanCByte { } },
+		.stRange { GetRngStart(), GetRngSize() }, .ullStartFrom { GetStartFrom() }, .ullStep { GetStep() },
+		.dwLimit { m_dwLimit }, .eSearchMode { fFwd ? EHexSearchMode::SEARCH_FORWARD : EHexSearchMode::SEARCH_BACKWARD },
+		.eSearchType { GetSearchType() }, .bWildcard { GetWildcard() }, .fWildcard { IsWildcard() },
+		.fMatchCase { IsMatchCase() }, .fInverted { IsInverted() }, .fBigEndian { IsBigEndian() } };
+}
+
 auto CHexDlgSearch::CreateSearchData(CHexDlgProgress* pDlgProg)const->SEARCHFUNCDATA
 {
 	SEARCHFUNCDATA stData { .ullStartFrom { GetStartFrom() }, .ullRngStart { GetRngStart() },
@@ -510,158 +1496,239 @@ auto CHexDlgSearch::CreateSearchData(CHexDlgProgress* pDlgProg)const->SEARCHFUNC
 		.fInverted { IsInverted() }
 	};
 
-	CalcMemChunks(stData);
+	CalcMemChunks(stData, IsForward());
 
 	return stData;
 }
 
+void CHexDlgSearch::ExportResults()
+{
+	IFileSaveDialog* pIFSD { };
+	if (::CoCreateInstance(CLSID_FileSaveDialog, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&pIFSD)) != S_OK) {
+		ut::DBG_REPORT(L"CoCreateInstance failed.");
+		return;
+	}
+
+	DWORD dwFlags;
+	pIFSD->GetOptions(&dwFlags);
+	pIFSD->SetOptions(dwFlags | FOS_FORCEFILESYSTEM | FOS_OVERWRITEPROMPT | FOS_DONTADDTORECENT | FOS_PATHMUSTEXIST);
+	COMDLG_FILTERSPEC arrFilter[] { { .pszName { L"Text files (*.txt)" }, .pszSpec { L"*.txt" } },
+		{ .pszName { L"All files (*.*)" }, .pszSpec { L"*.*" } } };
+	pIFSD->SetFileTypes(2, arrFilter);
+	pIFSD->SetDefaultExtension(L"txt");
+	pIFSD->SetFileName(L"Offsets.txt");
+
+	IShellItem* pItem { };
+	if (pIFSD->Show(m_Wnd) != S_OK || pIFSD->GetResult(&pItem) != S_OK || pItem == nullptr) { //Cancel was pressed.
+		pIFSD->Release();
+		return;
+	}
+
+	wchar_t* pwszPath { };
+	pItem->GetDisplayName(SIGDN_FILESYSPATH, &pwszPath);
+	pItem->Release();
+	pIFSD->Release();
+	if (pwszPath == nullptr) {
+		ut::DBG_REPORT(L"pwszPath == nullptr");
+		return;
+	}
+
+	std::ofstream ofs(pwszPath, std::ios::binary);
+	::CoTaskMemFree(pwszPath);
+	if (!ofs) {
+		::MessageBoxW(m_Wnd, L"Unable to create the file.", L"Error", MB_ICONERROR);
+		return;
+	}
+
+	//Offsets are written as shown in the list, one per line, in portions, instead of a write for each offset.
+	const auto pHexCtrl = GetHexCtrl();
+	constexpr auto uzPortion { 1024U * 1024U };
+	std::string strOut;
+	strOut.reserve(uzPortion + 32);
+	for (std::size_t i { 0 }; i < m_SearchRes.GetSize(); ++i) {
+		std::format_to(std::back_inserter(strOut), "0x{:X}\r\n", pHexCtrl->GetOffset(m_SearchRes.GetAt(i), true));
+		if (strOut.size() >= uzPortion) {
+			ofs.write(strOut.data(), static_cast<std::streamsize>(strOut.size()));
+			strOut.clear();
+		}
+	}
+	ofs.write(strOut.data(), static_cast<std::streamsize>(strOut.size()));
+}
+
 void CHexDlgSearch::FindAll()
 {
 	ClearList(); //Clearing all results.
 	m_dwCount = 0;
-	const auto pSearchFunc = GetSearchFunc(true, !IsSmallSearch());
 	auto stFuncData = CreateSearchData();
+	auto hss = CreateHexSearch(true);
+	hss.eSearchMode = EHexSearchMode::SEARCH_ALL;
+	if (!IsSmallSearch()) { //Big search goes on in the background, results are shown as they're found.
+		StartSearchJob(stFuncData, hss, false);
+		return;
+	}
 
-	if (IsSmallSearch()) {
+	if (const auto optRes = FindAllSA(stFuncData, hss, m_dwLimit); optRes) {
+		m_SearchRes.Assign(*optRes);
+		if (!optRes->empty()) {
+			m_ullStartFrom = optRes->back() + GetStep();
+		}
+	}
+	else {
+		const auto pSearchFunc = GetSearchFunc(true, false);
 		auto lmbWrapper = [&]()mutable->FINDRESULT {
 			CalcMemChunks(stFuncData);
 			return pSearchFunc(stFuncData);
 			};
 
 		while (const auto findRes = lmbWrapper()) {
-			m_vecSearchRes.emplace_back(findRes.ullOffset); //Filling the vector of Found occurences.
+			m_SearchRes.Insert(findRes.ullOffset); //Filling the Found occurences.
 
 			const auto ullNext = findRes.ullOffset + GetStep();
-			if (ullNext > GetLastSearchOffset() || m_vecSearchRes.size() >= m_dwLimit)
+			if (ullNext > GetLastSearchOffset() || m_SearchRes.GetSize() >= m_dwLimit)
 				break;
 
 			m_ullStartFrom = stFuncData.ullStartFrom = ullNext;
 		}
 	}
-	else {
-		CHexDlgProgress dlgProg(L"Searching...", L"Found:", GetStartFrom(), GetLastSearchOffset());
-		stFuncData.pDlgProg = &dlgProg;
-		const auto lmbFindAllThread = [&]() {
-			auto lmbWrapper = [&]()mutable->FINDRESULT {
-				CalcMemChunks(stFuncData);
-				return pSearchFunc(stFuncData);
-				};
 
-			while (const auto findRes = lmbWrapper()) {
-				m_vecSearchRes.emplace_back(findRes.ullOffset); //Filling the vector of Found occurences.
-				dlgProg.SetCurrent(findRes.ullOffset);
-				dlgProg.SetCount(m_vecSearchRes.size());
+	if (!m_SearchRes.IsEmpty()) {
+		m_fFound = true;
+		m_dwCount = static_cast<DWORD>(m_SearchRes.GetSize());
+	}
 
-				const auto ullNext = findRes.ullOffset + GetStep();
-				if (ullNext > GetLastSearchOffset() || m_vecSearchRes.size() >= m_dwLimit
-					|| dlgProg.IsCanceled())
-					break;
+	m_ListEx.SetItemCountEx(static_cast<int>(m_SearchRes.GetSize()));
+	SearchDone();
+}
 
-				m_ullStartFrom = stFuncData.ullStartFrom = ullNext;
+auto CHexDlgSearch::FindAllSA(const SEARCHFUNCDATA& sfd, const HEXSEARCH& hss, DWORD dwLimit)const
+->std::optional<VecSearchResult>
+{
+	const auto pHexCtrl = GetHexCtrl();
+	if (!m_pSuffixArray || !m_pSuffixArray->atomReady.load(std::memory_order_acquire) || pHexCtrl->IsMutable()
+		|| pHexCtrl->IsVirtual())
+		return std::nullopt;
+
+	if (hss.fInverted || hss.fWildcard || !hss.fMatchCase || !hss.spnFindTo.empty())
+		return std::nullopt; //Only the exact matches can be looked up.
+
+	const auto spnFind = sfd.spnFindFrom;
+	if (sfd.ullStartFrom + spnFind.size() > sfd.ullRngEnd + 1)
+		return VecSearchResult { };
+
+	//Occurrences come in the suffixes order, not in the offsets order. Only the first dwLimit of them are needed,
+	//so they're kept in the max-heap of the dwLimit lowest offsets, and the memory doesn't grow with the occurrences.
+	const auto ullLastOffset = sfd.ullRngEnd + 1 - spnFind.size();
+	const auto pDlgProg = sfd.pDlgProg;
+	VecSearchResult vecRes;
+	ULONGLONG ullDone { };
+	m_pSuffixArray->Find(pHexCtrl->GetData({ 0, pHexCtrl->GetDataSize() }), spnFind, [&](ULONGLONG ullOffset, ULONGLONG ullLeft) {
+		if (ullOffset >= sfd.ullStartFrom && ullOffset <= ullLastOffset && (ullOffset - sfd.ullStartFrom) % sfd.ullStep == 0) {
+			if (vecRes.size() < dwLimit) {
+				vecRes.emplace_back(ullOffset);
+				std::push_heap(vecRes.begin(), vecRes.end());
 			}
-			dlgProg.OnCancel();
-			};
-		std::thread thrd(lmbFindAllThread);
-		dlgProg.DoModal(m_Wnd, m_hInstRes);
-		thrd.join();
-	}
+			else if (ullOffset < vecRes.front()) {
+				std::pop_heap(vecRes.begin(), vecRes.end());
+				vecRes.back() = ullOffset;
+				std::push_heap(vecRes.begin(), vecRes.end());
+			}
+		}
 
-	if (!m_vecSearchRes.empty()) {
-		m_fFound = true;
-		m_dwCount = static_cast<DWORD>(m_vecSearchRes.size());
-	}
+		constexpr auto ullProgMask { 0xFFFFULL }; //Progress is published every 64K occurrences.
+		if (pDlgProg == nullptr || (++ullDone & ullProgMask) != 0)
+			return true;
+
+		const auto dblDone = static_cast<double>(ullDone) / static_cast<double>(ullDone + ullLeft);
+		pDlgProg->SetCurrent(sfd.ullStartFrom + static_cast<ULONGLONG>(static_cast<double>(ullLastOffset - sfd.ullStartFrom) * dblDone));
+		pDlgProg->SetCount(vecRes.size());
+		return !pDlgProg->IsCanceled();
+		});
+	std::sort_heap(vecRes.begin(), vecRes.end());
 
-	m_ListEx.SetItemCountEx(static_cast<int>(m_vecSearchRes.size()));
+	return vecRes;
 }
 
-void CHexDlgSearch::FindForward()
+void CHexDlgSearch::FindForward(bool fWrap)
 {
-	FINDRESULT findRes;
-	const auto lmbFind = [&]() {
-		const auto pSearchFunc = GetSearchFunc(true, !IsSmallSearch());
-		auto stFuncData = CreateSearchData();
+	const auto stFuncData = CreateSearchData();
+	if (!IsSmallSearch()) { //Big search goes on in the background, the FindForwardDone is called when it's done.
+		StartSearchJob(stFuncData, CreateHexSearch(true), fWrap);
+		return;
+	}
+
+	FindForwardDone(SearchIndexed(stFuncData, GetSearchFunc(true, false), CreateHexSearch(true)), fWrap);
+}
 
-		if (IsSmallSearch()) {
-			findRes = pSearchFunc(stFuncData);
+void CHexDlgSearch::FindForwardDone(const FINDRESULT& findRes, bool fWrap)
+{
+	if (findRes) {
+		if (fWrap) {
+			m_fDoCount = true;
+			m_dwCount = 1;
 		}
 		else {
-			CHexDlgProgress dlgProg(L"Searching...", L"", GetStartFrom(), GetLastSearchOffset());
-			stFuncData.pDlgProg = &dlgProg;
-			const auto lmbWrapper = [&]() {
-				findRes = pSearchFunc(stFuncData);
-				dlgProg.OnCancel();
-				};
-			std::thread thrd(lmbWrapper);
-			dlgProg.DoModal(m_Wnd, m_hInstRes);
-			thrd.join();
+			m_fSecondMatch = true;
+			++m_dwCount;
 		}
-		};
-
-	if (lmbFind(); findRes) {
-		m_fSecondMatch = true;
-		++m_dwCount;
 		m_ullStartFrom = findRes.ullOffset;
 	}
-
-	if (!findRes) {
+	else if (!fWrap) {
 		m_iWrap = 1;
 		if (m_fSecondMatch && !findRes.fCanceled) {
 			m_ullStartFrom = GetRngStart(); //Starting from the beginning.
-			if (lmbFind(); findRes) {
-				m_fDoCount = true;
-				m_dwCount = 1;
-				m_ullStartFrom = findRes.ullOffset;
-			}
+			FindForward(true);
+			return;
 		}
 	}
+
 	m_fFound = findRes.fFound;
+	SearchDone();
 }
 
-void CHexDlgSearch::FindBackward()
+void CHexDlgSearch::FindBackward(bool fWrap)
 {
-	FINDRESULT findRes;
-	const auto lmbFind = [&]() {
-		const auto pSearchFunc = GetSearchFunc(false, !IsSmallSearch());
-		auto stFuncData = CreateSearchData();
+	if (!fWrap) {
+		const auto ullNext = m_ullStartFrom - GetStep();
+		if (!m_fSecondMatch || ullNext >= m_ullStartFrom || ullNext < GetRngStart()) {
+			FindBackwardDone({ }, false); //Nothing to search before, straight to the end.
+			return;
+		}
+		m_ullStartFrom = ullNext;
+	}
 
-		if (IsSmallSearch()) {
-			findRes = pSearchFunc(stFuncData);
+	const auto stFuncData = CreateSearchData();
+	if (!IsSmallSearch()) { //Big search goes on in the background, the FindBackwardDone is called when it's done.
+		StartSearchJob(stFuncData, CreateHexSearch(false), fWrap);
+		return;
+	}
+
+	FindBackwardDone(SearchIndexed(stFuncData, GetSearchFunc(false, false), CreateHexSearch(false)), fWrap);
+}
+
+void CHexDlgSearch::FindBackwardDone(const FINDRESULT& findRes, bool fWrap)
+{
+	if (findRes) {
+		if (fWrap) {
+			m_fSecondMatch = true;
+			m_fDoCount = false;
+			m_dwCount = 1;
 		}
 		else {
-			CHexDlgProgress dlgProg(L"Searching...", L"", GetRngStart(), GetStartFrom());
-			stFuncData.pDlgProg = &dlgProg;
-			const auto lmbWrapper = [&]() {
-				findRes = pSearchFunc(stFuncData);
-				dlgProg.OnCancel();
-				};
-			std::thread thrd(lmbWrapper);
-			dlgProg.DoModal(m_Wnd, m_hInstRes);
-			thrd.join();
-		}
-		};
-
-	const auto ullNext = m_ullStartFrom - GetStep();
-	if (m_fSecondMatch && ullNext < m_ullStartFrom && ullNext >= GetRngStart()) {
-		m_ullStartFrom = ullNext;
-		if (lmbFind(); findRes) {
 			--m_dwCount;
-			m_ullStartFrom = findRes.ullOffset;
 		}
+		m_ullStartFrom = findRes.ullOffset;
 	}
-
-	if (!findRes) {
+	else if (!fWrap) {
 		m_iWrap = -1;
 		if (!findRes.fCanceled) {
 			m_ullStartFrom = GetLastSearchOffset(); //Starting from the end.
-			if (lmbFind(); findRes) {
-				m_fSecondMatch = true;
-				m_fDoCount = false;
-				m_dwCount = 1;
-				m_ullStartFrom = findRes.ullOffset;
-			}
+			FindBackward(true);
+			return;
 		}
 	}
+
 	m_fFound = findRes.fFound;
+	SearchDone();
 }
 
 auto CHexDlgSearch::GetHexCtrl()const->IHexCtrl*
@@ -684,6 +1751,24 @@ auto CHexDlgSearch::GetReplaceDataSize()const->DWORD
 	return static_cast<DWORD>(m_vecReplaceData.size());
 }
 
+auto CHexDlgSearch::GetResultSpans()const->VecHexSpan
+{
+	//Overlapping and adjacent occurrences are merged, so that every byte is modified only once.
+	const ULONGLONG ullSize { m_fReplace ? GetReplaceDataSize() : GetSearchDataSize() };
+	VecHexSpan vecSpan;
+	for (std::size_t i { 0 }; i < m_SearchRes.GetSize(); ++i) {
+		const auto ullOffset = m_SearchRes.GetAt(i);
+		if (!vecSpan.empty() && vecSpan.back().ullOffset + vecSpan.back().ullSize >= ullOffset) {
+			vecSpan.back().ullSize = ullOffset + ullSize - vecSpan.back().ullOffset;
+		}
+		else {
+			vecSpan.emplace_back(ullOffset, ullSize);
+		}
+	}
+
+	return vecSpan;
+}
+
 auto CHexDlgSearch::GetRngStart()const->ULONGLONG
 {
 	return m_ullRngBegin;
@@ -716,254 +1801,43 @@ auto CHexDlgSearch::GetSearchDataSize()const->DWORD
 
 auto CHexDlgSearch::GetSearchFunc(bool fFwd, bool fDlgProg)const->PtrSearchFunc
 {
-	using enum simd::EVecType;
-	switch (simd::GetVectorType()) {
-	case VECTOR_128:
-		return fFwd ? (fDlgProg ? GetSearchFuncFwd<true, VECTOR_128>() : GetSearchFuncFwd<false, VECTOR_128>()) :
-			(fDlgProg ? GetSearchFuncBack<true, VECTOR_128>() : GetSearchFuncBack<false, VECTOR_128>());
-	case VECTOR_256:
-		return fFwd ? (fDlgProg ? GetSearchFuncFwd<true, VECTOR_256>() : GetSearchFuncFwd<false, VECTOR_256>()) :
-			(fDlgProg ? GetSearchFuncBack<true, VECTOR_256>() : GetSearchFuncBack<false, VECTOR_256>());
-	default: return nullptr;
-	}
+	return GetSearchFunc(CreateHexSearch(fFwd), fDlgProg);
 }
 
-template<bool fDlgProg, simd::EVecType eVecType>
-auto CHexDlgSearch::GetSearchFuncFwd()const->PtrSearchFunc
+auto CHexDlgSearch::GetSearchMode()const->CHexDlgSearch::ESearchMode
 {
-	//The `fDlgProg` arg ensures that no runtime check will be performed for the 
-	//'SEARCHFUNCDATA::pDlgProg == nullptr', at the hot path inside the SearchFunc function.
+	return static_cast<ESearchMode>(m_WndCmbMode.GetItemData(m_WndCmbMode.GetCurSel()));
+}
 
-	using enum ESearchType; using enum EMemCmp;
+auto CHexDlgSearch::GetSearchModePrev()const->ESearchMode
+{
+	return m_eSearchModePrev;
+}
 
-	if (IsNumRangeSearch()) { //Special case for search in numbers range (e.g. -1:15).
-		switch (GetSearchType()) {
-		case NUM_INT8: return SearchNumRngFwd<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg)>;
-		case NUM_UINT8: return SearchNumRngFwd<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
-		case NUM_INT16: return SearchNumRngFwd<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg)>;
-		case NUM_UINT16: return SearchNumRngFwd<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
-		case NUM_INT32: return SearchNumRngFwd<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg)>;
-		case NUM_UINT32: return SearchNumRngFwd<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
-		case NUM_INT64: return SearchNumRngFwd<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg)>;
-		case NUM_UINT64: return SearchNumRngFwd<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
-		case NUM_FLOAT: return SearchNumRngFwd<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg)>;
-		case NUM_DOUBLE: return SearchNumRngFwd<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg)>;
-		default:
-			assert(false); //Should never get here.
-			return nullptr;
-		}
-	}
+auto CHexDlgSearch::GetSearchRngSize()const->ULONGLONG
+{
+	return IsForward() ? GetSentinel() - GetStartFrom() :
+		(GetStartFrom() - GetRngStart()) + GetSearchDataSize();
+}
 
-	//If search step is 1 and data size is 1, 2, or 4 bytes, we can vectorize it for any search mode.
-	//Even for text. Except when it is a wildcard search, or if the Match-case is unchecked,
-	//which means that we must lower-case all search data beforehead.
-	if (GetStep() == 1 && !IsWildcard() && IsMatchCase()) {
-		switch (GetSearchDataSize()) {
-		case 1: //Special case for 1 byte data size SIMD.
-			return IsInverted() ?
-				SearchFwdVec1<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, true)> :
-				SearchFwdVec1<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false)>;
-		case 2: //Special case for 2 bytes data size SIMD.
-			return IsInverted() ?
-				SearchFwdVec2<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, true)> :
-				SearchFwdVec2<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false)>;
-		case 4: //Special case for 4 bytes data size SIMD.
-			return IsInverted() ?
-				SearchFwdVec4<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, true)> :
-				SearchFwdVec4<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false)>;
-		default:
-			break;
-		};
+auto CHexDlgSearch::GetSearchType()const->EHexSearchType
+{
+	if (GetSearchMode() == ESearchMode::MODE_HEXBYTES) {
+		return EHexSearchType::HEXBYTES;
 	}
 
-	switch (GetSearchType()) {
-	case HEXBYTES:
-		return IsWildcard() ?
-			SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
-			SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
-	case TEXT_ASCII:
-		if (IsMatchCase() && !IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
-		}
+	return static_cast<EHexSearchType>(m_WndCmbType.GetItemData(m_WndCmbType.GetCurSel()));
+}
 
-		if (IsMatchCase() && IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
-		}
+auto CHexDlgSearch::GetSentinel()const->ULONGLONG
+{
+	return m_ullRngEnd + 1; //This offset is non-dereferenceable.
+}
 
-		if (!IsMatchCase() && IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)>;
-		}
-
-		if (!IsMatchCase() && !IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
-		}
-		break;
-	case TEXT_UTF8:
-		//Search UTF-8 as plain chars, with Match-case=true.
-		return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
-	case TEXT_UTF16:
-		if (IsMatchCase() && !IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, false)>;
-		}
-
-		if (IsMatchCase() && IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)>;
-		}
-
-		if (!IsMatchCase() && IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)>;
-		}
-
-		if (!IsMatchCase() && !IsWildcard()) {
-			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
-		}
-		break;
-	//All numerics, including floats, are searched as plain unsigned data of respective size.
-	case NUM_INT8:
-	case NUM_UINT8:
-		return SearchNumFwd<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
-	case NUM_INT16:
-	case NUM_UINT16:
-		return SearchNumFwd<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
-	case NUM_INT32:
-	case NUM_UINT32:
-	case NUM_FLOAT:
-		return SearchNumFwd<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
-	case NUM_INT64:
-	case NUM_UINT64:
-	case NUM_DOUBLE:
-	case STRUCT_FILETIME:
-		return SearchNumFwd<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
-	default:
-		break;
-	}
-
-	return { };
-}
-
-template<bool fDlgProg, simd::EVecType eVecType>
-auto CHexDlgSearch::GetSearchFuncBack()const->PtrSearchFunc
-{
-	//The `fDlgProg` arg ensures that no runtime check will be performed for the 
-	//'SEARCHFUNCDATA::pDlgProg == nullptr', at the hot path inside the SearchFunc function.
-
-	using enum ESearchType; using enum EMemCmp;
-
-	if (IsNumRangeSearch()) { //Special case for search in numbers range (e.g. -1:15).
-		switch (GetSearchType()) {
-		case NUM_INT8: return SearchNumRngBack<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg)>;
-		case NUM_UINT8: return SearchNumRngBack<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
-		case NUM_INT16: return SearchNumRngBack<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg)>;
-		case NUM_UINT16: return SearchNumRngBack<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
-		case NUM_INT32: return SearchNumRngBack<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg)>;
-		case NUM_UINT32: return SearchNumRngBack<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
-		case NUM_INT64: return SearchNumRngBack<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg)>;
-		case NUM_UINT64: return SearchNumRngBack<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
-		case NUM_FLOAT: return SearchNumRngBack<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg)>;
-		case NUM_DOUBLE: return SearchNumRngBack<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg)>;
-		default:
-			assert(false); //Should never get here.
-			return nullptr;
-		}
-	}
-
-	switch (GetSearchType()) {
-	case HEXBYTES:
-		return IsWildcard() ?
-			SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
-			SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
-	case TEXT_ASCII:
-		if (IsMatchCase() && !IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
-		}
-
-		if (IsMatchCase() && IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
-		}
-
-		if (!IsMatchCase() && IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)>;
-		}
-
-		if (!IsMatchCase() && !IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
-		}
-		break;
-	case TEXT_UTF8:
-		return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>; //Search UTF-8 as plain chars.
-	case TEXT_UTF16:
-		if (IsMatchCase() && !IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, false)>;
-		}
-
-		if (IsMatchCase() && IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)>;
-		}
-
-		if (!IsMatchCase() && IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)>;
-		}
-
-		if (!IsMatchCase() && !IsWildcard()) {
-			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
-		}
-		break;
-	case NUM_INT8:
-	case NUM_UINT8:
-		return SearchNumBack<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
-	case NUM_INT16:
-	case NUM_UINT16:
-		return SearchNumBack<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
-	case NUM_INT32:
-	case NUM_UINT32:
-	case NUM_FLOAT:
-		return SearchNumBack<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
-	case NUM_INT64:
-	case NUM_UINT64:
-	case NUM_DOUBLE:
-	case STRUCT_FILETIME:
-		return SearchNumBack<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
-	default:
-		break;
-	}
-
-	return { };
-}
-
-auto CHexDlgSearch::GetSearchMode()const->CHexDlgSearch::ESearchMode
-{
-	return static_cast<ESearchMode>(m_WndCmbMode.GetItemData(m_WndCmbMode.GetCurSel()));
-}
-
-auto CHexDlgSearch::GetSearchModePrev()const->ESearchMode
-{
-	return m_eSearchModePrev;
-}
-
-auto CHexDlgSearch::GetSearchRngSize()const->ULONGLONG
-{
-	return IsForward() ? GetSentinel() - GetStartFrom() :
-		(GetStartFrom() - GetRngStart()) + GetSearchDataSize();
-}
-
-auto CHexDlgSearch::GetSearchType()const->ESearchType
-{
-	if (GetSearchMode() == ESearchMode::MODE_HEXBYTES) {
-		return ESearchType::HEXBYTES;
-	}
-
-	return static_cast<ESearchType>(m_WndCmbType.GetItemData(m_WndCmbType.GetCurSel()));
-}
-
-auto CHexDlgSearch::GetSentinel()const->ULONGLONG
-{
-	return m_ullRngEnd + 1; //This offset is non-dereferenceable.
-}
-
-auto CHexDlgSearch::GetStartFrom()const->ULONGLONG
-{
-	return m_ullStartFrom;
-}
+auto CHexDlgSearch::GetStartFrom()const->ULONGLONG
+{
+	return m_ullStartFrom;
+}
 
 auto CHexDlgSearch::GetStep()const->ULONGLONG
 {
@@ -1065,12 +1939,32 @@ void CHexDlgSearch::OnButtonSearchB()
 
 void CHexDlgSearch::OnButtonFindAll()
 {
+	if (m_pSearchJob) { //The button is "Cancel" while the search goes on in the background.
+		StopSearchJob();
+		return;
+	}
+
 	m_fForward = true;
 	m_fReplace = false;
 	m_fAll = true;
 	Prepare();
 }
 
+void CHexDlgSearch::OnButtonPause()
+{
+	if (!m_pSearchJob)
+		return;
+
+	auto& stJob = *m_pSearchJob;
+	const auto fPause = !stJob.atomPause.load();
+	stJob.atomPause.store(fPause);
+	if (!fPause) {
+		stJob.atomPause.notify_all(); //Worker waits in the OnHexSearchResult.
+	}
+	m_WndBtnPause.SetWndText(fPause ? L"Resume" : L"Pause");
+	UpdateSearchJob();
+}
+
 void CHexDlgSearch::OnButtonReplace()
 {
 	m_fForward = true;
@@ -1135,7 +2029,7 @@ void CHexDlgSearch::OnComboSearchModeNUMBERS()
 {
 	if (GetSearchMode() != GetSearchModePrev()) {
 		ClearComboSearchType();
-		using enum ESearchType;
+		using enum EHexSearchType;
 		auto iIndex = m_WndCmbType.AddString(L"int8");
 		m_WndCmbType.SetItemData(iIndex, static_cast<DWORD_PTR>(NUM_INT8));
 		m_WndCmbType.SetCurSel(iIndex);
@@ -1170,7 +2064,7 @@ void CHexDlgSearch::OnComboSearchModeSTRUCTS()
 {
 	if (GetSearchMode() != GetSearchModePrev()) {
 		ClearComboSearchType();
-		using enum ESearchType;
+		using enum EHexSearchType;
 		auto iIndex = m_WndCmbType.AddString(L"FILETIME");
 		m_WndCmbType.SetItemData(iIndex, static_cast<DWORD_PTR>(STRUCT_FILETIME));
 		m_WndCmbType.SetCurSel(iIndex);
@@ -1185,7 +2079,7 @@ void CHexDlgSearch::OnComboSearchModeSTRUCTS()
 
 void CHexDlgSearch::OnComboSearchModeTEXT()
 {
-	using enum ESearchType;
+	using enum EHexSearchType;
 
 	if (GetSearchMode() != GetSearchModePrev()) {
 		ClearComboSearchType();
@@ -1391,7 +2285,7 @@ void CHexDlgSearch::Prepare()
 		fSuccess = PrepareHexBytes();
 		break;
 	default:
-		using enum ESearchType;
+		using enum EHexSearchType;
 		switch (GetSearchType()) {
 		case TEXT_ASCII:
 			fSuccess = PrepareTextASCII();
@@ -1523,13 +2417,9 @@ bool CHexDlgSearch::PrepareNumbers()
 			return false;
 		}
 
-		T tDataFrom = (std::min)(*optDataFrom, *optDataTo);
-		T tDataTo = (std::max)(*optDataFrom, *optDataTo);
-
-		if (IsBigEndian()) {
-			tDataFrom = ut::ByteSwap(tDataFrom);
-			tDataTo = ut::ByteSwap(tDataTo);
-		}
+		//Range bounds are kept in the native byte order, it's the data that is swapped when compared, if big-endian.
+		const T tDataFrom = (std::min)(*optDataFrom, *optDataTo);
+		const T tDataTo = (std::max)(*optDataFrom, *optDataTo);
 		m_vecSearchDataFrom = ut::RangeToVecBytes(tDataFrom);
 		m_vecSearchDataTo = ut::RangeToVecBytes(tDataTo);
 
@@ -1609,6 +2499,7 @@ void CHexDlgSearch::ReplaceAll()
 	m_dwCount = 0;
 	m_dwReplaced = 0;
 
+	VecSearchResult vecReplaced; //Occurrences are not overlapped with the replace data, and replaced all at once.
 	if (IsSmallSearch()) {
 		const auto pSearchFunc = GetSearchFunc(true, false);
 		auto stFuncData = CreateSearchData();
@@ -1622,17 +2513,17 @@ void CHexDlgSearch::ReplaceAll()
 			if (findRes.ullOffset + dwSizeRepl > GetSentinel())
 				break;
 
-			Replace(stFuncData.pHexCtrl, findRes.ullOffset, GetReplaceSpan());
-			m_vecSearchRes.emplace_back(findRes.ullOffset); //Filling the vector of Found occurences.
+			vecReplaced.emplace_back(findRes.ullOffset); //Filling the vector of Found occurences.
 
 			const auto ullNext = findRes.ullOffset + (dwSizeRepl <= stFuncData.ullStep ?
 				stFuncData.ullStep : dwSizeRepl);
-			if (ullNext > GetLastSearchOffset() || m_vecSearchRes.size() >= m_dwLimit) {
+			if (ullNext > GetLastSearchOffset() || vecReplaced.size() >= m_dwLimit) {
 				break;
 			}
 
 			m_ullStartFrom = stFuncData.ullStartFrom = ullNext;
 		}
+		Replace(stFuncData.pHexCtrl, vecReplaced, GetReplaceSpan());
 	}
 	else {
 		const auto pSearchFunc = GetSearchFunc(true, true);
@@ -1649,20 +2540,20 @@ void CHexDlgSearch::ReplaceAll()
 				if (findRes.ullOffset + dwSizeRepl > GetSentinel())
 					break;
 
-				Replace(stFuncData.pHexCtrl, findRes.ullOffset, m_vecReplaceData);
-				m_vecSearchRes.emplace_back(findRes.ullOffset); //Filling the vector of Replaced occurences.
+				vecReplaced.emplace_back(findRes.ullOffset); //Filling the vector of Replaced occurences.
 				dlgProg.SetCurrent(findRes.ullOffset);
-				dlgProg.SetCount(m_vecSearchRes.size());
+				dlgProg.SetCount(vecReplaced.size());
 
 				const auto ullNext = findRes.ullOffset + (dwSizeRepl <= stFuncData.ullStep ?
 					stFuncData.ullStep : dwSizeRepl);
-				if (ullNext > GetLastSearchOffset() || m_vecSearchRes.size() >= m_dwLimit
+				if (ullNext > GetLastSearchOffset() || vecReplaced.size() >= m_dwLimit
 					|| dlgProg.IsCanceled()) {
 					break;
 				}
 
 				m_ullStartFrom = stFuncData.ullStartFrom = ullNext;
 			}
+			Replace(stFuncData.pHexCtrl, vecReplaced, m_vecReplaceData);
 			dlgProg.OnCancel();
 			};
 
@@ -1671,11 +2562,12 @@ void CHexDlgSearch::ReplaceAll()
 		thrd.join();
 	}
 
-	if (!m_vecSearchRes.empty()) {
+	m_SearchRes.Assign(vecReplaced);
+	if (!m_SearchRes.IsEmpty()) {
 		m_fFound = true;
-		m_dwCount = m_dwReplaced = static_cast<DWORD>(m_vecSearchRes.size());
+		m_dwCount = m_dwReplaced = static_cast<DWORD>(m_SearchRes.GetSize());
 	}
-	m_ListEx.SetItemCountEx(static_cast<int>(m_vecSearchRes.size()));
+	m_ListEx.SetItemCountEx(static_cast<int>(m_SearchRes.GetSize()));
 }
 
 void CHexDlgSearch::ResetSearch()
@@ -1696,26 +2588,26 @@ void CHexDlgSearch::ResetSearch()
 
 void CHexDlgSearch::Search()
 {
-	const auto pHexCtrl = GetHexCtrl();
+	StopSearchJob(); //Previous search, if it's still in progress.
 	m_fFound = false;
 
-	pHexCtrl->SetRedraw(false);
 	if (m_fReplace) {
 		if (m_fAll) { //Replace All
+			const auto pHexCtrl = GetHexCtrl();
+			pHexCtrl->SetRedraw(false);
 			ReplaceAll();
+			pHexCtrl->SetRedraw(true);
+			SearchDone();
 		}
-		else if (IsForward()) { //Forward only.
+		else if (IsForward()) { //Forward only, the found occurrence is replaced in the SearchDone.
 			FindForward();
-			if (m_fFound) {
-				const auto dwSizeRepl = GetReplaceDataSize();
-				if (GetStartFrom() + dwSizeRepl <= GetSentinel()) {
-					Replace(pHexCtrl, GetStartFrom(), GetReplaceSpan());
-					++m_dwReplaced;
-				}
-			}
+		}
+		else {
+			SearchDone();
 		}
 	}
 	else { //Search.
+		BuildIndex(); //Index is rebuilt here after the data modification, but not after every replace.
 		if (m_fAll) {
 			FindAll();
 		}
@@ -1729,7 +2621,25 @@ void CHexDlgSearch::Search()
 			}
 		}
 	}
-	pHexCtrl->SetRedraw(true);
+
+	if (!m_fSearchNext) {
+		m_Wnd.SetForegroundWindow();
+		m_Wnd.SetFocus();
+	}
+	else { m_fSearchNext = false; }
+}
+
+void CHexDlgSearch::SearchDone()
+{
+	if (m_fReplace && !m_fAll && m_fFound) {
+		if (const auto dwSizeRepl = GetReplaceDataSize(); GetStartFrom() + dwSizeRepl <= GetSentinel()) {
+			const auto pHexCtrl = GetHexCtrl();
+			pHexCtrl->SetRedraw(false);
+			Replace(pHexCtrl, GetStartFrom(), GetReplaceSpan());
+			pHexCtrl->SetRedraw(true);
+			++m_dwReplaced;
+		}
+	}
 
 	std::wstring wstrInfo;
 	if (m_fFound) {
@@ -1774,12 +2684,162 @@ void CHexDlgSearch::Search()
 		ResetSearch();
 	}
 	m_WndStatResult.SetWndText(wstrInfo);
+}
 
-	if (!m_fSearchNext) {
-		m_Wnd.SetForegroundWindow();
-		m_Wnd.SetFocus();
+auto CHexDlgSearch::SearchFuzzy(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const->ULONGLONG
+{
+	if (hss.eSearchMode == EHexSearchMode::SEARCH_BACKWARD || hss.fWildcard || hss.fInverted || !hss.spnFindTo.empty()) {
+		ut::DBG_REPORT(L"Approximate search is only for the SEARCH_FORWARD and SEARCH_ALL modes, without wildcard and inversion.");
+		return { };
 	}
-	else { m_fSearchNext = false; }
+
+	const auto ullSizeFind = static_cast<ULONGLONG>(hss.spnFind.size());
+	if (hss.dwMaxErrors >= ullSizeFind) {
+		ut::DBG_REPORT(L"Maximum errors must be less than the search data size.");
+		return { };
+	}
+
+	const auto pHexCtrl = GetHexCtrl();
+	if (pHexCtrl->IsVirtual() && pHexCtrl->GetCacheSize() < ullSizeFind + hss.dwMaxErrors * 3ULL) {
+		ut::DBG_REPORT(L"Cache size is too small for the approximate search.");
+		return { };
+	}
+
+	if (hss.fEditDist) {
+		return SearchEditFwd(hss, pHexCtrl, ullRngEnd);
+	}
+
+	return GetKernels().pSearchHamming(hss, pHexCtrl, ullRngEnd);
+}
+
+auto CHexDlgSearch::SearchMulti(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const->ULONGLONG
+{
+	if (hss.eSearchMode != EHexSearchMode::SEARCH_ALL || hss.fWildcard || hss.fInverted || !hss.spnFindTo.empty()) {
+		ut::DBG_REPORT(L"Multi-pattern search is only for the SEARCH_ALL mode, without wildcard and inversion.");
+		return { };
+	}
+
+	if (std::any_of(hss.spnFindMulti.begin(), hss.spnFindMulti.end(), [](SpanCByte spn) {
+		return spn.empty() || spn.size() > m_uSearchSizeLimit; })) {
+		ut::DBG_REPORT(L"Search data size is wrong.");
+		return { };
+	}
+
+	if (hss.spnFindMulti.size() > (std::numeric_limits<DWORD>::max)()) {
+		ut::DBG_REPORT(L"Too many patterns.");
+		return { };
+	}
+
+	const auto optMulti = CreateMultiSearch(hss.spnFindMulti, hss.eSearchType != EHexSearchType::TEXT_ASCII || hss.fMatchCase);
+	if (!optMulti)
+		return { };
+
+	return GetKernels().pSearchMulti(*optMulti, hss, GetHexCtrl(), ullRngEnd);
+}
+
+auto CHexDlgSearch::SearchRegex(const HEXSEARCH& hss, ULONGLONG ullRngEnd)const->ULONGLONG
+{
+	if (hss.eSearchMode == EHexSearchMode::SEARCH_BACKWARD || hss.fWildcard || hss.fInverted || !hss.spnFindTo.empty()) {
+		ut::DBG_REPORT(L"Regex search is only for the SEARCH_FORWARD and SEARCH_ALL modes, without wildcard and inversion.");
+		return { };
+	}
+
+	const auto optRegex = CreateRegexSearch(hss.spnFind);
+	if (!optRegex)
+		return { };
+
+	const auto pHexCtrl = GetHexCtrl();
+	if (pHexCtrl->IsVirtual() && pHexCtrl->GetCacheSize() < optRegex->dwMaxSize) {
+		ut::DBG_REPORT(L"Cache size is too small for the regex.");
+		return { };
+	}
+
+	return GetKernels().pSearchRegex(*optRegex, hss, pHexCtrl, ullRngEnd);
+}
+
+auto CHexDlgSearch::SearchIndexed(const SEARCHFUNCDATA& sfd, PtrSearchFunc pSearchFunc, const HEXSEARCH& hss)const->FINDRESULT
+{
+	//Runs of the candidate blocks are searched one by one, each run's start offset is kept on the step.
+	const auto pIndex = m_pIndex.get();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	if (pIndex == nullptr || sfd.ullChunks == 0 || uzSizeSearch < 3 || !sfd.spnFindTo.empty() || hss.fInverted
+		|| hss.fWildcard || !hss.fMatchCase) {
+		return pSearchFunc(sfd); //Data that the index can't tell anything about.
+	}
+
+	std::vector<std::uint32_t> vecHashes(uzSizeSearch - 2);
+	for (auto i = 0U; i < vecHashes.size(); ++i) {
+		vecHashes[i] = SEARCHINDEX::Hash(sfd.spnFindFrom.data() + i);
+	}
+
+	constexpr auto ullBlockSize = SEARCHINDEX::ullBlockSize;
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullStep = sfd.ullStep;
+	if (hss.eSearchMode != EHexSearchMode::SEARCH_BACKWARD) {
+		const auto ullLastOffset = sfd.ullRngEnd + 1 - uzSizeSearch; //The last offset search data can start at.
+		const auto ullBlockMax = ullLastOffset / ullBlockSize;
+		for (auto ullBlock = ullStartFrom / ullBlockSize; ullBlock <= ullBlockMax; ++ullBlock) {
+			if (!pIndex->IsCandidate(ullBlock, vecHashes))
+				continue;
+
+			auto ullBlockLast = ullBlock;
+			while (ullBlockLast < ullBlockMax && pIndex->IsCandidate(ullBlockLast + 1, vecHashes)) {
+				++ullBlockLast;
+			}
+
+			const auto ullRunFirst = ullBlock * ullBlockSize;
+			const auto ullFrom = ullRunFirst <= ullStartFrom ? ullStartFrom :
+				ullStartFrom + ((ullRunFirst - ullStartFrom + ullStep - 1) / ullStep) * ullStep;
+			const auto ullTo = (std::min)((ullBlockLast + 1) * ullBlockSize - 1, ullLastOffset);
+			ullBlock = ullBlockLast;
+			if (ullFrom > ullTo)
+				continue;
+
+			auto sfdRun = sfd;
+			sfdRun.ullStartFrom = ullFrom;
+			sfdRun.ullRngEnd = ullTo + uzSizeSearch - 1;
+			CalcMemChunks(sfdRun, true);
+			if (const auto findRes = pSearchFunc(sfdRun); findRes || findRes.fCanceled) {
+				return findRes;
+			}
+		}
+	}
+	else {
+		const auto ullRngStart = sfd.ullRngStart;
+		const auto ullBlockMin = ullRngStart / ullBlockSize;
+		for (auto ullBlock = ullStartFrom / ullBlockSize; ; --ullBlock) {
+			if (pIndex->IsCandidate(ullBlock, vecHashes)) {
+				auto ullBlockFirst = ullBlock;
+				while (ullBlockFirst > ullBlockMin && pIndex->IsCandidate(ullBlockFirst - 1, vecHashes)) {
+					--ullBlockFirst;
+				}
+
+				const auto ullRunLast = (ullBlock + 1) * ullBlockSize - 1;
+				const auto ullDist = ullRunLast >= ullStartFrom ? 0ULL :
+					((ullStartFrom - ullRunLast + ullStep - 1) / ullStep) * ullStep;
+				if (ullDist > ullStartFrom - ullRngStart)
+					break; //The step goes beyond the range start.
+
+				const auto ullFrom = ullStartFrom - ullDist;
+				const auto ullTo = (std::max)(ullBlockFirst * ullBlockSize, ullRngStart);
+				ullBlock = ullBlockFirst;
+				if (ullFrom >= ullTo) {
+					auto sfdRun = sfd;
+					sfdRun.ullStartFrom = ullFrom;
+					sfdRun.ullRngStart = ullTo;
+					CalcMemChunks(sfdRun, false);
+					if (const auto findRes = pSearchFunc(sfdRun); findRes || findRes.fCanceled) {
+						return findRes;
+					}
+				}
+			}
+
+			if (ullBlock == ullBlockMin)
+				break;
+		}
+	}
+
+	return { };
 }
 
 void CHexDlgSearch::SetEditStartFrom(ULONGLONG ullOffset)
@@ -1787,6 +2847,73 @@ void CHexDlgSearch::SetEditStartFrom(ULONGLONG ullOffset)
 	m_WndEditStart.SetWndText(std::format(L"0x{:X}", ullOffset));
 }
 
+void CHexDlgSearch::StartSearchJob(const SEARCHFUNCDATA& sfd, const HEXSEARCH& hss, bool fWrap)
+{
+	m_pSearchJob = std::make_unique<SEARCHJOB>();
+	auto& stJob = *m_pSearchJob;
+	stJob.vecFindFrom.assign(sfd.spnFindFrom.begin(), sfd.spnFindFrom.end());
+	stJob.vecFindTo.assign(sfd.spnFindTo.begin(), sfd.spnFindTo.end());
+	stJob.hss = hss;
+	stJob.hss.spnFind = stJob.vecFindFrom;
+	stJob.hss.spnFindTo = hss.spnFindTo.empty() ? SpanCByte { } : SpanCByte { stJob.vecFindTo }; //Numbers range only.
+	stJob.sfd = sfd;
+	stJob.sfd.spnFindFrom = stJob.vecFindFrom;
+	stJob.sfd.spnFindTo = stJob.vecFindTo;
+	stJob.ullStart = sfd.ullStartFrom;
+	stJob.ullFirstOffset = sfd.ullRngStart;
+	stJob.ullLastOffset = GetLastSearchOffset();
+	stJob.ullTail = sfd.ullRngEnd - stJob.ullLastOffset;
+	stJob.ullSlice = GetHexCtrl()->GetCacheSize();
+	stJob.dwLimit = hss.eSearchMode == EHexSearchMode::SEARCH_ALL ? m_dwLimit : 1;
+	stJob.fWrap = fWrap;
+
+	const auto fAll = hss.eSearchMode == EHexSearchMode::SEARCH_ALL;
+	const auto fFwd = hss.eSearchMode != EHexSearchMode::SEARCH_BACKWARD;
+	if (GetHexCtrl()->IsVirtual()) {
+		stJob.pSearchFunc = GetSearchFunc(fFwd, false); //Slices are small, they're not canceled halfway.
+	}
+	else {
+		stJob.pDlgProg = std::make_unique<CHexDlgProgress>(L"", L"", (std::min)(stJob.ullStart, stJob.ullFirstOffset),
+			(std::max)(stJob.ullStart, stJob.ullLastOffset));
+		stJob.sfd.pDlgProg = stJob.pDlgProg.get();
+		stJob.pSearchFunc = GetSearchFunc(fFwd, !fAll); //FindAllMT checks the cancel itself, between the blocks.
+		stJob.thrdWorker = std::jthread([this, &stJob, fAll]() {
+			if (fAll) {
+				if (const auto optRes = FindAllSA(stJob.sfd, stJob.hss, stJob.dwLimit); optRes) {
+					stJob.OnHexSearchResult(*optRes, { });
+				}
+				else {
+					FindAllMT(stJob.sfd, stJob.pSearchFunc, &stJob, stJob.dwLimit);
+				}
+			}
+			else {
+				stJob.findRes = SearchIndexed(stJob.sfd, stJob.pSearchFunc, stJob.hss);
+			}
+			stJob.atomDone.store(true, std::memory_order_release);
+			});
+	}
+
+	m_Wnd.SetTimer(m_uIDTSearchJob, m_uSearchJobElapse, nullptr);
+	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_FINDALL).SetWndText(L"Cancel");
+	m_WndBtnPause.EnableWindow(fAll);
+	m_WndStatResult.SetWndText(L"Searching...");
+}
+
+void CHexDlgSearch::StopSearchJob()
+{
+	if (!m_pSearchJob)
+		return;
+
+	auto& stJob = *m_pSearchJob;
+	stJob.Cancel();
+	if (stJob.thrdWorker.joinable()) {
+		stJob.thrdWorker.join();
+	}
+	stJob.fStopped = !stJob.fDone;
+	stJob.fDone = true;
+	UpdateSearchJob();
+}
+
 void CHexDlgSearch::UpdateControlsState()
 {
 	const auto pHexCtrl = GetHexCtrl();
@@ -1817,7 +2944,7 @@ void CHexDlgSearch::UpdateControlsState()
 	m_WndCmbReplace.EnableWindow(fMutable);
 	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_SEARCHF).EnableWindow(fSearchEnabled);
 	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_SEARCHB).EnableWindow(fSearchEnabled);
-	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_FINDALL).EnableWindow(fSearchEnabled);
+	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_FINDALL).EnableWindow(fSearchEnabled || m_pSearchJob != nullptr);
 	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_REPL).EnableWindow(fReplaceEnabled);
 	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_REPLALL).EnableWindow(fReplaceEnabled);
 	m_WndEditWC.EnableWindow(IsWildcard());
@@ -1825,7 +2952,7 @@ void CHexDlgSearch::UpdateControlsState()
 
 void CHexDlgSearch::UpdateCueBanners()
 {
-	using enum ESearchType;
+	using enum EHexSearchType;
 	switch (GetSearchType()) {
 	case STRUCT_FILETIME:
 	{
@@ -1842,10 +2969,132 @@ void CHexDlgSearch::UpdateCueBanners()
 	}
 }
 
-void CHexDlgSearch::UpdateTTState()
+void CHexDlgSearch::UpdateSearchJob()
 {
-	const TTTOOLINFOW ti { .cbSize { sizeof(TTTOOLINFOW) }, .uFlags { TTF_IDISHWND | TTF_SUBCLASS }, .hwnd { m_Wnd },
-		.uId { reinterpret_cast<UINT_PTR>(m_WndCmbFind.GetComboBoxInfo().hwndItem) }, .lpszText { LPSTR_TEXTCALLBACKW } };
+	if (!m_pSearchJob)
+		return;
+
+	auto& stJob = *m_pSearchJob;
+	auto& sfd = stJob.sfd;
+	const auto fAll = stJob.hss.eSearchMode == EHexSearchMode::SEARCH_ALL;
+	const auto fFwd = stJob.hss.eSearchMode != EHexSearchMode::SEARCH_BACKWARD;
+	const auto uzSizeBefore = m_SearchRes.GetSize();
+	if (stJob.pDlgProg) { //Worker's results are taken, the done flag is read first to take its last results too.
+		const auto fWorkerDone = stJob.atomDone.load(std::memory_order_acquire);
+		VecSearchResult vecPending;
+		{
+			const std::scoped_lock lock(stJob.mtxPending);
+			vecPending.swap(stJob.vecPending);
+		}
+		for (const auto ullOffset : vecPending) {
+			m_SearchRes.Insert(ullOffset); //Filling the Found occurences.
+		}
+		stJob.fDone = stJob.fDone || fWorkerDone;
+	}
+
+	//Slices are searched for a half of the timer's period, the UI is responsive the other half.
+	const auto tmEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_uSearchJobElapse / 2);
+	while (!stJob.pDlgProg && !stJob.atomPause.load() && !stJob.fDone && std::chrono::steady_clock::now() < tmEnd) {
+		if (stJob.dwFound >= stJob.dwLimit) {
+			stJob.fDone = true;
+			break;
+		}
+
+		if (fFwd) {
+			if (stJob.ullStart > stJob.ullLastOffset) {
+				stJob.fDone = true;
+				break;
+			}
+
+			const auto ullSliceLast = (std::min)(stJob.ullLastOffset, stJob.ullStart + stJob.ullSlice - 1);
+			sfd.ullStartFrom = stJob.ullStart;
+			sfd.ullRngEnd = ullSliceLast + stJob.ullTail;
+			CalcMemChunks(sfd);
+			const auto findRes = stJob.pSearchFunc(sfd);
+			if (!findRes) { //Next slice starts on the step too.
+				stJob.ullStart += ((ullSliceLast - stJob.ullStart) / sfd.ullStep + 1) * sfd.ullStep;
+				continue;
+			}
+
+			if (fAll) {
+				m_SearchRes.Insert(findRes.ullOffset); //Filling the Found occurences.
+			}
+			stJob.findRes = findRes;
+			++stJob.dwFound;
+			stJob.ullStart = findRes.ullOffset + sfd.ullStep;
+		}
+		else { //Backward slices go from the ullStart down to the ullFirstOffset.
+			const auto ullSliceFirst = stJob.ullStart - (std::min)(stJob.ullStart - stJob.ullFirstOffset, stJob.ullSlice - 1);
+			sfd.ullStartFrom = stJob.ullStart;
+			sfd.ullRngStart = ullSliceFirst;
+			CalcMemChunks(sfd, false);
+			if (const auto findRes = stJob.pSearchFunc(sfd); findRes) {
+				stJob.findRes = findRes;
+				++stJob.dwFound;
+				continue;
+			}
+
+			const auto ullBack = ((stJob.ullStart - ullSliceFirst) / sfd.ullStep + 1) * sfd.ullStep; //On the step too.
+			if (stJob.ullStart - stJob.ullFirstOffset < ullBack) {
+				stJob.fDone = true;
+				break;
+			}
+			stJob.ullStart -= ullBack;
+		}
+	}
+
+	if (m_SearchRes.GetSize() != uzSizeBefore) {
+		m_ListEx.SetItemCountEx(static_cast<int>(m_SearchRes.GetSize()), LVSICF_NOINVALIDATEALL | LVSICF_NOSCROLL);
+		m_fFound = true;
+	}
+
+	if (!stJob.fDone) {
+		//Current offset's position in the search range, in percent, counted from the range's end if backward.
+		const auto ullRngSize = stJob.ullLastOffset - stJob.ullFirstOffset + 1;
+		const auto ullPos = std::clamp(stJob.pDlgProg ? stJob.pDlgProg->GetCurrent() : stJob.ullStart,
+			stJob.ullFirstOffset, stJob.ullLastOffset) - stJob.ullFirstOffset;
+		const auto ullPercent = (fFwd ? ullPos : ullRngSize - 1 - ullPos) * 100 / ullRngSize;
+		m_WndStatResult.SetWndText(fAll ? std::format(ut::GetLocale(), L"{} Found {:L} occurrences so far. ({}%)",
+			stJob.atomPause.load() ? L"Paused." : L"Searching...", m_SearchRes.GetSize(), ullPercent)
+			: std::format(L"Searching... ({}%)", ullPercent));
+		return;
+	}
+
+	m_Wnd.KillTimer(m_uIDTSearchJob);
+	const auto pJob = std::move(m_pSearchJob); //The Done functions below can start the next job.
+	m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_FINDALL).SetWndText(L"Find All");
+	m_WndBtnPause.SetWndText(L"Pause");
+	m_WndBtnPause.EnableWindow(false);
+	UpdateControlsState();
+
+	if (!fAll) {
+		if (pJob->fStopped) { //Stopped by the new search or by the data change, it's not finished anymore.
+			m_WndStatResult.SetWndText(L"");
+		}
+		else if (fFwd) {
+			FindForwardDone(pJob->findRes, pJob->fWrap);
+		}
+		else {
+			FindBackwardDone(pJob->findRes, pJob->fWrap);
+		}
+		return;
+	}
+
+	if (m_SearchRes.IsEmpty()) {
+		ResetSearch();
+		m_WndStatResult.SetWndText(L"Didn't find any occurrence, the end is reached.");
+	}
+	else {
+		m_fFound = true;
+		m_ullStartFrom = m_SearchRes.GetAt(m_SearchRes.GetSize() - 1) + GetStep();
+		m_WndStatResult.SetWndText(std::format(ut::GetLocale(), L"Found {:L} occurrences.", m_SearchRes.GetSize()));
+	}
+}
+
+void CHexDlgSearch::UpdateTTState()
+{
+	const TTTOOLINFOW ti { .cbSize { sizeof(TTTOOLINFOW) }, .uFlags { TTF_IDISHWND | TTF_SUBCLASS }, .hwnd { m_Wnd },
+		.uId { reinterpret_cast<UINT_PTR>(m_WndCmbFind.GetComboBoxInfo().hwndItem) }, .lpszText { LPSTR_TEXTCALLBACKW } };
 	m_WndTT.SendMsg(GetSearchMode() == ESearchMode::MODE_NUMBERS ? TTM_ADDTOOLW : TTM_DELTOOLW, 0, reinterpret_cast<LPARAM>(&ti));
 }
 
@@ -1880,6 +3129,7 @@ auto CHexDlgSearch::WMCommand(const MSG& msg)->INT_PTR
 		case IDC_HEXCTRL_SEARCH_BTN_SEARCHF: OnButtonSearchF(); break;
 		case IDC_HEXCTRL_SEARCH_BTN_SEARCHB: OnButtonSearchB(); break;
 		case IDC_HEXCTRL_SEARCH_BTN_FINDALL: OnButtonFindAll(); break;
+		case IDC_HEXCTRL_SEARCH_BTN_PAUSE: OnButtonPause(); break;
 		case IDC_HEXCTRL_SEARCH_BTN_REPL: OnButtonReplace(); break;
 		case IDC_HEXCTRL_SEARCH_BTN_REPLALL: OnButtonReplaceAll(); break;
 		case IDC_HEXCTRL_SEARCH_CHK_SEL: OnCheckSel(); break;
@@ -1899,7 +3149,7 @@ auto CHexDlgSearch::WMCommand(const MSG& msg)->INT_PTR
 			int iItem { -1 };
 			for (auto i = 0UL; i < m_ListEx.GetSelectedCount(); ++i) {
 				iItem = m_ListEx.GetNextItem(iItem, LVNI_SELECTED);
-				const HEXBKM hbs { .vecSpan { HEXSPAN { m_vecSearchRes.at(static_cast<std::size_t>(iItem)),
+				const HEXBKM hbs { .vecSpan { HEXSPAN { m_SearchRes.GetAt(static_cast<std::size_t>(iItem)),
 					m_fReplace ? GetReplaceDataSize() : GetSearchDataSize() } }, .wstrDesc { m_wstrSearch },
 					.stClr { GetHexCtrl()->GetColors().clrBkBkm, GetHexCtrl()->GetColors().clrFontBkm } };
 				GetHexCtrl()->GetBookmarks()->AddBkm(hbs);
@@ -1908,6 +3158,20 @@ auto CHexDlgSearch::WMCommand(const MSG& msg)->INT_PTR
 		}
 		break;
 		case EMenuID::IDM_SEARCH_SELECTALL: m_ListEx.SetItemState(-1, LVIS_SELECTED, LVIS_SELECTED); break;
+		case EMenuID::IDM_SEARCH_BKMALL: //One bookmark for all occurrences.
+		{
+			const HEXBKM hbs { .vecSpan { GetResultSpans() }, .wstrDesc { m_wstrSearch },
+				.stClr { GetHexCtrl()->GetColors().clrBkBkm, GetHexCtrl()->GetColors().clrFontBkm } };
+			GetHexCtrl()->GetBookmarks()->AddBkm(hbs);
+			GetHexCtrl()->Redraw();
+		}
+		break;
+		case EMenuID::IDM_SEARCH_SELDATA: GetHexCtrl()->SetSelection(GetResultSpans()); break;
+		case EMenuID::IDM_SEARCH_MODIFYALL: //Operations dialog modifies the selection in one go.
+			GetHexCtrl()->SetSelection(GetResultSpans());
+			GetHexCtrl()->ExecuteCmd(EHexCmd::CMD_MODIFY_OPERS_DLG);
+			break;
+		case EMenuID::IDM_SEARCH_EXPORT: ExportResults(); break;
 		case EMenuID::IDM_SEARCH_CLEARALL:
 			ClearList();
 			m_fSecondMatch = false; //To be able to search from the zero offset.
@@ -1933,8 +3197,9 @@ auto CHexDlgSearch::WMCtlColorStatic(const MSG& msg)->INT_PTR
 
 auto CHexDlgSearch::WMDestroy()->INT_PTR
 {
+	m_pSearchJob.reset(); //Stops the background search, if it's in progress.
 	m_MenuList.DestroyMenu();
-	m_vecSearchRes.clear();
+	m_SearchRes.Clear();
 	m_vecSearchDataFrom.clear();
 	m_vecSearchDataTo.clear();
 	m_vecReplaceData.clear();
@@ -1969,6 +3234,7 @@ auto CHexDlgSearch::WMInitDialog(const MSG& msg)->INT_PTR
 	m_WndBtnInv.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_CHK_INV));
 	m_WndBtnBE.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_CHK_BE));
 	m_WndBtnMC.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_CHK_MC));
+	m_WndBtnPause.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_BTN_PAUSE));
 	m_WndEditStart.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_EDIT_START));
 	m_WndEditStep.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_EDIT_STEP));
 	m_WndEditRngBegin.Attach(m_Wnd.GetDlgItem(IDC_HEXCTRL_SEARCH_EDIT_RNGBEG));
@@ -2003,6 +3269,11 @@ auto CHexDlgSearch::WMInitDialog(const MSG& msg)->INT_PTR
 	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_ADDBKM), L"Add bookmark(s)");
 	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_SELECTALL), L"Select All");
 	m_MenuList.AppendSepar();
+	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_BKMALL), L"Bookmark all occurrences");
+	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_SELDATA), L"Select all occurrences in data");
+	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_MODIFYALL), L"Modify all occurrences...");
+	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_EXPORT), L"Export offsets...");
+	m_MenuList.AppendSepar();
 	m_MenuList.AppendString(static_cast<UINT_PTR>(EMenuID::IDM_SEARCH_CLEARALL), L"Clear All");
 
 	m_WndEditStep.SetWndText(std::format(L"{}", GetStep())); //"Step" edit-box text.
@@ -2102,7 +3373,7 @@ void CHexDlgSearch::WMNotifyListGetDispInfo(NMHDR* pNMHDR)
 		*std::format_to(pItem->pszText, L"{}", iItem + 1) = L'\0';
 		break;
 	case 1: //Offset.
-		*std::format_to(pItem->pszText, L"0x{:X}", GetHexCtrl()->GetOffset(m_vecSearchRes[iItem], true)) = L'\0';
+		*std::format_to(pItem->pszText, L"0x{:X}", GetHexCtrl()->GetOffset(m_SearchRes.GetAt(iItem), true)) = L'\0';
 		break;
 	default:
 		break;
@@ -2123,12 +3394,12 @@ void CHexDlgSearch::WMNotifyListItemChanged(NMHDR* pNMHDR)
 		//Do not yet add selected (clicked) item (in multiselect), will add it after the loop,
 		//so that it's always last in the vecSpan to highlight it in HexCtrlHighlight.
 		if (pNMI->iItem != iItem) {
-			vecSpan.emplace_back(m_vecSearchRes.at(static_cast<std::size_t>(iItem)),
+			vecSpan.emplace_back(m_SearchRes.GetAt(static_cast<std::size_t>(iItem)),
 				m_fReplace ? GetReplaceDataSize() : GetSearchDataSize());
 		}
 	}
 
-	const auto ullOffset = m_vecSearchRes[static_cast<std::size_t>(pNMI->iItem)];
+	const auto ullOffset = m_SearchRes.GetAt(static_cast<std::size_t>(pNMI->iItem));
 	vecSpan.emplace_back(ullOffset, m_fReplace ? GetReplaceDataSize() : GetSearchDataSize());
 	HexCtrlHighlight(vecSpan);
 	SetEditStartFrom(GetHexCtrl()->GetOffset(ullOffset, true)); //Show virtual offset.
@@ -2141,6 +3412,11 @@ void CHexDlgSearch::WMNotifyListRClick([[maybe_unused]] NMHDR* pNMHDR)
 	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_ADDBKM), fEnabled);
 	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_SELECTALL), fEnabled);
 	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_CLEARALL), fEnabled);
+	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_BKMALL), fEnabled);
+	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_SELDATA), fEnabled);
+	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_MODIFYALL), fEnabled && GetHexCtrl()->IsMutable()
+		&& !m_pSearchJob); //Data must not change under the search in progress.
+	m_MenuList.EnableItem(static_cast<UINT>(EMenuID::IDM_SEARCH_EXPORT), fEnabled);
 
 	POINT pt;
 	::GetCursorPos(&pt);
@@ -2165,234 +3441,2571 @@ void CHexDlgSearch::WMNotifyTT(NMHDR* pNMHDR)
 	}
 }
 
+auto CHexDlgSearch::WMTimer(const MSG& msg)->INT_PTR
+{
+	if (msg.wParam != m_uIDTSearchJob)
+		return FALSE;
+
+	UpdateSearchJob();
+
+	return TRUE;
+}
+
 
 //Static functions.
 
-template<CHexDlgSearch::SEARCHTYPE st>
-bool CHexDlgSearch::MemCmpEQNum(const std::byte* pWhere, const std::byte* pWhat)
+void CHexDlgSearch::CalcMemChunks(SEARCHFUNCDATA& sfd, bool fFwd)
 {
-	using enum EMemCmp;
-	if constexpr (st.eMemCmp == DATA_UINT8) {
-		return *reinterpret_cast<const std::uint8_t*>(pWhere) == *reinterpret_cast<const std::uint8_t*>(pWhat);
-	}
-	else if constexpr (st.eMemCmp == DATA_UINT16) {
-		return *reinterpret_cast<const std::uint16_t*>(pWhere) == *reinterpret_cast<const std::uint16_t*>(pWhat);
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullSentinel = sfd.ullRngEnd + 1; //This offset is non-dereferenceable.
+	if (sfd.ullStartFrom + uzSizeSearch > ullSentinel) {
+		sfd.ullChunks = { };
+		sfd.ullChunkSize = { };
+		sfd.ullChunkMaxOffset = { };
+		return;
 	}
-	else if constexpr (st.eMemCmp == DATA_UINT32) {
-		return *reinterpret_cast<const std::uint32_t*>(pWhere) == *reinterpret_cast<const std::uint32_t*>(pWhat);
+
+	const auto ullSizeTotal = fFwd ? ullSentinel - sfd.ullStartFrom : //Depends on search direction.
+		(sfd.ullStartFrom - sfd.ullRngStart) + uzSizeSearch;
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto ullStep = sfd.ullStep;
+	ULONGLONG ullChunks;
+	ULONGLONG ullChunkSize;
+	ULONGLONG ullChunkMaxOffset;
+	bool fBigStep { false };
+
+	if (!pHexCtrl->IsVirtual()) {
+		ullChunks = 1;
+		ullChunkSize = ullSizeTotal;
+		ullChunkMaxOffset = ullSizeTotal - uzSizeSearch;
 	}
-	else if constexpr (st.eMemCmp == DATA_UINT64) {
-		return *reinterpret_cast<const std::uint64_t*>(pWhere) == *reinterpret_cast<const std::uint64_t*>(pWhat);
+	else {
+		ullChunkSize = (std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize()), ullSizeTotal);
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		if (ullStep > 1 && ullStep <= ullChunkMaxOffset) {
+			ullChunkMaxOffset -= ullChunkMaxOffset % ullStep; //Next chunks start on the step too.
+		}
+
+		if (ullStep > ullChunkMaxOffset) { //For very big steps.
+			ullChunks = ullSizeTotal > ullStep ? (ullSizeTotal / ullStep) + ((ullSizeTotal % ullStep) ? 1 : 0) : 1;
+			fBigStep = true;
+		}
+		else {
+			ullChunks = ullSizeTotal > ullChunkMaxOffset ? (ullSizeTotal / ullChunkMaxOffset)
+				+ ((ullSizeTotal % ullChunkMaxOffset) ? 1 : 0) : 1;
+		}
 	}
+
+	sfd.ullChunks = ullChunks;
+	sfd.ullChunkSize = ullChunkSize;
+	sfd.ullChunkMaxOffset = ullChunkMaxOffset;
+	sfd.fBigStep = fBigStep;
 }
 
-template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::MemCmpEQNumRng(const std::byte* pWhere, const std::byte* pRngFrom, const std::byte* pRngTo)->bool
+auto CHexDlgSearch::CreateMultiSearch(SpanSpanCByte spnPatterns, bool fMatchCase)->std::optional<MULTISEARCH>
 {
-	using enum EMemCmp;
-	if constexpr (st.eMemCmp == DATA_INT8) {
-		const auto i8Where = *reinterpret_cast<const std::int8_t*>(pWhere);
-		const auto i8From = *reinterpret_cast<const std::int8_t*>(pRngFrom);
-		const auto i8To = *reinterpret_cast<const std::int8_t*>(pRngTo);
-		return i8Where >= i8From && i8Where <= i8To;
+	//Patterns are compiled into the Aho-Corasick automaton, and then into the full DFA,
+	//where every state has a transition for every byte class, so that the search is one table lookup per data byte.
+	//Byte classes keep the table small: only bytes that are present in the patterns have their own classes.
+	//For the case insensitive search upper case ASCII letters share the classes with the lower case ones.
+	constexpr auto u32None { 0xFFFFFFFFU }; //No transition yet.
+	constexpr auto ullSizeTransMax { 1024ULL * 1024ULL * 256ULL }; //256MB transitions table limit.
+	const auto lmbFold = [fMatchCase](std::byte byte) {
+		const auto u8Byte = std::to_integer<std::uint8_t>(byte);
+		return (!fMatchCase && u8Byte >= 'A' && u8Byte <= 'Z') ? static_cast<std::uint8_t>(u8Byte + 32) : u8Byte; };
+
+	MULTISEARCH stMulti;
+	bool arrUsed[256] { };
+	ULONGLONG ullStatesMax { 1 }; //Root state.
+	for (const auto spn : spnPatterns) {
+		for (const auto byte : spn) {
+			arrUsed[lmbFold(byte)] = true;
+		}
+		ullStatesMax += spn.size();
 	}
-	if constexpr (st.eMemCmp == DATA_UINT8) {
-		const auto u8Where = *reinterpret_cast<const std::uint8_t*>(pWhere);
-		const auto u8From = *reinterpret_cast<const std::uint8_t*>(pRngFrom);
-		const auto u8To = *reinterpret_cast<const std::uint8_t*>(pRngTo);
-		return u8Where >= u8From && u8Where <= u8To;
+
+	DWORD dwClasses { 1 }; //Class 0 is for bytes that are not in any pattern.
+	for (auto i = 0U; i < std::size(arrUsed); ++i) {
+		if (arrUsed[i]) {
+			stMulti.arrClass[i] = static_cast<std::uint16_t>(dwClasses++);
+		}
 	}
-	else if constexpr (st.eMemCmp == DATA_INT16) {
-		const auto i16Where = *reinterpret_cast<const std::int16_t*>(pWhere);
-		const auto i16From = *reinterpret_cast<const std::int16_t*>(pRngFrom);
-		const auto i16To = *reinterpret_cast<const std::int16_t*>(pRngTo);
-		return i16Where >= i16From && i16Where <= i16To;
+	if (!fMatchCase) {
+		for (auto i = static_cast<std::uint8_t>('A'); i <= static_cast<std::uint8_t>('Z'); ++i) {
+			stMulti.arrClass[i] = stMulti.arrClass[i + 32];
+		}
 	}
-	else if constexpr (st.eMemCmp == DATA_UINT16) {
-		const auto u16Where = *reinterpret_cast<const std::uint16_t*>(pWhere);
-		const auto u16From = *reinterpret_cast<const std::uint16_t*>(pRngFrom);
-		const auto u16To = *reinterpret_cast<const std::uint16_t*>(pRngTo);
-		return u16Where >= u16From && u16Where <= u16To;
+
+	if (ullStatesMax * dwClasses * sizeof(std::uint32_t) > ullSizeTransMax) {
+		ut::DBG_REPORT(L"Multi-pattern search data is too big.");
+		return std::nullopt;
 	}
-	else if constexpr (st.eMemCmp == DATA_INT32) {
-		const auto i32Where = *reinterpret_cast<const std::int32_t*>(pWhere);
-		const auto i32From = *reinterpret_cast<const std::int32_t*>(pRngFrom);
-		const auto i32To = *reinterpret_cast<const std::int32_t*>(pRngTo);
-		return i32Where >= i32From && i32Where <= i32To;
+
+	//Trie.
+	auto& vecTrans = stMulti.vecTrans;
+	vecTrans.assign(dwClasses, u32None);
+	std::vector<std::vector<DWORD>> vecOut(1); //Patterns that end in a state.
+	for (auto itPatt = 0U; itPatt < spnPatterns.size(); ++itPatt) {
+		std::uint32_t u32State { 0 };
+		for (const auto byte : spnPatterns[itPatt]) {
+			const auto uzIdx = u32State * dwClasses + stMulti.arrClass[lmbFold(byte)];
+			if (vecTrans[uzIdx] == u32None) {
+				vecTrans[uzIdx] = static_cast<std::uint32_t>(vecOut.size());
+				vecTrans.resize(vecTrans.size() + dwClasses, u32None);
+				vecOut.emplace_back();
+			}
+			u32State = vecTrans[uzIdx];
+		}
+		vecOut[u32State].emplace_back(itPatt);
+		stMulti.vecPattSize.emplace_back(static_cast<std::uint32_t>(spnPatterns[itPatt].size()));
 	}
-	else if constexpr (st.eMemCmp == DATA_UINT32) {
-		const auto u32Where = *reinterpret_cast<const std::uint32_t*>(pWhere);
-		const auto u32From = *reinterpret_cast<const std::uint32_t*>(pRngFrom);
-		const auto u32To = *reinterpret_cast<const std::uint32_t*>(pRngTo);
-		return u32Where >= u32From && u32Where <= u32To;
+
+	//Breadth-first pass sets the failure links and fills the absent transitions from the failure states.
+	//Failure state is always of a smaller depth than the state itself, hence it's already complete.
+	std::vector<std::uint32_t> vecFail(vecOut.size(), 0);
+	std::vector<std::uint32_t> vecQueue;
+	vecQueue.reserve(vecOut.size());
+	for (auto itClass = 0U; itClass < dwClasses; ++itClass) {
+		if (vecTrans[itClass] == u32None) {
+			vecTrans[itClass] = 0;
+		}
+		else {
+			vecQueue.emplace_back(vecTrans[itClass]);
+		}
 	}
-	else if constexpr (st.eMemCmp == DATA_INT64) {
-		const auto i64Where = *reinterpret_cast<const std::int64_t*>(pWhere);
-		const auto i64From = *reinterpret_cast<const std::int64_t*>(pRngFrom);
-		const auto i64To = *reinterpret_cast<const std::int64_t*>(pRngTo);
-		return i64Where >= i64From && i64Where <= i64To;
+
+	for (std::size_t itQueue { 0 }; itQueue < vecQueue.size(); ++itQueue) {
+		const auto u32State = vecQueue[itQueue];
+		const auto u32Fail = vecFail[u32State];
+		vecOut[u32State].insert(vecOut[u32State].end(), vecOut[u32Fail].begin(), vecOut[u32Fail].end());
+		for (auto itClass = 0U; itClass < dwClasses; ++itClass) {
+			const auto u32FailNext = vecTrans[u32Fail * dwClasses + itClass];
+			auto& u32Next = vecTrans[u32State * dwClasses + itClass];
+			if (u32Next == u32None) {
+				u32Next = u32FailNext;
+			}
+			else {
+				vecFail[u32Next] = u32FailNext;
+				vecQueue.emplace_back(u32Next);
+			}
+		}
 	}
-	else if constexpr (st.eMemCmp == DATA_UINT64) {
-		const auto u64Where = *reinterpret_cast<const std::uint64_t*>(pWhere);
-		const auto u64From = *reinterpret_cast<const std::uint64_t*>(pRngFrom);
-		const auto u64To = *reinterpret_cast<const std::uint64_t*>(pRngTo);
-		return u64Where >= u64From && u64Where <= u64To;
+
+	for (auto& u32Next : vecTrans) {
+		if (!vecOut[u32Next].empty()) {
+			u32Next |= MULTISEARCH::u32FlagOut;
+		}
 	}
-	else if constexpr (st.eMemCmp == DATA_FLOAT) {
-		const auto flWhere = *reinterpret_cast<const float*>(pWhere);
-		const auto flFrom = *reinterpret_cast<const float*>(pRngFrom);
-		const auto flTo = *reinterpret_cast<const float*>(pRngTo);
-		return flWhere >= flFrom && flWhere <= flTo;
+
+	stMulti.vecOutIdx.reserve(vecOut.size() + 1);
+	for (const auto& vecPatt : vecOut) {
+		stMulti.vecOutIdx.emplace_back(static_cast<std::uint32_t>(stMulti.vecOutPatt.size()));
+		stMulti.vecOutPatt.insert(stMulti.vecOutPatt.end(), vecPatt.begin(), vecPatt.end());
 	}
-	else if constexpr (st.eMemCmp == DATA_DOUBLE) {
-		const auto dWhere = *reinterpret_cast<const double*>(pWhere);
-		const auto dFrom = *reinterpret_cast<const double*>(pRngFrom);
-		const auto dTo = *reinterpret_cast<const double*>(pRngTo);
-		return dWhere >= dFrom && dWhere <= dTo;
+	stMulti.vecOutIdx.emplace_back(static_cast<std::uint32_t>(stMulti.vecOutPatt.size()));
+
+	//Bytes that move the automaton out of the root state.
+	std::vector<std::uint8_t> vecFirstBytes;
+	for (auto i = 0U; i < 256U; ++i) {
+		if (vecTrans[stMulti.arrClass[i]] != 0) {
+			vecFirstBytes.emplace_back(static_cast<std::uint8_t>(i));
+		}
 	}
+	stMulti.stFirstBytes = simd::MakeNibbleSet(vecFirstBytes);
+	stMulti.fPrefilter = vecFirstBytes.size() <= 64; //With too many first bytes the prefilter is mostly a waste.
+	stMulti.dwClasses = dwClasses;
+
+	return stMulti;
 }
 
-template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::MemCmpEQText(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize, std::byte bWildcard)->bool
+auto CHexDlgSearch::REGEXPARSER::Compile(std::uint32_t u32Node, std::uint32_t u32Next)->std::uint32_t
 {
-	using enum EMemCmp;
-	if constexpr (st.eMemCmp == DATA_ASCII) {
-		for (std::size_t i { 0 }; i < uzSize; ++i, ++pWhere, ++pWhat) {
-			if constexpr (st.fWildcard) {
-				if (*pWhat == bWildcard) //Checking for wildcard match.
-					continue;
-			}
+	//Thompson's construction, backwards: every node is compiled with the state to continue with after it.
+	//Repeated nodes are compiled as many times as they are repeated.
+	if (fError || vecNFA.size() > uzNFAStatesMax) {
+		fError = true;
+		return u32Next;
+	}
 
-			if constexpr (!st.fMatchCase) {
-				auto ch = static_cast<char>(*pWhere);
-				if (ch >= 'A' && ch <= 'Z') { //If it's a capital letter.
-					ch += 32; //Lowering this letter ('a' - 'A' = 32).
-				}
+	const auto lmbAddState = [this](NFASTATE&& stState) {
+		vecNFA.emplace_back(std::move(stState));
+		return static_cast<std::uint32_t>(vecNFA.size() - 1);
+		};
 
-				if (ch != static_cast<char>(*pWhat))
-					return false;
+	using enum ENode;
+	switch (const auto& refNode = vecNodes[u32Node]; refNode.eNode) {
+	case NODE_SET:
+		return lmbAddState({ .u32Node { u32Node }, .u32Next { u32Next } });
+	case NODE_CAT:
+	{
+		auto u32State = u32Next;
+		for (auto it = refNode.vecSub.rbegin(); it != refNode.vecSub.rend(); ++it) {
+			u32State = Compile(*it, u32State);
+		}
+		return u32State;
+	}
+	case NODE_ALT:
+	{
+		NFASTATE stState;
+		for (const auto u32Sub : refNode.vecSub) {
+			stState.vecEps.emplace_back(Compile(u32Sub, u32Next));
+		}
+		return lmbAddState(std::move(stState));
+	}
+	case NODE_REPEAT:
+	{
+		const auto u32Sub = refNode.vecSub.front();
+		const auto u32Min = refNode.u32Min;
+		const auto u32Max = refNode.u32Max;
+		auto u32State = u32Next;
+		if (u32Max == u32Inf) { //Loop state: either one more repetition, or out.
+			const auto u32Loop = lmbAddState({ });
+			const auto u32Body = Compile(u32Sub, u32Loop);
+			vecNFA[u32Loop].vecEps = { u32Body, u32Next };
+			u32State = u32Loop;
+		}
+		else {
+			for (auto i = u32Min; i < u32Max && !fError; ++i) { //Optional repetitions.
+				const auto u32Body = Compile(u32Sub, u32State);
+				u32State = lmbAddState({ .vecEps { u32Body, u32Next } });
 			}
-			else {
-				if (*pWhere != *pWhat)
-					return false;
+		}
+		for (auto i = 0U; i < u32Min && !fError; ++i) { //Mandatory repetitions.
+			u32State = Compile(u32Sub, u32State);
+		}
+		return u32State;
+	}
+	default:
+		return u32Next;
+	}
+}
+
+auto CHexDlgSearch::REGEXPARSER::GetSizeMinMax(std::uint32_t u32Node)const->std::pair<ULONGLONG, ULONGLONG>
+{
+	constexpr auto ullInf = (std::numeric_limits<ULONGLONG>::max)();
+	using enum ENode;
+	const auto& refNode = vecNodes[u32Node];
+	switch (refNode.eNode) {
+	case NODE_SET:
+		return { 1, 1 };
+	case NODE_CAT:
+	{
+		ULONGLONG ullMin { }, ullMax { };
+		for (const auto u32Sub : refNode.vecSub) {
+			const auto [ullSubMin, ullSubMax] = GetSizeMinMax(u32Sub);
+			ullMin += ullSubMin;
+			ullMax = (ullMax == ullInf || ullSubMax == ullInf) ? ullInf : ullMax + ullSubMax;
+		}
+		return { ullMin, ullMax };
+	}
+	case NODE_ALT:
+	{
+		ULONGLONG ullMin { ullInf }, ullMax { };
+		for (const auto u32Sub : refNode.vecSub) {
+			const auto [ullSubMin, ullSubMax] = GetSizeMinMax(u32Sub);
+			ullMin = (std::min)(ullMin, ullSubMin);
+			ullMax = (std::max)(ullMax, ullSubMax);
+		}
+		return { ullMin, ullMax };
+	}
+	case NODE_REPEAT:
+	{
+		const auto [ullSubMin, ullSubMax] = GetSizeMinMax(refNode.vecSub.front());
+		const auto ullMax = (refNode.u32Max == u32Inf || ullSubMax == ullInf) ?
+			(ullSubMax == 0 ? 0 : ullInf) : ullSubMax * refNode.u32Max;
+		return { ullSubMin * refNode.u32Min, ullMax };
+	}
+	default:
+		return { };
+	}
+}
+
+auto CHexDlgSearch::REGEXPARSER::Parse()->std::uint32_t
+{
+	const auto u32Root = ParseAlt();
+	if (!IsEnd()) { //Unbalanced ')'.
+		fError = true;
+	}
+
+	return u32Root;
+}
+
+auto CHexDlgSearch::REGEXPARSER::ParseAlt()->std::uint32_t
+{
+	NODE stAlt { .eNode { ENode::NODE_ALT } };
+	stAlt.vecSub.emplace_back(ParseCat());
+	while (!fError && Peek() == '|') {
+		++uzPos;
+		stAlt.vecSub.emplace_back(ParseCat());
+	}
+
+	return stAlt.vecSub.size() == 1 ? stAlt.vecSub.front() : AddNode(std::move(stAlt));
+}
+
+auto CHexDlgSearch::REGEXPARSER::ParseAtom()->std::uint32_t
+{
+	const auto chAtom = Peek();
+	++uzPos;
+	switch (chAtom) {
+	case '(':
+	{
+		if (Peek() == '?') { //Non-capturing group "(?:", groups are never capturing anyway.
+			if (uzPos + 1 >= spnRegex.size() || static_cast<char>(spnRegex[uzPos + 1]) != ':') {
+				fError = true;
+				return 0;
 			}
+			uzPos += 2;
 		}
-		return true;
+
+		const auto u32Node = ParseAlt();
+		if (Peek() != ')') {
+			fError = true;
+			return 0;
+		}
+		++uzPos;
+		return u32Node;
 	}
-	else if constexpr (st.eMemCmp == DATA_WCHAR) {
-		auto pWhereWch = reinterpret_cast<const wchar_t*>(pWhere);
-		auto pWhatWch = reinterpret_cast<const wchar_t*>(pWhat);
-		for (std::size_t i { 0 }; i < (uzSize / sizeof(wchar_t)); ++i, ++pWhereWch, ++pWhatWch) {
-			if constexpr (st.fWildcard) {
-				if (*pWhatWch == static_cast<wchar_t>(bWildcard)) //Checking for wildcard match.
-					continue;
+	case '[':
+	{
+		std::bitset<256> bsSet;
+		const auto fNegate = Peek() == '^';
+		if (fNegate) {
+			++uzPos;
+		}
+
+		auto fFirst { true }; //The ']' right after the '[' is a literal.
+		while (!fError && (fFirst || Peek() != ']')) {
+			if (IsEnd()) {
+				fError = true;
+				return 0;
 			}
 
-			if constexpr (!st.fMatchCase) {
-				auto wch = *pWhereWch;
-				if (wch >= 'A' && wch <= 'Z') { //If it's a capital letter.
-					wch += 32; //Lowering this letter ('a' - 'A' = 32).
+			fFirst = false;
+			const auto lmbClassByte = [this]() {
+				if (Peek() == '\\') {
+					++uzPos;
+					return ParseEscape();
+				}
+				std::bitset<256> bsByte;
+				bsByte.set(std::to_integer<std::uint8_t>(spnRegex[uzPos++]));
+				return bsByte;
+				};
+			const auto bsFrom = lmbClassByte();
+			if (Peek() == '-' && uzPos + 1 < spnRegex.size() && static_cast<char>(spnRegex[uzPos + 1]) != ']') {
+				++uzPos;
+				const auto bsTo = lmbClassByte();
+				if (bsFrom.count() != 1 || bsTo.count() != 1) { //Range ends must be single bytes.
+					fError = true;
+					return 0;
 				}
 
-				if (wch != *pWhatWch)
-					return false;
+				std::size_t uzFrom { }, uzTo { };
+				while (!bsFrom.test(uzFrom)) { ++uzFrom; }
+				while (!bsTo.test(uzTo)) { ++uzTo; }
+				if (uzFrom > uzTo) {
+					fError = true;
+					return 0;
+				}
+				for (auto i = uzFrom; i <= uzTo; ++i) {
+					bsSet.set(i);
+				}
 			}
 			else {
-				if (*pWhereWch != *pWhatWch)
-					return false;
+				bsSet |= bsFrom;
 			}
 		}
-		return true;
+		++uzPos; //']'.
+
+		return AddNode({ .bsSet { fNegate ? ~bsSet : bsSet }, .eNode { ENode::NODE_SET } });
+	}
+	case '.':
+		return AddNode({ .bsSet { std::bitset<256> { }.set() }, .eNode { ENode::NODE_SET } });
+	case '\\':
+		return AddNode({ .bsSet { ParseEscape() }, .eNode { ENode::NODE_SET } });
+	case '*': case '+': case '?': case '{': case ')': case '|': case '^': case '$': //Nothing to repeat, or unsupported.
+		fError = true;
+		return 0;
+	default:
+	{
+		std::bitset<256> bsByte;
+		bsByte.set(std::to_integer<std::uint8_t>(spnRegex[uzPos - 1]));
+		return AddNode({ .bsSet { bsByte }, .eNode { ENode::NODE_SET } });
+	}
 	}
 }
 
-void CHexDlgSearch::Replace(IHexCtrl* pHexCtrl, ULONGLONG ullIndex, SpanCByte spnReplace)
+auto CHexDlgSearch::REGEXPARSER::ParseCat()->std::uint32_t
 {
-	pHexCtrl->ModifyData({ .eModifyMode { EHexModifyMode::MODIFY_ONCE }, .spnData { spnReplace },
-		.vecSpan { { ullIndex, spnReplace.size() } } });
+	NODE stCat { .eNode { ENode::NODE_CAT } };
+	while (!fError && !IsEnd() && Peek() != '|' && Peek() != ')') {
+		stCat.vecSub.emplace_back(ParseRepeat());
+	}
+
+	return stCat.vecSub.size() == 1 ? stCat.vecSub.front() : AddNode(std::move(stCat));
 }
 
-template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchNumFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::REGEXPARSER::ParseEscape()->std::bitset<256>
 {
-	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
-	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
-	const auto ullStep = sfd.ullStep;
-	const auto pHexCtrl = sfd.pHexCtrl;
-	const auto pDlgProg = sfd.pDlgProg;
-	const auto pDataSearch = sfd.spnFindFrom.data();
-	const auto uzSizeSearch = sfd.spnFindFrom.size();
-	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
-	const auto fBigStep = sfd.fBigStep;
-	const auto fInverted = sfd.fInverted;
-	const auto ullChunks = sfd.ullChunks;
-	auto ullChunkSize = sfd.ullChunkSize;
-	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
-	auto ullOffsetSearch = sfd.ullStartFrom;
+	std::bitset<256> bsSet;
+	if (IsEnd()) {
+		fError = true;
+		return bsSet;
+	}
+
+	const auto lmbHex = [](char ch)->int {
+		if (ch >= '0' && ch <= '9') { return ch - '0'; }
+		if (ch >= 'a' && ch <= 'f') { return ch - 'a' + 10; }
+		if (ch >= 'A' && ch <= 'F') { return ch - 'A' + 10; }
+		return -1;
+		};
+	const auto lmbRange = [&bsSet](std::size_t uzFrom, std::size_t uzTo) {
+		for (auto i = uzFrom; i <= uzTo; ++i) {
+			bsSet.set(i);
+		}
+		};
+
+	switch (const auto chEsc = static_cast<char>(spnRegex[uzPos++]); chEsc) {
+	case 'x':
+	{
+		const auto iHi = uzPos < spnRegex.size() ? lmbHex(static_cast<char>(spnRegex[uzPos])) : -1;
+		const auto iLo = uzPos + 1 < spnRegex.size() ? lmbHex(static_cast<char>(spnRegex[uzPos + 1])) : -1;
+		if (iHi < 0 || iLo < 0) {
+			fError = true;
+			break;
+		}
+		uzPos += 2;
+		bsSet.set(static_cast<std::size_t>(iHi * 16 + iLo));
+	}
+	break;
+	case 'd': case 'D':
+		lmbRange('0', '9');
+		if (chEsc == 'D') { bsSet.flip(); }
+		break;
+	case 'w': case 'W':
+		lmbRange('0', '9');
+		lmbRange('A', 'Z');
+		lmbRange('a', 'z');
+		bsSet.set('_');
+		if (chEsc == 'W') { bsSet.flip(); }
+		break;
+	case 's': case 'S':
+		lmbRange('\t', '\r');
+		bsSet.set(' ');
+		if (chEsc == 'S') { bsSet.flip(); }
+		break;
+	case 'n': bsSet.set('\n'); break;
+	case 'r': bsSet.set('\r'); break;
+	case 't': bsSet.set('\t'); break;
+	case '0': bsSet.set(0); break;
+	default:
+		if ((chEsc >= '0' && chEsc <= '9') || (chEsc >= 'a' && chEsc <= 'z') || (chEsc >= 'A' && chEsc <= 'Z')) {
+			fError = true; //Unknown escape.
+			break;
+		}
+		bsSet.set(static_cast<std::uint8_t>(chEsc)); //Escaped metacharacter.
+		break;
+	}
+
+	return bsSet;
+}
+
+auto CHexDlgSearch::REGEXPARSER::ParseNumber()->std::uint32_t
+{
+	std::uint32_t u32Num { };
+	const auto uzStart = uzPos;
+	while (!IsEnd() && Peek() >= '0' && Peek() <= '9') {
+		u32Num = u32Num * 10 + static_cast<std::uint32_t>(Peek() - '0');
+		++uzPos;
+		if (u32Num > u32RepeatMax) {
+			fError = true;
+			return 0;
+		}
+	}
+	if (uzPos == uzStart) {
+		fError = true;
+	}
+
+	return u32Num;
+}
+
+auto CHexDlgSearch::REGEXPARSER::ParseRepeat()->std::uint32_t
+{
+	auto u32Node = ParseAtom();
+	while (!fError && !IsEnd()) {
+		std::uint32_t u32Min { }, u32Max { };
+		switch (Peek()) {
+		case '*': u32Min = 0; u32Max = u32Inf; break;
+		case '+': u32Min = 1; u32Max = u32Inf; break;
+		case '?': u32Min = 0; u32Max = 1; break;
+		case '{':
+			++uzPos;
+			u32Min = u32Max = ParseNumber();
+			if (Peek() == ',') {
+				++uzPos;
+				u32Max = Peek() == '}' ? u32Inf : ParseNumber();
+			}
+			if (fError || Peek() != '}' || u32Min > u32Max) {
+				fError = true;
+				return 0;
+			}
+			break;
+		default:
+			return u32Node;
+		}
+		++uzPos;
+		u32Node = AddNode({ .vecSub { u32Node }, .u32Min { u32Min }, .u32Max { u32Max }, .eNode { ENode::NODE_REPEAT } });
+	}
+
+	return u32Node;
+}
+
+auto CHexDlgSearch::CreateRegexSearch(SpanCByte spnRegex)->std::optional<REGEXSEARCH>
+{
+	//The regex is parsed into the NFA, and the NFA into the anchored DFA by the subset construction,
+	//so that the matching is one table lookup per data byte, without any backtracking.
+	//Byte classes keep the table small: bytes that are in the same regex sets are of the same class.
+	constexpr auto uzDFAStatesMax { 0x10000U };
+	using enum REGEXPARSER::ENode;
+	REGEXPARSER stParser { .spnRegex { spnRegex } };
+	const auto u32Root = stParser.Parse();
+	if (stParser.fError) {
+		ut::DBG_REPORT(L"Regex is wrong.");
+		return std::nullopt;
+	}
+
+	const auto [ullSizeMin, ullSizeMax] = stParser.GetSizeMinMax(u32Root);
+	if (ullSizeMin == 0) {
+		ut::DBG_REPORT(L"Regex matches the empty data.");
+		return std::nullopt;
+	}
+
+	auto& vecNFA = stParser.vecNFA;
+	vecNFA.emplace_back(); //NFA state 0 is the match state.
+	const auto u32NFAStart = stParser.Compile(u32Root, 0);
+	if (stParser.fError) {
+		ut::DBG_REPORT(L"Regex is too big.");
+		return std::nullopt;
+	}
+
+	REGEXSEARCH stRegex;
+	stRegex.dwMaxSize = static_cast<DWORD>((std::min)(ullSizeMax, static_cast<ULONGLONG>(m_uSearchSizeLimit)));
+
+	DWORD dwClasses { 1 };
+	for (const auto& refNode : stParser.vecNodes) {
+		if (refNode.eNode != NODE_SET)
+			continue;
+
+		//Every class is split in two: bytes that are in the set, and bytes that are not.
+		std::vector<std::int32_t> vecSplit(static_cast<std::size_t>(dwClasses) * 2, -1);
+		DWORD dwClassesNew { };
+		for (auto i = 0U; i < 256U; ++i) {
+			auto& refClass = vecSplit[stRegex.arrClass[i] * 2U + (refNode.bsSet.test(i) ? 1U : 0U)];
+			if (refClass < 0) {
+				refClass = static_cast<std::int32_t>(dwClassesNew++);
+			}
+			stRegex.arrClass[i] = static_cast<std::uint16_t>(refClass);
+		}
+		dwClasses = dwClassesNew;
+	}
+	stRegex.dwClasses = dwClasses;
+
+	std::uint8_t arrClassByte[256] { }; //Any byte of a class.
+	for (auto i = 0U; i < 256U; ++i) {
+		arrClassByte[stRegex.arrClass[i]] = static_cast<std::uint8_t>(i);
+	}
+
+	//DFA state is the sorted set of the NFA states that match a byte, and the match state.
+	const auto lmbClosure = [&vecNFA](std::vector<std::uint32_t> vecStack) {
+		std::vector<bool> vecSeen(vecNFA.size());
+		std::vector<std::uint32_t> vecSet;
+		while (!vecStack.empty()) {
+			const auto u32State = vecStack.back();
+			vecStack.pop_back();
+			if (vecSeen[u32State])
+				continue;
+
+			vecSeen[u32State] = true;
+			const auto& refState = vecNFA[u32State];
+			if (u32State == 0 || refState.u32Node != REGEXPARSER::u32None) {
+				vecSet.emplace_back(u32State);
+			}
+			vecStack.insert(vecStack.end(), refState.vecEps.begin(), refState.vecEps.end());
+		}
+		std::sort(vecSet.begin(), vecSet.end());
+		return vecSet;
+		};
+
+	std::map<std::vector<std::uint32_t>, std::uint32_t> mapStates { { { }, 0 } }; //State 0 is the dead state.
+	std::vector<std::vector<std::uint32_t>> vecStates(1);
+	const auto lmbState = [&](std::vector<std::uint32_t>&& vecSet) {
+		const auto [it, fNew] = mapStates.try_emplace(vecSet, static_cast<std::uint32_t>(vecStates.size()));
+		if (fNew) {
+			vecStates.emplace_back(std::move(vecSet));
+		}
+		return it->second;
+		};
+	stRegex.u32Start = lmbState(lmbClosure({ u32NFAStart }));
+
+	auto& vecTrans = stRegex.vecTrans;
+	for (std::size_t itState = 0; itState < vecStates.size(); ++itState) {
+		if (vecStates.size() > uzDFAStatesMax) {
+			ut::DBG_REPORT(L"Regex is too complex.");
+			return std::nullopt;
+		}
+
+		const auto vecSet = vecStates[itState]; //Copy, the vecStates grows.
+		vecTrans.resize(vecTrans.size() + dwClasses, 0);
+		for (auto itClass = 0U; itClass < dwClasses; ++itClass) {
+			std::vector<std::uint32_t> vecNext;
+			for (const auto u32State : vecSet) {
+				if (const auto& refState = vecNFA[u32State]; refState.u32Node != REGEXPARSER::u32None
+					&& stParser.vecNodes[refState.u32Node].bsSet.test(arrClassByte[itClass])) {
+					vecNext.emplace_back(refState.u32Next);
+				}
+			}
+			if (!vecNext.empty()) {
+				vecTrans[itState * dwClasses + itClass] = lmbState(lmbClosure(std::move(vecNext)));
+			}
+		}
+	}
+
+	for (auto& u32Next : vecTrans) {
+		if (!vecStates[u32Next].empty() && vecStates[u32Next].front() == 0) { //The match state is always the first.
+			u32Next |= REGEXSEARCH::u32FlagMatch;
+		}
+	}
+
+	//Literal prefix: leading sets of a single byte.
+	const auto& refRoot = stParser.vecNodes[u32Root];
+	const auto spnLeading = refRoot.eNode == NODE_CAT ? std::span<const std::uint32_t> { refRoot.vecSub }
+		: std::span<const std::uint32_t> { &u32Root, 1 };
+	for (const auto u32Node : spnLeading) {
+		const auto& refNode = stParser.vecNodes[u32Node];
+		if (refNode.eNode != NODE_SET || refNode.bsSet.count() != 1)
+			break;
+
+		auto uzByte { 0U };
+		while (!refNode.bsSet.test(uzByte)) { ++uzByte; }
+		stRegex.vecPrefix.emplace_back(static_cast<std::byte>(uzByte));
+	}
+
+	//Bytes that move the DFA out of the start state.
+	std::vector<std::uint8_t> vecFirstBytes;
+	for (auto i = 0U; i < 256U; ++i) {
+		if (vecTrans[stRegex.u32Start * dwClasses + stRegex.arrClass[i]] != 0) {
+			vecFirstBytes.emplace_back(static_cast<std::uint8_t>(i));
+		}
+	}
+	stRegex.stFirstBytes = simd::MakeNibbleSet(vecFirstBytes);
+	stRegex.fPrefilter = vecFirstBytes.size() <= 64; //With too many first bytes the prefilter is mostly a waste.
+
+	return stRegex;
+}
+
+auto CHexDlgSearch::FindAllMT(const SEARCHFUNCDATA& sfd, PtrSearchFunc pSearchFunc, IHexSearchResult* pHexSearchRes,
+	DWORD dwLimit, DWORD dwThreads)->ULONGLONG
+{
+	//The search range is split into shards of equal size, aligned to the search step.
+	//Every shard's data overlaps the next shard's data by (search data size - 1) bytes,
+	//so that occurrences crossing the shards' boundaries are not lost.
+	//Worker threads take shards in ascending order, and results are delivered from the calling thread in the same order,
+	//shard by shard, in batches. Workers are never more than a few shards ahead of the delivery, so only these shards'
+	//results are in memory, and the receiver's false stops the workers right away.
+	//This method is only for the non Virtual data mode, where GetData can be called concurrently.
+	assert(pSearchFunc != nullptr);
+	assert(!sfd.pHexCtrl->IsVirtual());
+
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
+	if (uzSizeSearch == 0 || ullStep == 0 || dwLimit == 0 || sfd.ullStartFrom + uzSizeSearch > ullSentinel)
+		return { };
+
+	constexpr auto ullSizeShard { 1024ULL * 1024ULL * 16ULL }; //16MB.
+	const auto ullLastOffset = ullSentinel - uzSizeSearch; //The last offset search can start from.
+	const auto ullStepsTotal = (ullLastOffset - sfd.ullStartFrom) / ullStep + 1;
+	const auto ullStepsInShard = (std::max)(ullSizeShard / ullStep, 1ULL);
+	const auto ullShards = ullStepsTotal / ullStepsInShard + ((ullStepsTotal % ullStepsInShard) > 0 ? 1 : 0);
+	const auto dwThreadsMax = dwThreads > 0 ? dwThreads : (std::max)(std::thread::hardware_concurrency(), 1U);
+	const auto ullThreads = (std::min)(static_cast<ULONGLONG>(dwThreadsMax), ullShards);
+	const auto pDlgProg = sfd.pDlgProg;
+
+	const auto ullShardsAhead = ullThreads * 2; //How far the workers can go ahead of the delivery.
+	std::vector<VecSearchResult> vecShardsRes(static_cast<std::size_t>(ullShards));
+	std::vector<std::atomic<bool>> vecShardsDone(static_cast<std::size_t>(ullShards));
+	std::atomic<ULONGLONG> atomShardNext { 0 };  //Next shard to take.
+	std::atomic<ULONGLONG> atomShardDeliv { 0 }; //Next shard to deliver.
+	std::atomic<ULONGLONG> atomFound { 0 };      //Total found occurrences.
+	std::atomic<ULONGLONG> atomDone { 0 };       //Bytes processed, for the progress dialog.
+	std::atomic<ULONGLONG> atomWorkers { ullThreads }; //Workers still running.
+	std::atomic<ULONGLONG> atomEvents { 0 };     //Shards done and workers finished, to wake the calling thread.
+	std::atomic<bool> atomStop { false };        //The limit is reached, or the receiver returned false.
+	const auto lmbStop = [&]() { return atomStop.load() || (pDlgProg != nullptr && pDlgProg->IsCanceled()); };
+	const auto lmbEvent = [&]() { ++atomEvents; atomEvents.notify_one(); };
+	const auto lmbWorker = [&]() {
+		while (true) {
+			//Shards are taken in order, so when the limit is reached every shard before the next one
+			//is already taken, and all the further shards can be safely skipped.
+			if (atomFound.load() >= dwLimit || lmbStop())
+				break;
+
+			const auto ullShard = atomShardNext++;
+			if (ullShard >= ullShards)
+				break;
+
+			while (ullShard >= atomShardDeliv.load() + ullShardsAhead && !lmbStop()) { //Waiting for the delivery.
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			if (lmbStop())
+				break;
+
+			const auto ullShardFirst = sfd.ullStartFrom + ullShard * ullStepsInShard * ullStep;
+			const auto ullShardLast = (std::min)(ullShardFirst + (ullStepsInShard - 1) * ullStep, ullLastOffset);
+			auto sfdShard = sfd;
+			sfdShard.pDlgProg = nullptr;
+			sfdShard.ullStartFrom = ullShardFirst;
+			sfdShard.ullRngEnd = ullShardLast + uzSizeSearch - 1; //Overlap with the next shard.
+
+			auto& vecRes = vecShardsRes[static_cast<std::size_t>(ullShard)];
+			while (true) {
+				CalcMemChunks(sfdShard);
+				const auto findRes = pSearchFunc(sfdShard);
+				if (!findRes)
+					break;
+
+				vecRes.emplace_back(findRes.ullOffset);
+				const auto ullNext = findRes.ullOffset + ullStep;
+				if (ullNext > ullShardLast || vecRes.size() >= dwLimit || lmbStop())
+					break;
+
+				sfdShard.ullStartFrom = ullNext;
+			}
+
+			atomFound += vecRes.size();
+			atomDone += (ullShardLast - ullShardFirst) + 1;
+			vecShardsDone[static_cast<std::size_t>(ullShard)].store(true);
+			lmbEvent();
+		}
+		--atomWorkers;
+		lmbEvent();
+		};
+
+	std::vector<std::thread> vecThreads;
+	vecThreads.reserve(static_cast<std::size_t>(ullThreads));
+	for (auto itThread { 0ULL }; itThread < ullThreads; ++itThread) {
+		vecThreads.emplace_back(lmbWorker);
+	}
+
+	//Results and progress are published from this thread only, every time a shard is done.
+	constexpr auto uzSizeBatch { 1024U };
+	ULONGLONG ullDelivered { };
+	const auto lmbDeliver = [&]() {
+		for (auto ullShard = atomShardDeliv.load(); ullShard < ullShards && !atomStop.load()
+			&& vecShardsDone[static_cast<std::size_t>(ullShard)].load(); ++ullShard) {
+			auto& vecRes = vecShardsRes[static_cast<std::size_t>(ullShard)];
+			const auto uzToAdd = static_cast<std::size_t>((std::min)(static_cast<ULONGLONG>(vecRes.size()), dwLimit - ullDelivered));
+			for (std::size_t uzBatch { 0 }; uzBatch < uzToAdd && !atomStop.load(); uzBatch += uzSizeBatch) {
+				const auto uzSize = (std::min)(static_cast<std::size_t>(uzSizeBatch), uzToAdd - uzBatch);
+				ullDelivered += uzSize;
+				if (pHexSearchRes != nullptr && !pHexSearchRes->OnHexSearchResult({ vecRes.data() + uzBatch, uzSize }, { })) {
+					atomStop = true;
+				}
+			}
+
+			VecSearchResult { }.swap(vecRes); //Shard's memory is freed as soon as it's delivered.
+			if (ullDelivered >= dwLimit) {
+				atomStop = true;
+			}
+			atomShardDeliv = ullShard + 1;
+		}
+
+		if (pDlgProg != nullptr) {
+			pDlgProg->SetCurrent(sfd.ullStartFrom + atomDone.load());
+			pDlgProg->SetCount(ullDelivered);
+		}
+		};
+
+	while (true) {
+		const auto ullEvents = atomEvents.load();
+		lmbDeliver();
+		if (atomWorkers.load() == 0)
+			break;
+
+		atomEvents.wait(ullEvents); //Until a shard is done or a worker is finished.
+	}
+
+	for (auto& thrd : vecThreads) {
+		thrd.join();
+	}
+	lmbDeliver();
+
+	return ullDelivered;
+}
+
+auto CHexDlgSearch::GetKernels()->const KERNELS&
+{
+	//The tier is chosen once, at the first use, and every search goes through its function pointers.
+	//Only the forward search functions have the VECTOR_512 tier, the Hamming, multi-pattern, and regex
+	//kernels, and the backward search functions, work with the 32-bit masks and are VECTOR_256 at most.
+	static const auto stKernels = []()->KERNELS {
+		using enum simd::EVecType;
+		switch (simd::GetVectorTypeMax()) {
+		case VECTOR_512:
+		{
+			auto stKern = MakeKernels<VECTOR_256>();
+			stKern.arrGetFuncFwd[0] = GetSearchFuncVec512<false>;
+			stKern.arrGetFuncFwd[1] = GetSearchFuncVec512<true>;
+			return stKern;
+		}
+		case VECTOR_256:
+			return MakeKernels<VECTOR_256>();
+		case VECTOR_128:
+		default:
+			return MakeKernels<VECTOR_128>();
+		}
+		}();
+
+	return stKernels;
+}
+
+auto CHexDlgSearch::GetSearchFunc(const HEXSEARCH& hss, bool fDlgProg)->PtrSearchFunc
+{
+	const auto& refKern = GetKernels();
+	const auto iDlgProg = fDlgProg ? 1 : 0;
+	return hss.eSearchMode != EHexSearchMode::SEARCH_BACKWARD ? refKern.arrGetFuncFwd[iDlgProg](hss) :
+		refKern.arrGetFuncBack[iDlgProg](hss);
+}
+
+template<bool fDlgProg, simd::EVecType eVecType>
+auto CHexDlgSearch::GetSearchFuncFwd(const HEXSEARCH& hss)->PtrSearchFunc
+{
+	//The `fDlgProg` arg ensures that no runtime check will be performed for the 
+	//'SEARCHFUNCDATA::pDlgProg == nullptr', at the hot path inside the SearchFunc function.
+
+	using enum EHexSearchType; using enum EMemCmp;
+
+	if (!hss.spnFindTo.empty()) { //Special case for search in numbers range (e.g. -1:15).
+		return hss.fBigEndian ? GetSearchFuncRng<fDlgProg, eVecType, true, true>(hss) :
+			GetSearchFuncRng<fDlgProg, eVecType, true, false>(hss);
+	}
+
+	//If search step is 1 and data size is 1, 2, or 4 bytes, we can vectorize it for any search mode.
+	//Even for text. Except when it is a wildcard search, or if the Match-case is unchecked,
+	//which means that we must lower-case all search data beforehead.
+	if (hss.ullStep == 1 && !hss.fWildcard && hss.fMatchCase) {
+		switch (hss.spnFind.size()) {
+		case 1: //Special case for 1 byte data size SIMD.
+			return hss.fInverted ?
+				SearchFwdVec1<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVec1<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false)>;
+		case 2: //Special case for 2 bytes data size SIMD.
+			return hss.fInverted ?
+				SearchFwdVec2<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVec2<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false)>;
+		case 4: //Special case for 4 bytes data size SIMD.
+			return hss.fInverted ?
+				SearchFwdVec4<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVec4<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false)>;
+		default: //Data of any other size, up to the m_uSearchSizeLimit, is vectorized through the candidates filter.
+			if (!hss.fInverted) {
+				return SearchFwdVecN<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false, false)>;
+			}
+			break;
+		};
+	}
+
+	//Data of 1, 2, 4, or 8 bytes with the steps of 2, 4, 8, or 16 bytes is vectorized through the step mask.
+	if (IsVecStep(hss.ullStep) && !hss.fWildcard && hss.fMatchCase) {
+		switch (hss.spnFind.size()) {
+		case 1:
+			return hss.fInverted ?
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false)>;
+		case 2:
+			return hss.fInverted ?
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false)>;
+		case 4:
+			return hss.fInverted ?
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false)>;
+		case 8:
+			return hss.fInverted ?
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, true)> :
+				SearchFwdVecStep<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false)>;
+		default:
+			break;
+		};
+	}
+
+	//Case insensitive and wildcard texts are vectorized with the case folding and the wildcards mask.
+	if (hss.ullStep == 1 && !hss.fInverted && (hss.fWildcard || !hss.fMatchCase)) {
+		switch (hss.eSearchType) {
+		case HEXBYTES:
+			return SearchFwdVecText<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
+		case TEXT_ASCII:
+			if (hss.fMatchCase) {
+				return SearchFwdVecText<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
+			}
+
+			return hss.fWildcard ?
+				SearchFwdVecText<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)> :
+				SearchFwdVecText<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
+		case TEXT_UTF16:
+			if (hss.fMatchCase) {
+				return SearchFwdVecText<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)>;
+			}
+
+			return hss.fWildcard ?
+				SearchFwdVecText<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)> :
+				SearchFwdVecText<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
+		default:
+			break;
+		}
+	}
+
+	switch (hss.eSearchType) {
+	case HEXBYTES:
+		return hss.fWildcard ?
+			SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
+			SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+	case TEXT_ASCII:
+		if (hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+		}
+
+		if (hss.fMatchCase && hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
+		}
+
+		if (!hss.fMatchCase && hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)>;
+		}
+
+		if (!hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
+		}
+		break;
+	case TEXT_UTF8:
+		//Search UTF-8 as plain chars, with Match-case=true.
+		return SearchTextFwd<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+	case TEXT_UTF16:
+		if (hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, false)>;
+		}
+
+		if (hss.fMatchCase && hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)>;
+		}
+
+		if (!hss.fMatchCase && hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)>;
+		}
+
+		if (!hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextFwd<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
+		}
+		break;
+	//All numerics, including floats, are searched as plain unsigned data of respective size.
+	case NUM_INT8:
+	case NUM_UINT8:
+		return SearchNumFwd<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
+	case NUM_INT16:
+	case NUM_UINT16:
+		return SearchNumFwd<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
+	case NUM_INT32:
+	case NUM_UINT32:
+	case NUM_FLOAT:
+		return SearchNumFwd<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
+	case NUM_INT64:
+	case NUM_UINT64:
+	case NUM_DOUBLE:
+	case STRUCT_FILETIME:
+		return SearchNumFwd<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
+	default:
+		break;
+	}
+
+	return { };
+}
+
+template<bool fDlgProg>
+auto CHexDlgSearch::GetSearchFuncVec512(const HEXSEARCH& hss)->PtrSearchFunc
+{
+	//Only the 1, 2, and 4 bytes forward search functions have the VECTOR_512 tier,
+	//all other kernels work with the 32-bit masks and are VECTOR_256 at most.
+	using enum EHexSearchType; using enum EMemCmp; using enum simd::EVecType;
+
+	if (!hss.spnFindTo.empty() || hss.ullStep != 1 || hss.fWildcard || !hss.fMatchCase)
+		return GetSearchFuncFwd<fDlgProg, VECTOR_256>(hss);
+
+	switch (hss.spnFind.size()) {
+	case 1:
+		return hss.fInverted ?
+			SearchFwdVec1<SEARCHTYPE(DATA_UINT8, VECTOR_512, fDlgProg, false, false, true)> :
+			SearchFwdVec1<SEARCHTYPE(DATA_UINT8, VECTOR_512, fDlgProg, false, false, false)>;
+	case 2:
+		return hss.fInverted ?
+			SearchFwdVec2<SEARCHTYPE(DATA_UINT16, VECTOR_512, fDlgProg, false, false, true)> :
+			SearchFwdVec2<SEARCHTYPE(DATA_UINT16, VECTOR_512, fDlgProg, false, false, false)>;
+	case 4:
+		return hss.fInverted ?
+			SearchFwdVec4<SEARCHTYPE(DATA_UINT32, VECTOR_512, fDlgProg, false, false, true)> :
+			SearchFwdVec4<SEARCHTYPE(DATA_UINT32, VECTOR_512, fDlgProg, false, false, false)>;
+	default:
+		return GetSearchFuncFwd<fDlgProg, VECTOR_256>(hss);
+	}
+}
+
+template<simd::EVecType eVecType>
+auto CHexDlgSearch::MakeKernels()->KERNELS
+{
+	return { .arrGetFuncFwd { GetSearchFuncFwd<false, eVecType>, GetSearchFuncFwd<true, eVecType> },
+		.arrGetFuncBack { GetSearchFuncBack<false, eVecType>, GetSearchFuncBack<true, eVecType> },
+		.pSearchHamming { SearchHammingFwd<eVecType> }, .pSearchMulti { SearchMultiFwd<eVecType> },
+		.pSearchRegex { SearchRegexFwd<eVecType> } };
+}
+
+template<bool fDlgProg, simd::EVecType eVecType>
+auto CHexDlgSearch::GetSearchFuncBack(const HEXSEARCH& hss)->PtrSearchFunc
+{
+	//The `fDlgProg` arg ensures that no runtime check will be performed for the 
+	//'SEARCHFUNCDATA::pDlgProg == nullptr', at the hot path inside the SearchFunc function.
+
+	using enum EHexSearchType; using enum EMemCmp;
+
+	if (!hss.spnFindTo.empty()) { //Special case for search in numbers range (e.g. -1:15).
+		return hss.fBigEndian ? GetSearchFuncRng<fDlgProg, eVecType, false, true>(hss) :
+			GetSearchFuncRng<fDlgProg, eVecType, false, false>(hss);
+	}
+
+	//If search step is 1, numbers of any size and not inverted texts are vectorized.
+	if (hss.ullStep == 1) {
+		switch (hss.eSearchType) {
+		case HEXBYTES:
+			if (hss.fInverted)
+				break;
+
+			return hss.fWildcard ?
+				SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+		case TEXT_ASCII:
+			if (hss.fInverted)
+				break;
+
+			if (hss.fMatchCase) {
+				return hss.fWildcard ?
+					SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
+					SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+			}
+
+			return hss.fWildcard ?
+				SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
+		case TEXT_UTF8:
+			if (hss.fInverted)
+				break;
+
+			return SearchBackVec<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+		case TEXT_UTF16:
+			if (hss.fInverted)
+				break;
+
+			if (hss.fMatchCase) {
+				return hss.fWildcard ?
+					SearchBackVec<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)> :
+					SearchBackVec<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, false)>;
+			}
+
+			return hss.fWildcard ?
+				SearchBackVec<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
+		case NUM_INT8:
+		case NUM_UINT8:
+			return hss.fInverted ?
+				SearchBackVec<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false)>;
+		case NUM_INT16:
+		case NUM_UINT16:
+			return hss.fInverted ?
+				SearchBackVec<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false)>;
+		case NUM_INT32:
+		case NUM_UINT32:
+		case NUM_FLOAT:
+			return hss.fInverted ?
+				SearchBackVec<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false)>;
+		case NUM_INT64:
+		case NUM_UINT64:
+		case NUM_DOUBLE:
+		case STRUCT_FILETIME:
+			return hss.fInverted ?
+				SearchBackVec<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVec<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false)>;
+		default:
+			break;
+		}
+	}
+
+	//Data of 1, 2, 4, or 8 bytes with the steps of 2, 4, 8, or 16 bytes is vectorized through the step mask.
+	if (IsVecStep(hss.ullStep) && !hss.fWildcard && hss.fMatchCase) {
+		switch (hss.spnFind.size()) {
+		case 1:
+			return hss.fInverted ?
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false)>;
+		case 2:
+			return hss.fInverted ?
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false)>;
+		case 4:
+			return hss.fInverted ?
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false)>;
+		case 8:
+			return hss.fInverted ?
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, true)> :
+				SearchBackVecStep<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false)>;
+		default:
+			break;
+		};
+	}
+
+	switch (hss.eSearchType) {
+	case HEXBYTES:
+		return hss.fWildcard ?
+			SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)> :
+			SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+	case TEXT_ASCII:
+		if (hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>;
+		}
+
+		if (hss.fMatchCase && hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, true)>;
+		}
+
+		if (!hss.fMatchCase && hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, true)>;
+		}
+
+		if (!hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, false, false)>;
+		}
+		break;
+	case TEXT_UTF8:
+		return SearchTextBack<SEARCHTYPE(DATA_ASCII, eVecType, fDlgProg, true, false)>; //Search UTF-8 as plain chars.
+	case TEXT_UTF16:
+		if (hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, false)>;
+		}
+
+		if (hss.fMatchCase && hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, true, true)>;
+		}
+
+		if (!hss.fMatchCase && hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, true)>;
+		}
+
+		if (!hss.fMatchCase && !hss.fWildcard) {
+			return SearchTextBack<SEARCHTYPE(DATA_WCHAR, eVecType, fDlgProg, false, false)>;
+		}
+		break;
+	case NUM_INT8:
+	case NUM_UINT8:
+		return SearchNumBack<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg)>;
+	case NUM_INT16:
+	case NUM_UINT16:
+		return SearchNumBack<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg)>;
+	case NUM_INT32:
+	case NUM_UINT32:
+	case NUM_FLOAT:
+		return SearchNumBack<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg)>;
+	case NUM_INT64:
+	case NUM_UINT64:
+	case NUM_DOUBLE:
+	case STRUCT_FILETIME:
+		return SearchNumBack<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg)>;
+	default:
+		break;
+	}
+
+	return { };
+}
+
+template<bool fDlgProg, simd::EVecType eVecType, bool fFwd, bool fBigEndian>
+auto CHexDlgSearch::GetSearchFuncRng(const HEXSEARCH& hss)->PtrSearchFunc
+{
+	//Vectorized functions check numbers at all block's offsets at once, and mask out the offsets that are off the step.
+	using enum EHexSearchType; using enum EMemCmp;
+	const auto fVec = hss.ullStep == 1 || IsVecStep(hss.ullStep);
+
+	if constexpr (fFwd) {
+		switch (hss.eSearchType) {
+		case NUM_INT8: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT8: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT16: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT16: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT32: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT32: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT64: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT64: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_FLOAT: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_DOUBLE: return fVec ? SearchFwdVecRng<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngFwd<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		default:
+			assert(false); //Should never get here.
+			return nullptr;
+		}
+	}
+	else {
+		switch (hss.eSearchType) {
+		case NUM_INT8: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_INT8, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT8: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_UINT8, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT16: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_INT16, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT16: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_UINT16, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT32: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_INT32, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT32: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_UINT32, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_INT64: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_INT64, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_UINT64: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_UINT64, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_FLOAT: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_FLOAT, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		case NUM_DOUBLE: return fVec ? SearchBackVecRng<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg, false, false, false, fBigEndian)> :
+			SearchNumRngBack<SEARCHTYPE(DATA_DOUBLE, eVecType, fDlgProg, false, false, false, fBigEndian)>;
+		default:
+			assert(false); //Should never get here.
+			return nullptr;
+		}
+	}
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::MakeTextFilter(SpanCByte spnFind, std::byte bWildcard)->TEXTFILTER
+{
+	//Byte-wise lower-casing of the wchar data may only give more candidates, never less, because it's applied
+	//to both, the data and the search data bytes.
+	using enum EMemCmp;
+	constexpr auto fWchar = st.eMemCmp == DATA_WCHAR;
+	constexpr auto uCharSize = fWchar ? sizeof(wchar_t) : sizeof(char);
+	const auto pDataSearch = spnFind.data();
+	const auto uzSizeSearch = spnFind.size();
+	assert(uzSizeSearch <= m_uSearchSizeLimit);
+
+	TEXTFILTER stFilter { .uzFirst { uzSizeSearch } };
+	for (std::size_t i { 0 }; i + uCharSize <= uzSizeSearch; i += uCharSize) {
+		if constexpr (st.fWildcard) {
+			const auto fWC = fWchar ? *reinterpret_cast<const wchar_t*>(pDataSearch + i) == static_cast<wchar_t>(bWildcard)
+				: pDataSearch[i] == bWildcard;
+			if (fWC) {
+				std::fill_n(stFilter.arrWCMask + i, uCharSize, std::byte { 0xFF });
+				continue;
+			}
+		}
+
+		stFilter.uzFirst = (std::min)(stFilter.uzFirst, i);
+		stFilter.uzLast = i + uCharSize - 1;
+	}
+
+	if (stFilter.uzFirst == uzSizeSearch) {
+		stFilter.fAnyOffset = true;
+		return stFilter;
+	}
+
+	const auto lmbToLower = [](std::byte byte) {
+		const auto u8Byte = std::to_integer<std::uint8_t>(byte);
+		return (!st.fMatchCase && u8Byte >= 'A' && u8Byte <= 'Z') ? static_cast<std::uint8_t>(u8Byte + 32) : u8Byte; };
+	stFilter.u8First = lmbToLower(pDataSearch[stFilter.uzFirst]);
+	stFilter.u8Last = lmbToLower(pDataSearch[stFilter.uzLast]);
+
+	return stFilter;
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+bool CHexDlgSearch::MemCmpEQNum(const std::byte* pWhere, const std::byte* pWhat)
+{
+	using enum EMemCmp;
+	if constexpr (st.eMemCmp == DATA_UINT8) {
+		return *reinterpret_cast<const std::uint8_t*>(pWhere) == *reinterpret_cast<const std::uint8_t*>(pWhat);
+	}
+	else if constexpr (st.eMemCmp == DATA_UINT16) {
+		return *reinterpret_cast<const std::uint16_t*>(pWhere) == *reinterpret_cast<const std::uint16_t*>(pWhat);
+	}
+	else if constexpr (st.eMemCmp == DATA_UINT32) {
+		return *reinterpret_cast<const std::uint32_t*>(pWhere) == *reinterpret_cast<const std::uint32_t*>(pWhat);
+	}
+	else if constexpr (st.eMemCmp == DATA_UINT64) {
+		return *reinterpret_cast<const std::uint64_t*>(pWhere) == *reinterpret_cast<const std::uint64_t*>(pWhat);
+	}
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::MemCmpEQNumRng(const std::byte* pWhere, const std::byte* pRngFrom, const std::byte* pRngTo)->bool
+{
+	using TNum = TMemCmpNum<st.eMemCmp>;
+	auto tWhere = *reinterpret_cast<const TNum*>(pWhere);
+	if constexpr (st.fBigEndian) {
+		tWhere = ut::ByteSwap(tWhere);
+	}
+
+	return tWhere >= *reinterpret_cast<const TNum*>(pRngFrom) && tWhere <= *reinterpret_cast<const TNum*>(pRngTo);
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::MemCmpEQText(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize, std::byte bWildcard)->bool
+{
+	using enum EMemCmp;
+	if constexpr (st.eMemCmp == DATA_ASCII) {
+		for (std::size_t i { 0 }; i < uzSize; ++i, ++pWhere, ++pWhat) {
+			if constexpr (st.fWildcard) {
+				if (*pWhat == bWildcard) //Checking for wildcard match.
+					continue;
+			}
+
+			if constexpr (!st.fMatchCase) {
+				auto ch = static_cast<char>(*pWhere);
+				if (ch >= 'A' && ch <= 'Z') { //If it's a capital letter.
+					ch += 32; //Lowering this letter ('a' - 'A' = 32).
+				}
+
+				if (ch != static_cast<char>(*pWhat))
+					return false;
+			}
+			else {
+				if (*pWhere != *pWhat)
+					return false;
+			}
+		}
+		return true;
+	}
+	else if constexpr (st.eMemCmp == DATA_WCHAR) {
+		auto pWhereWch = reinterpret_cast<const wchar_t*>(pWhere);
+		auto pWhatWch = reinterpret_cast<const wchar_t*>(pWhat);
+		for (std::size_t i { 0 }; i < (uzSize / sizeof(wchar_t)); ++i, ++pWhereWch, ++pWhatWch) {
+			if constexpr (st.fWildcard) {
+				if (*pWhatWch == static_cast<wchar_t>(bWildcard)) //Checking for wildcard match.
+					continue;
+			}
+
+			if constexpr (!st.fMatchCase) {
+				auto wch = *pWhereWch;
+				if (wch >= 'A' && wch <= 'Z') { //If it's a capital letter.
+					wch += 32; //Lowering this letter ('a' - 'A' = 32).
+				}
+
+				if (wch != *pWhatWch)
+					return false;
+			}
+			else {
+				if (*pWhereWch != *pWhatWch)
+					return false;
+			}
+		}
+		return true;
+	}
+}
+
+void CHexDlgSearch::Replace(IHexCtrl* pHexCtrl, ULONGLONG ullIndex, SpanCByte spnReplace)
+{
+	pHexCtrl->ModifyData({ .eModifyMode { EHexModifyMode::MODIFY_ONCE }, .spnData { spnReplace },
+		.vecSpan { { ullIndex, spnReplace.size() } } });
+}
+
+void CHexDlgSearch::Replace(IHexCtrl* pHexCtrl, const VecSearchResult& vecOffsets, SpanCByte spnReplace)
+{
+	if (vecOffsets.empty())
+		return;
+
+	VecHexSpan vecSpan;
+	vecSpan.reserve(vecOffsets.size());
+	for (const auto ullOffset : vecOffsets) {
+		vecSpan.emplace_back(ullOffset, spnReplace.size());
+	}
+	pHexCtrl->ModifyData({ .eModifyMode { EHexModifyMode::MODIFY_ONCE }, .spnData { spnReplace },
+		.vecSpan { std::move(vecSpan) } });
+}
+
+void CHexDlgSearch::MYERSSEARCH::Advance(std::uint8_t u8Byte, int iHin)
+{
+	for (auto itWord = 0U; itWord < u32Words; ++itWord) {
+		const auto u64High = itWord == u32Words - 1 ? u64HighBit : 1ULL << 63;
+		const auto u64Pv = arrPv[itWord];
+		const auto u64Mv = arrMv[itWord];
+		auto u64Eq = arrPeq[u8Byte][itWord];
+		const auto u64Xv = u64Eq | u64Mv;
+		if (iHin < 0) {
+			u64Eq |= 1;
+		}
+		const auto u64Xh = (((u64Eq & u64Pv) + u64Pv) ^ u64Pv) | u64Eq;
+		auto u64Ph = u64Mv | ~(u64Xh | u64Pv);
+		auto u64Mh = u64Pv & u64Xh;
+		const auto iHout = (u64Ph & u64High) != 0 ? 1 : ((u64Mh & u64High) != 0 ? -1 : 0);
+		u64Ph <<= 1;
+		u64Mh <<= 1;
+		if (iHin < 0) {
+			u64Mh |= 1;
+		}
+		else if (iHin > 0) {
+			u64Ph |= 1;
+		}
+		arrPv[itWord] = u64Mh | ~(u64Xv | u64Ph);
+		arrMv[itWord] = u64Ph & u64Xv;
+		iHin = iHout;
+	}
+	iScore += iHin;
+}
+
+void CHexDlgSearch::MYERSSEARCH::Reset()
+{
+	std::fill_n(arrPv, u32Words, ~0ULL); //The first column: i edits for the i pattern bytes.
+	std::fill_n(arrMv, u32Words, 0ULL);
+	iScore = static_cast<int>(u32Size);
+}
+
+auto CHexDlgSearch::SearchEditFwd(const HEXSEARCH& hss, IHexCtrl* pHexCtrl, ULONGLONG ullRngEnd)->ULONGLONG
+{
+	//Myers' algorithm goes over the data once, giving for every end offset the least edit distance to the pattern
+	//of the data ending there, and starting past the previous match. Once it's no more than k edits, the end offset
+	//is moved on while the distance goes down, to the match's best end. The match's start is found from that end
+	//backwards, by the anchored Myers of the reversed pattern, over no more than (size + k) bytes: the start offset
+	//on the step of the least edits, of the shortest data. The search goes on from past the match's end, so the
+	//matches don't overlap. Chunks are read with the (size + k) bytes before their first end offsets.
+	constexpr auto uzSizeBatch { 1024U }; //Results are delivered to the receiver in batches of this size.
+	const auto ullStep = hss.ullStep;
+	const auto ullSizeFind = static_cast<ULONGLONG>(hss.spnFind.size());
+	const auto ullMaxErrors = static_cast<ULONGLONG>(hss.dwMaxErrors);
+	const auto iMaxErrors = static_cast<int>(hss.dwMaxErrors);
+	const auto ullSizeBefore = ullSizeFind + ullMaxErrors;
+	const auto ullSizeTotal = ullRngEnd - hss.ullStartFrom + 1;
+	const auto ullChunkEnds = pHexCtrl->IsVirtual() ? (std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize())
+		- ullSizeBefore, ullSizeTotal) : ullSizeTotal; //End offsets in one chunk.
+	const auto dwLimit = hss.eSearchMode != EHexSearchMode::SEARCH_ALL ? 1UL :
+		(hss.dwLimit > 0 ? hss.dwLimit : (std::numeric_limits<DWORD>::max)());
+
+	const auto pMyers = std::make_unique<MYERSSEARCH>();
+	auto& refMyers = *pMyers;
+	refMyers.u32Size = static_cast<std::uint32_t>(ullSizeFind);
+	refMyers.u32Words = static_cast<std::uint32_t>((ullSizeFind + 63) / 64);
+	refMyers.u64HighBit = 1ULL << ((ullSizeFind - 1) % 64);
+	const auto pBack = std::make_unique<MYERSSEARCH>(refMyers); //Reversed pattern, for the matches' starts.
+	auto& refBack = *pBack;
+	for (auto i = 0U; i < refMyers.u32Size; ++i) {
+		refMyers.arrPeq[std::to_integer<std::uint8_t>(hss.spnFind[i])][i / 64] |= 1ULL << (i % 64);
+		refBack.arrPeq[std::to_integer<std::uint8_t>(hss.spnFind[refMyers.u32Size - 1 - i])][i / 64] |= 1ULL << (i % 64);
+	}
+	refMyers.Reset();
+
+	VecSearchResult vecBatch;
+	std::vector<DWORD> vecBatchSize;
+	vecBatch.reserve(uzSizeBatch);
+	vecBatchSize.reserve(uzSizeBatch);
+	ULONGLONG ullCount { };
+	ULONGLONG ullStartMin { hss.ullStartFrom }; //Matches start from here, past the previous match's end.
+	ULONGLONG ullEndBest { };                   //Best end offset of the match being found.
+	auto iScoreBest = iMaxErrors + 1;           //Its edit distance, above the k while there is no such match.
+	bool fStop { false };
+
+	//Reports the match ending at the ullEndBest, from its best start offset, if there is one on the step.
+	const auto lmbReport = [&](const std::byte* pData, ULONGLONG ullOffsetChunk) {
+		const auto ullSizeMax = (std::min)(ullSizeFind + ullMaxErrors, ullEndBest - ullStartMin + 1);
+		auto iScoreMin = iMaxErrors + 1;
+		ULONGLONG ullSizeMatch { };
+		refBack.Reset();
+		for (ULONGLONG ullSize { 1 }; ullSize <= ullSizeMax; ++ullSize) {
+			const auto ullStart = ullEndBest + 1 - ullSize;
+			refBack.Advance(std::to_integer<std::uint8_t>(pData[ullStart - ullOffsetChunk]), 1);
+			if (refBack.iScore < iScoreMin && (ullStart - hss.ullStartFrom) % ullStep == 0) {
+				iScoreMin = refBack.iScore;
+				ullSizeMatch = ullSize;
+			}
+		}
+
+		iScoreBest = iMaxErrors + 1;
+		if (ullSizeMatch == 0)
+			return false;
+
+		vecBatch.emplace_back(ullEndBest + 1 - ullSizeMatch);
+		vecBatchSize.emplace_back(static_cast<DWORD>(ullSizeMatch));
+		if (vecBatch.size() == uzSizeBatch) {
+			fStop = hss.pHexSearchRes != nullptr && !hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchSize);
+			vecBatch.clear();
+			vecBatchSize.clear();
+		}
+
+		if (++ullCount >= dwLimit) {
+			fStop = true;
+		}
+
+		ullStartMin = ullEndBest + 1;
+		return true;
+	};
+
+	const std::byte* pData { };
+	ULONGLONG ullOffsetChunk { };
+	for (auto ullEndFirst = hss.ullStartFrom; ullEndFirst <= ullRngEnd && !fStop; ullEndFirst += ullChunkEnds) {
+		const auto ullEndLast = (std::min)(ullEndFirst + ullChunkEnds - 1, ullRngEnd);
+		ullOffsetChunk = ullEndFirst - (std::min)(ullEndFirst - hss.ullStartFrom, ullSizeBefore);
+		pData = pHexCtrl->GetData({ ullOffsetChunk, ullEndLast - ullOffsetChunk + 1 }).data();
+		for (auto ullEnd = ullEndFirst; ullEnd <= ullEndLast && !fStop; ++ullEnd) {
+			const auto u8Byte = std::to_integer<std::uint8_t>(pData[ullEnd - ullOffsetChunk]);
+			refMyers.Advance(u8Byte, 0);
+			if (refMyers.iScore < iScoreBest) { //Within the k edits, and still going down.
+				ullEndBest = ullEnd;
+				iScoreBest = refMyers.iScore;
+				continue;
+			}
+
+			if (iScoreBest > iMaxErrors)
+				continue;
+
+			//The distance has stopped going down, the match ends at the ullEndBest.
+			if (lmbReport(pData, ullOffsetChunk)) {
+				refMyers.Reset();
+				refMyers.Advance(u8Byte, 0);
+			}
+
+			if (refMyers.iScore <= iMaxErrors) {
+				ullEndBest = ullEnd;
+				iScoreBest = refMyers.iScore;
+			}
+		}
+	}
+
+	if (!fStop && iScoreBest <= iMaxErrors) { //The match up to the range end, the last chunk's data is still valid.
+		lmbReport(pData, ullOffsetChunk);
+	}
+
+	if (hss.pHexSearchRes != nullptr && !vecBatch.empty()) {
+		hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchSize);
+	}
+
+	return ullCount;
+}
+
+template<simd::EVecType eVecType>
+auto CHexDlgSearch::SearchHammingFwd(const HEXSEARCH& hss, IHexCtrl* pHexCtrl, ULONGLONG ullRngEnd)->ULONGLONG
+{
+	//The sizeof(vec) offsets are checked at once, with the mismatches counted in the vector lanes,
+	//for the vectorized steps, and offset by offset for the others. Chunks overlap by the (size - 1) bytes.
+	constexpr auto uVecSize = simd::VecTypeToSize(eVecType);
+	constexpr auto uzSizeBatch { 1024U }; //Results are delivered to the receiver in batches of this size.
+	const auto pFind = hss.spnFind.data();
+	const auto uzSizeFind = hss.spnFind.size();
+	const auto ullSizeFind = static_cast<ULONGLONG>(uzSizeFind);
+	const auto u8MaxErrors = static_cast<std::uint8_t>(hss.dwMaxErrors);
+	const auto ullStep = hss.ullStep;
+	const auto fVec = ullStep == 1 || IsVecStep(ullStep);
+	const auto u32StepMask = fVec ? simd::StepMask(eVecType, static_cast<std::uint32_t>(ullStep)) : 0U;
+	const auto ullSizeTotal = ullRngEnd - hss.ullStartFrom + 1;
+	if (ullSizeTotal < ullSizeFind)
+		return { };
+
+	const auto ullChunkSize = pHexCtrl->IsVirtual() ?
+		(std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize()), ullSizeTotal) : ullSizeTotal;
+	const auto dwLimit = hss.eSearchMode != EHexSearchMode::SEARCH_ALL ? 1UL :
+		(hss.dwLimit > 0 ? hss.dwLimit : (std::numeric_limits<DWORD>::max)());
+	const auto vecSize = std::vector<DWORD>(uzSizeBatch, static_cast<DWORD>(uzSizeFind));
+
+	VecSearchResult vecBatch;
+	vecBatch.reserve(uzSizeBatch);
+	ULONGLONG ullCount { };
+	bool fStop { false };
+	const auto lmbFound = [&](ULONGLONG ullOffset) {
+		vecBatch.emplace_back(ullOffset);
+		if (vecBatch.size() == uzSizeBatch) {
+			fStop = hss.pHexSearchRes != nullptr && !hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecSize);
+			vecBatch.clear();
+		}
+
+		if (++ullCount >= dwLimit) {
+			fStop = true;
+		}
+		};
+
+	for (auto ullOffsetChunk = hss.ullStartFrom; !fStop;) {
+		const auto ullSizeChunk = (std::min)(ullChunkSize, ullRngEnd - ullOffsetChunk + 1);
+		const auto ullIdxEnd = ullSizeChunk - ullSizeFind + 1; //Offsets to check, the search data is whole within the chunk.
+		const auto pData = pHexCtrl->GetData({ ullOffsetChunk, ullSizeChunk }).data();
+		ULONGLONG ullIdx { 0 };
+		if (fVec) {
+			for (; ullIdx + uVecSize + ullSizeFind - 1 <= ullSizeChunk && !fStop; ullIdx += uVecSize) {
+				for (auto u32Mask = simd::HammingMask<eVecType>(pData + ullIdx, pFind, uzSizeFind, u8MaxErrors) & u32StepMask;
+					u32Mask != 0 && !fStop; u32Mask &= u32Mask - 1) {
+					lmbFound(ullOffsetChunk + ullIdx + std::countr_zero(u32Mask));
+				}
+			}
+		}
+
+		for (; ullIdx < ullIdxEnd && !fStop; ullIdx += ullStep) {
+			std::size_t uzErrors { 0 };
+			for (std::size_t i = 0; i < uzSizeFind && uzErrors <= u8MaxErrors; ++i) {
+				uzErrors += pData[ullIdx + i] != pFind[i] ? 1 : 0;
+			}
+
+			if (uzErrors <= u8MaxErrors) {
+				lmbFound(ullOffsetChunk + ullIdx);
+			}
+		}
+
+		//The next chunk starts at the first offset on the step that is not checked yet.
+		const auto ullNext = ullOffsetChunk + (ullIdxEnd + ullStep - 1) / ullStep * ullStep;
+		if (ullNext + ullSizeFind - 1 > ullRngEnd)
+			break;
+
+		ullOffsetChunk = ullNext;
+	}
+
+	if (hss.pHexSearchRes != nullptr && !vecBatch.empty()) {
+		hss.pHexSearchRes->OnHexSearchResult(vecBatch, { vecSize.data(), vecBatch.size() });
+	}
+
+	return ullCount;
+}
+
+template<simd::EVecType eVecType>
+auto CHexDlgSearch::SearchMultiFwd(const MULTISEARCH& stMulti, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+	ULONGLONG ullRngEnd)->ULONGLONG
+{
+	//Data is read chunk by chunk, only once, and the automaton's state is carried over the chunks' boundaries.
+	//While the automaton is in the root state, bytes that can't start any pattern are skipped with the vector prefilter.
+	constexpr auto u32FlagOut = MULTISEARCH::u32FlagOut;
+	constexpr auto uVecSize = simd::VecTypeToSize(eVecType);
+	constexpr auto uzSizeBatch { 1024U }; //Results are delivered to the receiver in batches of this size.
+	const auto ullStartFrom = hss.ullStartFrom;
+	const auto ullStep = hss.ullStep;
+	const auto ullSizeTotal = ullRngEnd - ullStartFrom + 1;
+	const auto ullChunkSize = pHexCtrl->IsVirtual() ?
+		(std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize()), ullSizeTotal) : ullSizeTotal;
+	const auto dwLimit = hss.dwLimit > 0 ? hss.dwLimit : (std::numeric_limits<DWORD>::max)();
+	const auto dwClasses = stMulti.dwClasses;
+	const auto pTrans = stMulti.vecTrans.data();
+	const auto fPrefilter = stMulti.fPrefilter;
+
+	VecSearchResult vecBatch;
+	std::vector<DWORD> vecBatchPatt;
+	vecBatch.reserve(uzSizeBatch);
+	vecBatchPatt.reserve(uzSizeBatch);
+	ULONGLONG ullCount { };
+	std::uint32_t u32State { 0 };
+	bool fStop { false };
+
+	for (auto ullOffsetChunk = ullStartFrom; ullOffsetChunk <= ullRngEnd && !fStop; ullOffsetChunk += ullChunkSize) {
+		const auto ullSizeChunk = (std::min)(ullChunkSize, ullRngEnd - ullOffsetChunk + 1);
+		const auto pData = pHexCtrl->GetData({ ullOffsetChunk, ullSizeChunk }).data();
+		for (ULONGLONG ullIdx { 0 }; ullIdx < ullSizeChunk; ++ullIdx) {
+			if (fPrefilter && u32State == 0) {
+				while (ullIdx + uVecSize <= ullSizeChunk) {
+					if (const auto ullFound = simd::FindFirstOf<eVecType>(pData + ullIdx, stMulti.stFirstBytes);
+						ullFound != 0xFFFFFFFFU) {
+						ullIdx += ullFound;
+						break;
+					}
+					ullIdx += uVecSize;
+				}
+
+				if (ullIdx >= ullSizeChunk)
+					break;
+			}
+
+			const auto u32Next = pTrans[u32State * dwClasses + stMulti.arrClass[std::to_integer<std::uint8_t>(pData[ullIdx])]];
+			u32State = u32Next & ~u32FlagOut;
+			if ((u32Next & u32FlagOut) == 0)
+				continue;
+
+			//Some patterns end at this byte.
+			const auto ullOffsetEnd = ullOffsetChunk + ullIdx + 1; //Non-dereferenceable.
+			for (auto itOut = stMulti.vecOutIdx[u32State]; itOut < stMulti.vecOutIdx[u32State + 1]; ++itOut) {
+				const auto dwPatt = stMulti.vecOutPatt[itOut];
+				const auto ullSizePatt = stMulti.vecPattSize[dwPatt];
+				if (ullOffsetEnd < ullStartFrom + ullSizePatt) //Pattern starts before the ullStartFrom.
+					continue;
+
+				const auto ullOffset = ullOffsetEnd - ullSizePatt;
+				if ((ullOffset - ullStartFrom) % ullStep != 0)
+					continue;
+
+				vecBatch.emplace_back(ullOffset);
+				vecBatchPatt.emplace_back(dwPatt);
+				if (vecBatch.size() == uzSizeBatch) {
+					fStop = hss.pHexSearchRes != nullptr && !hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchPatt);
+					vecBatch.clear();
+					vecBatchPatt.clear();
+				}
+
+				if (++ullCount >= dwLimit) {
+					fStop = true;
+				}
+
+				if (fStop)
+					break;
+			}
+
+			if (fStop)
+				break;
+		}
+	}
+
+	if (hss.pHexSearchRes != nullptr && !vecBatch.empty()) {
+		hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchPatt);
+	}
+
+	return ullCount;
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchNumFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom;
+
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
+			//First memory comparison is always unconditional.
+			if (MemCmpEQNum<st>(spnData.data() + ullOffsetData, pDataSearch) == !fInverted) {
+				return { ullOffsetSearch + ullOffsetData, true, false };
+			}
+
+			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
+			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
+				}
+			}
+			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
+			//The one less comparison is needed here, otherwise we would've hit the branch above.
+			else {
+				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
+					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch + ullStep) > ullEnd)
+				break; //Upper bound reached.
+
+			ullOffsetSearch += ullStep;
+		}
+		else {
+			ullOffsetSearch += ullChunkMaxOffset;
+		}
+
+		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
+			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
+			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		}
+	}
+
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchNumRngFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearchFrom = sfd.spnFindFrom.data();
+	const auto pDataSearchTo = sfd.spnFindTo.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom;
+
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
+			//First memory comparison is always unconditional.
+			if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+				return { ullOffsetSearch + ullOffsetData, true, false };
+			}
+
+			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
+			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
+				}
+			}
+			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
+			//The one less comparison is needed here, otherwise we would've hit the branch above.
+			else {
+				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
+					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch + ullStep) > ullEnd)
+				break; //Upper bound reached.
+
+			ullOffsetSearch += ullStep;
+		}
+		else {
+			ullOffsetSearch += ullChunkMaxOffset;
+		}
+
+		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
+			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
+			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		}
+	}
+
+	return { };
+}
+
+template<simd::EVecType eVecType>
+auto CHexDlgSearch::SearchRegexFwd(const REGEXSEARCH& stRegex, const HEXSEARCH& hss, IHexCtrl* pHexCtrl,
+	ULONGLONG ullRngEnd)->ULONGLONG
+{
+	//Every offset on the step, that can start a match, is matched with the anchored DFA for the longest match,
+	//up to the dwMaxSize. Matches don't overlap, after a match the search goes on from the first offset on the step
+	//past its end. Chunks overlap by the dwMaxSize - 1 bytes, so that every match is whole within a chunk.
+	//Offsets that can't start a match are skipped with the vector prefilter, and then with the literal prefix.
+	constexpr auto u32FlagMatch = REGEXSEARCH::u32FlagMatch;
+	constexpr auto uVecSize = simd::VecTypeToSize(eVecType);
+	constexpr auto uzSizeBatch { 1024U }; //Results are delivered to the receiver in batches of this size.
+	const auto ullStep = hss.ullStep;
+	const auto ullMaxSize = static_cast<ULONGLONG>(stRegex.dwMaxSize);
+	const auto ullSizeTotal = ullRngEnd - hss.ullStartFrom + 1;
+	const auto ullChunkSize = pHexCtrl->IsVirtual() ?
+		(std::min)(static_cast<ULONGLONG>(pHexCtrl->GetCacheSize()), ullSizeTotal) : ullSizeTotal;
+	const auto dwLimit = hss.eSearchMode != EHexSearchMode::SEARCH_ALL ? 1UL :
+		(hss.dwLimit > 0 ? hss.dwLimit : (std::numeric_limits<DWORD>::max)());
+	const auto dwClasses = stRegex.dwClasses;
+	const auto pTrans = stRegex.vecTrans.data();
+	const auto pClass = stRegex.arrClass;
+	const auto u32Start = stRegex.u32Start;
+	const auto fPrefilter = stRegex.fPrefilter && ullStep == 1;
+	const auto pPrefix = stRegex.vecPrefix.data();
+	const auto ullSizePrefix = static_cast<ULONGLONG>(stRegex.vecPrefix.size());
+
+	VecSearchResult vecBatch;
+	std::vector<DWORD> vecBatchSize;
+	vecBatch.reserve(uzSizeBatch);
+	vecBatchSize.reserve(uzSizeBatch);
+	ULONGLONG ullCount { };
+	bool fStop { false };
+
+	for (auto ullOffsetChunk = hss.ullStartFrom; !fStop;) {
+		const auto ullSizeChunk = (std::min)(ullChunkSize, ullRngEnd - ullOffsetChunk + 1);
+		const auto fLastChunk = ullOffsetChunk + ullSizeChunk > ullRngEnd;
+		//Offsets to start the match from: only those followed by the ullMaxSize bytes, but in the last chunk.
+		const auto ullIdxEnd = fLastChunk ? ullSizeChunk : ullSizeChunk - ullMaxSize + 1;
+		const auto pData = pHexCtrl->GetData({ ullOffsetChunk, ullSizeChunk }).data();
+		ULONGLONG ullIdx { 0 };
+		for (; ullIdx < ullIdxEnd; ullIdx += ullStep) {
+			if (fPrefilter) {
+				while (ullIdx + uVecSize <= ullSizeChunk) {
+					if (const auto ullFound = simd::FindFirstOf<eVecType>(pData + ullIdx, stRegex.stFirstBytes);
+						ullFound != 0xFFFFFFFFU) {
+						ullIdx += ullFound;
+						break;
+					}
+					ullIdx += uVecSize;
+				}
+
+				if (ullIdx >= ullIdxEnd)
+					break;
+			}
+
+			if (ullSizePrefix > 1 && (ullSizeChunk - ullIdx < ullSizePrefix
+				|| std::memcmp(pData + ullIdx, pPrefix, static_cast<std::size_t>(ullSizePrefix)) != 0))
+				continue;
+
+			const auto ullSizeRun = (std::min)(ullMaxSize, ullSizeChunk - ullIdx);
+			ULONGLONG ullSizeMatch { };
+			auto u32State = u32Start;
+			for (ULONGLONG ullRun { 0 }; ullRun < ullSizeRun; ++ullRun) {
+				const auto u32Next = pTrans[u32State * dwClasses + pClass[std::to_integer<std::uint8_t>(pData[ullIdx + ullRun])]];
+				u32State = u32Next & ~u32FlagMatch;
+				if ((u32Next & u32FlagMatch) != 0) {
+					ullSizeMatch = ullRun + 1;
+				}
+				if (u32State == 0)
+					break;
+			}
+
+			if (ullSizeMatch == 0)
+				continue;
+
+			vecBatch.emplace_back(ullOffsetChunk + ullIdx);
+			vecBatchSize.emplace_back(static_cast<DWORD>(ullSizeMatch));
+			if (vecBatch.size() == uzSizeBatch) {
+				fStop = hss.pHexSearchRes != nullptr && !hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchSize);
+				vecBatch.clear();
+				vecBatchSize.clear();
+			}
+
+			if (++ullCount >= dwLimit) {
+				fStop = true;
+			}
+
+			if (fStop)
+				break;
+
+			ullIdx += (ullSizeMatch - 1) / ullStep * ullStep; //The next offset on the step is past the match.
+		}
+
+		//The next chunk starts at the first offset on the step that is not searched yet, or past the last match.
+		const auto ullNext = ullOffsetChunk + ullIdx;
+		if (fLastChunk || ullNext > ullRngEnd)
+			break;
+
+		ullOffsetChunk = ullNext;
+	}
+
+	if (hss.pHexSearchRes != nullptr && !vecBatch.empty()) {
+		hss.pHexSearchRes->OnHexSearchResult(vecBatch, vecBatchSize);
+	}
+
+	return ullCount;
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchTextFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	constexpr auto fInverted = st.fInverted;
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
+	const auto fBigStep = sfd.fBigStep;
+	const auto ullChunks = sfd.ullChunks;
+	const auto bWildcard = sfd.bWildcard;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom;
+
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
+			//First memory comparison is always unconditional.
+			if (MemCmpEQText<st>(spnData.data() + ullOffsetData, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+				return { ullOffsetSearch + ullOffsetData, true, false };
+			}
+
+			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
+			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
+				}
+			}
+			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
+			//The one less comparison is needed here, otherwise we would've hit the branch above.
+			else {
+				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				}
+				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				}
+				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				}
+				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				}
+				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				}
+				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
+					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch + ullStep) > ullEnd)
+				break; //Upper bound reached.
+
+			ullOffsetSearch += ullStep;
+		}
+		else {
+			ullOffsetSearch += ullChunkMaxOffset;
+		}
+
+		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
+			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
+			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		}
+	}
+
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchNumBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullEnd = sfd.ullRngStart;
+	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
+	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
+
+	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
+		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		ullOffsetSearch = ullEnd;
+	}
+
+	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
+			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
+			//First memory comparison is always unconditional.
+			if (MemCmpEQNum<st>(spnData.data() + llOffsetData, pDataSearch) == !fInverted) {
+				return { ullOffsetSearch + llOffsetData, true, false };
+			}
+
+			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				}
+				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
+				}
+			}
+			else {
+				if ((llOffsetData - llStep * 1 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
+				}
+				if ((llOffsetData - llStep * 2 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
+				}
+				if ((llOffsetData - llStep * 3 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
+				}
+				if ((llOffsetData - llStep * 4 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
+				}
+				if ((llOffsetData - llStep * 5 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
+				}
+				if ((llOffsetData - llStep * 6 >= 0)
+					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
+				break; //Lower bound reached.
+
+			ullOffsetSearch -= ullChunkMaxOffset;
+		}
+		else {
+			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
+				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
+				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
+				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+				ullOffsetSearch = ullEnd;
+			}
+			else {
+				ullOffsetSearch -= ullChunkMaxOffset;
+			}
+		}
+	}
+
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchNumRngBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullEnd = sfd.ullRngStart;
+	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
+	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto pDataSearchTo = sfd.spnFindTo.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
+
+	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
+		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		ullOffsetSearch = ullEnd;
+	}
+
+	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
+			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
+			//First memory comparison is always unconditional.
+			if (MemCmpEQNumRng<st>(spnData.data() + llOffsetData, pDataSearch, pDataSearchTo) == !fInverted) {
+				return { ullOffsetSearch + llOffsetData, true, false };
+			}
+
+			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				}
+				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch, pDataSearchTo) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
+				}
+			}
+			else {
+				if ((llOffsetData - llStep * 1 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
+				}
+				if ((llOffsetData - llStep * 2 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
+				}
+				if ((llOffsetData - llStep * 3 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
+				}
+				if ((llOffsetData - llStep * 4 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
+				}
+				if ((llOffsetData - llStep * 5 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
+				}
+				if ((llOffsetData - llStep * 6 >= 0)
+					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, pDataSearchTo) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
+				break; //Lower bound reached.
+
+			ullOffsetSearch -= ullChunkMaxOffset;
+		}
+		else {
+			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
+				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
+				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
+				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+				ullOffsetSearch = ullEnd;
+			}
+			else {
+				ullOffsetSearch -= ullChunkMaxOffset;
+			}
+		}
+	}
 
-	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchTextBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullEnd = sfd.ullRngStart;
+	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
+	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto ullChunks = sfd.ullChunks;
+	const auto bWildcard = sfd.bWildcard;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
+
+	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
+		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		ullOffsetSearch = ullEnd;
+	}
+
+	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
 		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
-		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
+			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
 			//First memory comparison is always unconditional.
-			if (MemCmpEQNum<st>(spnData.data() + ullOffsetData, pDataSearch) == !fInverted) {
-				return { ullOffsetSearch + ullOffsetData, true, false };
+			if (MemCmpEQText<st>(spnData.data() + llOffsetData, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+				return { ullOffsetSearch + llOffsetData, true, false };
 			}
 
-			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
-			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
 				}
-				if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
+				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
 				}
 			}
-			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
-			//The one less comparison is needed here, otherwise we would've hit the branch above.
 			else {
-				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
+				if ((llOffsetData - llStep * 1 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
 				}
-				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
+				if ((llOffsetData - llStep * 2 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
 				}
-				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
+				if ((llOffsetData - llStep * 3 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
 				}
-				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
+				if ((llOffsetData - llStep * 4 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
 				}
-				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
+				if ((llOffsetData - llStep * 5 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
 				}
-				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
-					&& (MemCmpEQNum<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				if ((llOffsetData - llStep * 6 >= 0)
+					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
+					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
+				break; //Lower bound reached.
+
+			ullOffsetSearch -= ullChunkMaxOffset;
+		}
+		else {
+			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
+				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
+				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
+				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+				ullOffsetSearch = ullEnd;
+			}
+			else {
+				ullOffsetSearch -= ullChunkMaxOffset;
+			}
+		}
+	}
+
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchFwdVec1(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Members locality is important for the best performance of the tight search loop below.
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType); //Vector size 128/256/512.
+	constexpr auto fInverted = st.fInverted;
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
+	const auto fBigStep = sfd.fBigStep;
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom;
+
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += u32VecSize) {
+			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
+				if (const auto u64Res = simd::MemCmpEQ1<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
+					*reinterpret_cast<const std::uint8_t*>(pDataSearch)); u64Res < u32VecSize) {
+					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
+				}
+			}
+			else {
+				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
+					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
+						return { ullOffsetSearch + ullOffsetData + i, true, false };
+					}
 				}
 			}
 
@@ -2424,20 +6037,19 @@ auto CHexDlgSearch::SearchNumFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchNumRngFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVec2(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
+	constexpr auto fInverted = st.fInverted;
 	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
 	const auto ullStep = sfd.ullStep;
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
-	const auto pDataSearchFrom = sfd.spnFindFrom.data();
-	const auto pDataSearchTo = sfd.spnFindTo.data();
+	const auto pDataSearch = sfd.spnFindFrom.data();
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
 	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
-	const auto fInverted = sfd.fInverted;
 	const auto ullChunks = sfd.ullChunks;
 	auto ullChunkSize = sfd.ullChunkSize;
 	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
@@ -2448,63 +6060,19 @@ auto CHexDlgSearch::SearchNumRngFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
-		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
-			//First memory comparison is always unconditional.
-			if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-				return { ullOffsetSearch + ullOffsetData, true, false };
-			}
-
-			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
-			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearchFrom, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
-				}
-			}
-			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
-			//The one less comparison is needed here, otherwise we would've hit the branch above.
-			else {
-				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
-				}
-				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
-				}
-				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
-				}
-				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
-				}
-				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
-				}
-				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
-					&& (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearchFrom, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+		//Next cycle offset is "u32VecSize - 1", to get the data that crosses the vector.
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += (u32VecSize - 1)) {
+			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
+				if (const auto u64Res = simd::MemCmpEQ2<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
+					*reinterpret_cast<const std::uint16_t*>(pDataSearch)); u64Res < u32VecSize) {
+					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
+				}
+			}
+			else {
+				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
+					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
+						return { ullOffsetSearch + ullOffsetData + i, true, false };
+					}
 				}
 			}
 
@@ -2536,10 +6104,10 @@ auto CHexDlgSearch::SearchNumRngFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchTextFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVec4(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
 	constexpr auto fInverted = st.fInverted;
 	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
 	const auto ullStep = sfd.ullStep;
@@ -2550,7 +6118,6 @@ auto CHexDlgSearch::SearchTextFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
 	const auto ullChunks = sfd.ullChunks;
-	const auto bWildcard = sfd.bWildcard;
 	auto ullChunkSize = sfd.ullChunkSize;
 	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
 	auto ullOffsetSearch = sfd.ullStartFrom;
@@ -2560,63 +6127,19 @@ auto CHexDlgSearch::SearchTextFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		//Unrolling the loop, making LOOP_UNROLL_SIZE comparisons at one cycle.
-		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += ullStep * LOOP_UNROLL_SIZE) {
-			//First memory comparison is always unconditional.
-			if (MemCmpEQText<st>(spnData.data() + ullOffsetData, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-				return { ullOffsetSearch + ullOffsetData, true, false };
-			}
-
-			//This branch allows to avoid the "ullOffsetData + ullStep * 'nstep' <= ullChunkMaxOffset" check every cycle.
-			if ((ullOffsetData + ullStep * (LOOP_UNROLL_SIZE - 1)) <= ullChunkMaxOffset) {
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 7, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 7, true, false };
+		//Next cycle offset is "u32VecSize - 3", to get the data that crosses the vector.
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += (u32VecSize - 3)) {
+			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
+				if (const auto u64Res = simd::MemCmpEQ4<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
+					*reinterpret_cast<const std::uint32_t*>(pDataSearch)); u64Res < u32VecSize) {
+					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
 				}
 			}
-			//In this branch we check every comparison for the ullChunkMaxOffset exceeding.
-			//The one less comparison is needed here, otherwise we would've hit the branch above.
 			else {
-				if ((ullOffsetData + ullStep * 1 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 1, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 1, true, false };
-				}
-				if ((ullOffsetData + ullStep * 2 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 2, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 2, true, false };
-				}
-				if ((ullOffsetData + ullStep * 3 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 3, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 3, true, false };
-				}
-				if ((ullOffsetData + ullStep * 4 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 4, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 4, true, false };
-				}
-				if ((ullOffsetData + ullStep * 5 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 5, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 5, true, false };
-				}
-				if ((ullOffsetData + ullStep * 6 <= ullChunkMaxOffset)
-					&& (MemCmpEQText<st>(spnData.data() + ullOffsetData + ullStep * 6, pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + ullOffsetData + ullStep * 6, true, false };
+				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
+					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
+						return { ullOffsetSearch + ullOffsetData + i, true, false };
+					}
 				}
 			}
 
@@ -2648,90 +6171,50 @@ auto CHexDlgSearch::SearchTextFwd(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchNumBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVecN(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//The vector of the first search data byte is compared with the data at the offset, and the vector of the last byte
+	//with the data at the offset + data size - 1. Only offsets where both match are compared entirely.
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
-	const auto ullStartFrom = sfd.ullStartFrom;
-	const auto ullEnd = sfd.ullRngStart;
-	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
-	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
 	const auto pDataSearch = sfd.spnFindFrom.data();
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto u8First = std::to_integer<std::uint8_t>(pDataSearch[0]);
+	const auto u8Last = std::to_integer<std::uint8_t>(pDataSearch[uzSizeSearch - 1]);
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
-	const auto fInverted = sfd.fInverted;
 	const auto ullChunks = sfd.ullChunks;
+	const auto bWildcard = sfd.bWildcard;
 	auto ullChunkSize = sfd.ullChunkSize;
 	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
-	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
-
-	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
-		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
-		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
-		ullOffsetSearch = ullEnd;
-	}
+	auto ullOffsetSearch = sfd.ullStartFrom;
 
-	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
 		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
-			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
-			//First memory comparison is always unconditional.
-			if (MemCmpEQNum<st>(spnData.data() + llOffsetData, pDataSearch) == !fInverted) {
-				return { ullOffsetSearch + llOffsetData, true, false };
-			}
-
-			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
-				}
-				if (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += u32VecSize) {
+			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
+				auto u32Mask = simd::MemCmpEQFirstLast<st.eVecType>(spnData.data() + ullOffsetData, u8First, u8Last,
+					uzSizeSearch - 1);
+				while (u32Mask != 0) {
+					const auto iCandidate = std::countr_zero(u32Mask);
+					if (simd::MemEqual<st.eVecType>(spnData.data() + ullOffsetData + iCandidate, pDataSearch, uzSizeSearch)) {
+						return { ullOffsetSearch + ullOffsetData + iCandidate, true, false };
+					}
+					u32Mask &= u32Mask - 1; //Resetting the lowest set bit.
 				}
 			}
 			else {
-				if ((llOffsetData - llStep * 1 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if ((llOffsetData - llStep * 2 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if ((llOffsetData - llStep * 3 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if ((llOffsetData - llStep * 4 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if ((llOffsetData - llStep * 5 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
-				}
-				if ((llOffsetData - llStep * 6 >= 0)
-					&& (MemCmpEQNum<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				for (auto i = 0ULL; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
+					if (MemCmpEQText<st>(spnData.data() + ullOffsetData + i, pDataSearch, uzSizeSearch, bWildcard)) {
+						return { ullOffsetSearch + ullOffsetData + i, true, false };
+					}
 				}
 			}
 
@@ -2739,26 +6222,23 @@ auto CHexDlgSearch::SearchNumBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 				if (pDlgProg->IsCanceled()) {
 					return { { }, false, true };
 				}
-				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
 			}
 		}
 
 		if (fBigStep) [[unlikely]] {
-			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
-				break; //Lower bound reached.
+			if ((ullOffsetSearch + ullStep) > ullEnd)
+				break; //Upper bound reached.
 
-			ullOffsetSearch -= ullChunkMaxOffset;
+			ullOffsetSearch += ullStep;
 		}
 		else {
-			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
-				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
-				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
-				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
-				ullOffsetSearch = ullEnd;
-			}
-			else {
-				ullOffsetSearch -= ullChunkMaxOffset;
-			}
+			ullOffsetSearch += ullChunkMaxOffset;
+		}
+
+		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
+			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
+			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
 		}
 	}
 
@@ -2766,91 +6246,58 @@ auto CHexDlgSearch::SearchNumBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchNumRngBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVecText(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//Candidates are filtered by the first and the last bytes that are not wildcards, lower-cased if !st.fMatchCase.
+	//Candidates are then compared entirely, with the wildcards mask.
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
-	const auto ullStartFrom = sfd.ullStartFrom;
-	const auto ullEnd = sfd.ullRngStart;
-	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
-	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	using enum EMemCmp;
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
+	constexpr auto fWchar = st.eMemCmp == DATA_WCHAR;
+	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStep = sfd.ullStep;
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
 	const auto pDataSearch = sfd.spnFindFrom.data();
-	const auto pDataSearchTo = sfd.spnFindTo.data();
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
-	const auto fInverted = sfd.fInverted;
 	const auto ullChunks = sfd.ullChunks;
-	auto ullChunkSize = sfd.ullChunkSize;
-	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
-	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
-
-	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
-		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
-		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
-		ullOffsetSearch = ullEnd;
-	}
-
-	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
-		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
-		assert(!spnData.empty());
-		assert(spnData.size() >= ullChunkSize);
-
-		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
-			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
-			//First memory comparison is always unconditional.
-			if (MemCmpEQNumRng<st>(spnData.data() + llOffsetData, pDataSearch, pDataSearchTo) == !fInverted) {
-				return { ullOffsetSearch + llOffsetData, true, false };
-			}
-
-			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
-				}
-				if (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch, pDataSearchTo) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
-				}
-			}
-			else {
-				if ((llOffsetData - llStep * 1 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if ((llOffsetData - llStep * 2 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if ((llOffsetData - llStep * 3 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if ((llOffsetData - llStep * 4 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if ((llOffsetData - llStep * 5 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
+	const auto bWildcard = sfd.bWildcard;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom;
+
+	const auto stFilter = MakeTextFilter<st>(sfd.spnFindFrom, bWildcard);
+	if (stFilter.fAnyOffset) {
+		return ullChunks > 0 ? FINDRESULT { ullOffsetSearch, true, false } : FINDRESULT { };
+	}
+
+	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += u32VecSize) {
+			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
+				auto u32Mask = simd::MemCmpEQFirstLast<st.eVecType, st.fMatchCase>(spnData.data() + ullOffsetData
+					+ stFilter.uzFirst, stFilter.u8First, stFilter.u8Last, stFilter.uzLast - stFilter.uzFirst);
+				while (u32Mask != 0) {
+					const auto iCandidate = std::countr_zero(u32Mask);
+					const auto pCandidate = spnData.data() + ullOffsetData + iCandidate;
+					if (uzSizeSearch >= u32VecSize ?
+						simd::MemEqualText<st.eVecType, fWchar, st.fMatchCase, st.fWildcard>(pCandidate, pDataSearch, stFilter.arrWCMask, uzSizeSearch) :
+						MemCmpEQText<st>(pCandidate, pDataSearch, uzSizeSearch, bWildcard)) {
+						return { ullOffsetSearch + ullOffsetData + iCandidate, true, false };
+					}
+					u32Mask &= u32Mask - 1; //Resetting the lowest set bit.
 				}
-				if ((llOffsetData - llStep * 6 >= 0)
-					&& (MemCmpEQNumRng<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, pDataSearchTo) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+			}
+			else {
+				for (auto i = 0ULL; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
+					if (MemCmpEQText<st>(spnData.data() + ullOffsetData + i, pDataSearch, uzSizeSearch, bWildcard)) {
+						return { ullOffsetSearch + ullOffsetData + i, true, false };
+					}
 				}
 			}
 
@@ -2858,26 +6305,23 @@ auto CHexDlgSearch::SearchNumRngBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 				if (pDlgProg->IsCanceled()) {
 					return { { }, false, true };
 				}
-				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
 			}
 		}
 
 		if (fBigStep) [[unlikely]] {
-			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
-				break; //Lower bound reached.
+			if ((ullOffsetSearch + ullStep) > ullEnd)
+				break; //Upper bound reached.
 
-			ullOffsetSearch -= ullChunkMaxOffset;
+			ullOffsetSearch += ullStep;
 		}
 		else {
-			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
-				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
-				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
-				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
-				ullOffsetSearch = ullEnd;
-			}
-			else {
-				ullOffsetSearch -= ullChunkMaxOffset;
-			}
+			ullOffsetSearch += ullChunkMaxOffset;
+		}
+
+		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
+			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
+			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
 		}
 	}
 
@@ -2885,20 +6329,27 @@ auto CHexDlgSearch::SearchNumRngBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchTextBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchBackVec(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//Offsets are checked in blocks of sizeof(vec), from the chunk's end to its beginning, and the last match
+	//in a block is taken with the reverse bit scan of the block's mask. Numbers are compared at all block's
+	//offsets at once, texts are filtered the same way as in the SearchFwdVecText, and verified from the last candidate.
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto LOOP_UNROLL_SIZE = 8U; //How many comparisons we do at one loop cycle.
+	using enum EMemCmp;
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
+	constexpr auto fWchar = st.eMemCmp == DATA_WCHAR;
+	constexpr auto fText = st.eMemCmp == DATA_ASCII || fWchar;
+	using TNum = std::conditional_t<st.eMemCmp == DATA_UINT16, std::uint16_t,
+		std::conditional_t<st.eMemCmp == DATA_UINT32, std::uint32_t,
+		std::conditional_t<st.eMemCmp == DATA_UINT64, std::uint64_t, std::uint8_t>>>;
 	const auto ullStartFrom = sfd.ullStartFrom;
 	const auto ullEnd = sfd.ullRngStart;
-	//Step is signed here to make the "llOffsetData - llStep" arithmetic also signed.
-	const auto llStep = static_cast<std::int64_t>(sfd.ullStep);
+	const auto ullStep = sfd.ullStep;
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
 	const auto pDataSearch = sfd.spnFindFrom.data();
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
 	const auto fBigStep = sfd.fBigStep;
-	const auto fInverted = sfd.fInverted;
 	const auto ullChunks = sfd.ullChunks;
 	const auto bWildcard = sfd.bWildcard;
 	auto ullChunkSize = sfd.ullChunkSize;
@@ -2911,65 +6362,65 @@ auto CHexDlgSearch::SearchTextBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		ullOffsetSearch = ullEnd;
 	}
 
+	TEXTFILTER stFilter;
+	if constexpr (fText) {
+		stFilter = MakeTextFilter<st>(sfd.spnFindFrom, bWildcard);
+		if (stFilter.fAnyOffset) {
+			return ullChunks > 0 ? FINDRESULT { ullStartFrom, true, false } : FINDRESULT { };
+		}
+	}
+
+	const auto lmbEqual = [&](const std::byte* pWhere) {
+		if constexpr (fText) {
+			return MemCmpEQText<st>(pWhere, pDataSearch, uzSizeSearch, bWildcard);
+		}
+		else {
+			return MemCmpEQNum<st>(pWhere, pDataSearch) == !st.fInverted;
+		}
+		};
+
+	//Index of the last match in the block, or -1 if there are no matches.
+	const auto lmbBlockLast = [&](const std::byte* pBlock)->int {
+		if constexpr (fText) {
+			auto u32Mask = simd::MemCmpEQFirstLast<st.eVecType, st.fMatchCase>(pBlock + stFilter.uzFirst,
+				stFilter.u8First, stFilter.u8Last, stFilter.uzLast - stFilter.uzFirst);
+			while (u32Mask != 0) {
+				const auto iCandidate = static_cast<int>(std::bit_width(u32Mask)) - 1; //Reverse bit scan.
+				if (uzSizeSearch >= u32VecSize ?
+					simd::MemEqualText<st.eVecType, fWchar, st.fMatchCase, st.fWildcard>(pBlock + iCandidate, pDataSearch,
+						stFilter.arrWCMask, uzSizeSearch) : lmbEqual(pBlock + iCandidate)) {
+					return iCandidate;
+				}
+				u32Mask ^= 1U << iCandidate;
+			}
+
+			return -1;
+		}
+		else {
+			const auto u32Mask = simd::MemCmpEQMask<st.eVecType, TNum, !st.fInverted>(pBlock,
+				*reinterpret_cast<const TNum*>(pDataSearch));
+			return static_cast<int>(std::bit_width(u32Mask)) - 1; //Reverse bit scan.
+		}
+		};
+
 	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
 		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0;
-			llOffsetData -= llStep * LOOP_UNROLL_SIZE) { //llOffsetData might be negative.
-			//First memory comparison is always unconditional.
-			if (MemCmpEQText<st>(spnData.data() + llOffsetData, pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-				return { ullOffsetSearch + llOffsetData, true, false };
-			}
-
-			if ((llOffsetData - llStep * (LOOP_UNROLL_SIZE - 1)) >= 0) {
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
-				}
-				if (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 7), pDataSearch, uzSizeSearch, bWildcard) == !fInverted) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 7), true, false };
+		//llOffsetData is the last offset in the block, and it might be negative.
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0; llOffsetData -= u32VecSize) {
+			if (llOffsetData + 1 >= u32VecSize) {
+				const auto llOffsetBlock = llOffsetData - u32VecSize + 1;
+				if (const auto iLast = lmbBlockLast(spnData.data() + llOffsetBlock); iLast >= 0) {
+					return { ullOffsetSearch + llOffsetBlock + iLast, true, false };
 				}
 			}
 			else {
-				if ((llOffsetData - llStep * 1 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 1), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 1), true, false };
-				}
-				if ((llOffsetData - llStep * 2 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 2), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 2), true, false };
-				}
-				if ((llOffsetData - llStep * 3 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 3), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 3), true, false };
-				}
-				if ((llOffsetData - llStep * 4 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 4), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 4), true, false };
-				}
-				if ((llOffsetData - llStep * 5 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 5), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 5), true, false };
-				}
-				if ((llOffsetData - llStep * 6 >= 0)
-					&& (MemCmpEQText<st>(spnData.data() + (llOffsetData - llStep * 6), pDataSearch, uzSizeSearch, bWildcard) == !fInverted)) {
-					return { ullOffsetSearch + (llOffsetData - llStep * 6), true, false };
+				for (auto llOffset = llOffsetData; llOffset >= 0; --llOffset) {
+					if (lmbEqual(spnData.data() + llOffset)) {
+						return { ullOffsetSearch + llOffset, true, false };
+					}
 				}
 			}
 
@@ -2982,7 +6433,7 @@ auto CHexDlgSearch::SearchTextBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		}
 
 		if (fBigStep) [[unlikely]] {
-			if ((ullOffsetSearch - llStep) < ullEnd || (ullOffsetSearch - llStep) > ((std::numeric_limits<ULONGLONG>::max)() - llStep))
+			if ((ullOffsetSearch - ullStep) < ullEnd || (ullOffsetSearch - ullStep) > ((std::numeric_limits<ULONGLONG>::max)() - ullStep))
 				break; //Lower bound reached.
 
 			ullOffsetSearch -= ullChunkMaxOffset;
@@ -3004,16 +6455,21 @@ auto CHexDlgSearch::SearchTextBack(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchFwdVec1(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVecStep(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//Only the loads for the offsets on the step are done, and the other offsets are masked out.
+	//The block size is a multiple of the step, so all blocks start on the step and share the same mask.
 	//Members locality is important for the best performance of the tight search loop below.
-	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType); //Vector size 128/256.
-	constexpr auto fInverted = st.fInverted;
+	using TNum = TMemCmpNum<st.eMemCmp>;
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
 	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
 	const auto ullStep = sfd.ullStep;
+	const auto u32Step = static_cast<std::uint32_t>(ullStep);
+	const auto u32MaskStep = simd::StepMask(st.eVecType, u32Step);
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
 	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto tWhat = *reinterpret_cast<const TNum*>(pDataSearch);
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
 	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
@@ -3029,14 +6485,15 @@ auto CHexDlgSearch::SearchFwdVec1(const SEARCHFUNCDATA& sfd)->FINDRESULT
 
 		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += u32VecSize) {
 			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
-				if (const auto u64Res = simd::MemCmpEQ1<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
-					*reinterpret_cast<const std::uint8_t*>(pDataSearch)); u64Res < u32VecSize) {
-					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
+				const auto u32Mask = simd::MemCmpEQMask<st.eVecType, TNum, !st.fInverted>(spnData.data() + ullOffsetData,
+					tWhat, u32Step) & u32MaskStep;
+				if (u32Mask != 0) {
+					return { ullOffsetSearch + ullOffsetData + std::countr_zero(u32Mask), true, false };
 				}
 			}
 			else {
-				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
-					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
+				for (auto i = 0ULL; i <= ullChunkMaxOffset - ullOffsetData; i += ullStep) {
+					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !st.fInverted) {
 						return { ullOffsetSearch + ullOffsetData + i, true, false };
 					}
 				}
@@ -3070,41 +6527,54 @@ auto CHexDlgSearch::SearchFwdVec1(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchFwdVec2(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchBackVecStep(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//Blocks are checked from the chunk's end, the same way as in the SearchBackVec, and the step
+	//is counted from the block's last offset, so the reverse bit scan gives the last match on the step.
 	//Members locality is important for the best performance of the tight search loop below.
+	using TNum = TMemCmpNum<st.eMemCmp>;
 	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
-	constexpr auto fInverted = st.fInverted;
-	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullEnd = sfd.ullRngStart;
 	const auto ullStep = sfd.ullStep;
+	const auto u32Step = static_cast<std::uint32_t>(ullStep);
+	const auto u32MaskStep = simd::StepMask(st.eVecType, u32Step, true);
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
 	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto tWhat = *reinterpret_cast<const TNum*>(pDataSearch);
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
-	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
 	const auto ullChunks = sfd.ullChunks;
 	auto ullChunkSize = sfd.ullChunkSize;
 	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
-	auto ullOffsetSearch = sfd.ullStartFrom;
+	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
 
-	for (auto itChunk = 0ULL; itChunk < ullChunks; ++itChunk) {
+	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
+		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		ullOffsetSearch = ullEnd;
+	}
+
+	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
 		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		//Next cycle offset is "u32VecSize - 1", to get the data that crosses the vector.
-		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += (u32VecSize - 1)) {
-			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
-				if (const auto u64Res = simd::MemCmpEQ2<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
-					*reinterpret_cast<const std::uint16_t*>(pDataSearch)); u64Res < u32VecSize) {
-					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
+		//llOffsetData is the last offset in the block, and it might be negative.
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0; llOffsetData -= u32VecSize) {
+			if (llOffsetData + 1 >= u32VecSize) {
+				const auto llOffsetBlock = llOffsetData - u32VecSize + 1;
+				const auto u32Mask = simd::MemCmpEQMask<st.eVecType, TNum, !st.fInverted>(spnData.data() + llOffsetBlock,
+					tWhat, u32Step, true) & u32MaskStep;
+				if (u32Mask != 0) {
+					return { ullOffsetSearch + llOffsetBlock + (std::bit_width(u32Mask) - 1), true, false }; //Reverse bit scan.
 				}
 			}
 			else {
-				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
-					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
-						return { ullOffsetSearch + ullOffsetData + i, true, false };
+				for (auto llOffset = llOffsetData; llOffset >= 0; llOffset -= u32Step) {
+					if (MemCmpEQNum<st>(spnData.data() + llOffset, pDataSearch) == !st.fInverted) {
+						return { ullOffsetSearch + llOffset, true, false };
 					}
 				}
 			}
@@ -3113,23 +6583,26 @@ auto CHexDlgSearch::SearchFwdVec2(const SEARCHFUNCDATA& sfd)->FINDRESULT
 				if (pDlgProg->IsCanceled()) {
 					return { { }, false, true };
 				}
-				pDlgProg->SetCurrent(ullOffsetSearch + ullOffsetData);
+				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
 			}
 		}
 
 		if (fBigStep) [[unlikely]] {
-			if ((ullOffsetSearch + ullStep) > ullEnd)
-				break; //Upper bound reached.
+			if ((ullOffsetSearch - ullStep) < ullEnd || (ullOffsetSearch - ullStep) > ((std::numeric_limits<ULONGLONG>::max)() - ullStep))
+				break; //Lower bound reached.
 
-			ullOffsetSearch += ullStep;
+			ullOffsetSearch -= ullChunkMaxOffset;
 		}
 		else {
-			ullOffsetSearch += ullChunkMaxOffset;
-		}
-
-		if (ullOffsetSearch + ullChunkSize > ullOffsetSentinel) {
-			ullChunkSize = ullOffsetSentinel - ullOffsetSearch;
-			ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
+				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
+				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
+				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+				ullOffsetSearch = ullEnd;
+			}
+			else {
+				ullOffsetSearch -= ullChunkMaxOffset;
+			}
 		}
 	}
 
@@ -3137,19 +6610,29 @@ auto CHexDlgSearch::SearchFwdVec2(const SEARCHFUNCDATA& sfd)->FINDRESULT
 }
 
 template<CHexDlgSearch::SEARCHTYPE st>
-auto CHexDlgSearch::SearchFwdVec4(const SEARCHFUNCDATA& sfd)->FINDRESULT
+auto CHexDlgSearch::SearchFwdVecRng(const SEARCHFUNCDATA& sfd)->FINDRESULT
 {
+	//Numbers at all offsets of the sizeof(vec) block are compared with the range bounds at once.
+	//With the step, the offsets that are off the step are masked out, the same way as in the SearchFwdVecStep.
 	//Members locality is important for the best performance of the tight search loop below.
+	using TNum = TMemCmpNum<st.eMemCmp>;
 	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
-	constexpr auto fInverted = st.fInverted;
+	constexpr auto u32MaskAll = u32VecSize == 32U ? 0xFFFFFFFFU : ((1U << u32VecSize) - 1);
 	const auto ullOffsetSentinel = sfd.ullRngEnd + 1;
 	const auto ullStep = sfd.ullStep;
+	const auto u32Step = static_cast<std::uint32_t>(ullStep);
+	const auto u32MaskStep = simd::StepMask(st.eVecType, u32Step);
 	const auto pHexCtrl = sfd.pHexCtrl;
 	const auto pDlgProg = sfd.pDlgProg;
-	const auto pDataSearch = sfd.spnFindFrom.data();
+	const auto pDataSearchFrom = sfd.spnFindFrom.data();
+	const auto pDataSearchTo = sfd.spnFindTo.data();
+	const auto tFrom = *reinterpret_cast<const TNum*>(pDataSearchFrom);
+	const auto tTo = *reinterpret_cast<const TNum*>(pDataSearchTo);
 	const auto uzSizeSearch = sfd.spnFindFrom.size();
 	const auto ullEnd = ullOffsetSentinel - uzSizeSearch;
 	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto u32MaskInv = fInverted ? u32MaskAll : 0U; //Inverts the mask of matches.
 	const auto ullChunks = sfd.ullChunks;
 	auto ullChunkSize = sfd.ullChunkSize;
 	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
@@ -3160,17 +6643,17 @@ auto CHexDlgSearch::SearchFwdVec4(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		assert(!spnData.empty());
 		assert(spnData.size() >= ullChunkSize);
 
-		//Next cycle offset is "u32VecSize - 3", to get the data that crosses the vector.
-		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += (u32VecSize - 3)) {
+		for (auto ullOffsetData = 0ULL; ullOffsetData <= ullChunkMaxOffset; ullOffsetData += u32VecSize) {
 			if ((ullOffsetData + u32VecSize) <= ullChunkMaxOffset) {
-				if (const auto u64Res = simd::MemCmpEQ4<st.eVecType, !fInverted>(spnData.data() + ullOffsetData,
-					*reinterpret_cast<const std::uint32_t*>(pDataSearch)); u64Res < u32VecSize) {
-					return { ullOffsetSearch + ullOffsetData + u64Res, true, false };
+				const auto u32Mask = (simd::MemCmpRngMask<st.eVecType, TNum, st.fBigEndian>(spnData.data() + ullOffsetData,
+					tFrom, tTo, u32Step) ^ u32MaskInv) & u32MaskStep;
+				if (u32Mask != 0) {
+					return { ullOffsetSearch + ullOffsetData + std::countr_zero(u32Mask), true, false };
 				}
 			}
 			else {
-				for (auto i = 0; i <= ullChunkMaxOffset - ullOffsetData; ++i) {
-					if (MemCmpEQNum<st>(spnData.data() + ullOffsetData + i, pDataSearch) == !fInverted) {
+				for (auto i = 0ULL; i <= ullChunkMaxOffset - ullOffsetData; i += ullStep) {
+					if (MemCmpEQNumRng<st>(spnData.data() + ullOffsetData + i, pDataSearchFrom, pDataSearchTo) == !fInverted) {
 						return { ullOffsetSearch + ullOffsetData + i, true, false };
 					}
 				}
@@ -3200,5 +6683,92 @@ auto CHexDlgSearch::SearchFwdVec4(const SEARCHFUNCDATA& sfd)->FINDRESULT
 		}
 	}
 
+	return { };
+}
+
+template<CHexDlgSearch::SEARCHTYPE st>
+auto CHexDlgSearch::SearchBackVecRng(const SEARCHFUNCDATA& sfd)->FINDRESULT
+{
+	//Blocks of sizeof(vec) offsets are checked from the chunk's end, the same way as in the SearchBackVec.
+	//Members locality is important for the best performance of the tight search loop below.
+	using TNum = TMemCmpNum<st.eMemCmp>;
+	constexpr auto u32VecSize = simd::VecTypeToSize(st.eVecType);
+	constexpr auto u32MaskAll = u32VecSize == 32U ? 0xFFFFFFFFU : ((1U << u32VecSize) - 1);
+	const auto ullStartFrom = sfd.ullStartFrom;
+	const auto ullEnd = sfd.ullRngStart;
+	const auto ullStep = sfd.ullStep;
+	const auto u32Step = static_cast<std::uint32_t>(ullStep);
+	const auto u32MaskStep = simd::StepMask(st.eVecType, u32Step, true);
+	const auto pHexCtrl = sfd.pHexCtrl;
+	const auto pDlgProg = sfd.pDlgProg;
+	const auto pDataSearchFrom = sfd.spnFindFrom.data();
+	const auto pDataSearchTo = sfd.spnFindTo.data();
+	const auto tFrom = *reinterpret_cast<const TNum*>(pDataSearchFrom);
+	const auto tTo = *reinterpret_cast<const TNum*>(pDataSearchTo);
+	const auto uzSizeSearch = sfd.spnFindFrom.size();
+	const auto fBigStep = sfd.fBigStep;
+	const auto fInverted = sfd.fInverted;
+	const auto u32MaskInv = fInverted ? u32MaskAll : 0U; //Inverts the mask of matches.
+	const auto ullChunks = sfd.ullChunks;
+	auto ullChunkSize = sfd.ullChunkSize;
+	auto ullChunkMaxOffset = sfd.ullChunkMaxOffset;
+	auto ullOffsetSearch = sfd.ullStartFrom - sfd.ullChunkMaxOffset;
+
+	if (ullOffsetSearch < ullEnd || ullOffsetSearch >((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset)) {
+		ullChunkSize = (ullStartFrom - ullEnd) + uzSizeSearch;
+		ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+		ullOffsetSearch = ullEnd;
+	}
+
+	for (auto itChunk = ullChunks; itChunk > 0; --itChunk) {
+		const auto spnData = pHexCtrl->GetData({ ullOffsetSearch, ullChunkSize });
+		assert(!spnData.empty());
+		assert(spnData.size() >= ullChunkSize);
+
+		//llOffsetData is the last offset in the block, and it might be negative.
+		for (auto llOffsetData = static_cast<LONGLONG>(ullChunkMaxOffset); llOffsetData >= 0; llOffsetData -= u32VecSize) {
+			if (llOffsetData + 1 >= u32VecSize) {
+				const auto llOffsetBlock = llOffsetData - u32VecSize + 1;
+				const auto u32Mask = (simd::MemCmpRngMask<st.eVecType, TNum, st.fBigEndian>(spnData.data() + llOffsetBlock,
+					tFrom, tTo, u32Step, true) ^ u32MaskInv) & u32MaskStep;
+				if (u32Mask != 0) {
+					return { ullOffsetSearch + llOffsetBlock + (std::bit_width(u32Mask) - 1), true, false }; //Reverse bit scan.
+				}
+			}
+			else {
+				for (auto llOffset = llOffsetData; llOffset >= 0; llOffset -= u32Step) {
+					if (MemCmpEQNumRng<st>(spnData.data() + llOffset, pDataSearchFrom, pDataSearchTo) == !fInverted) {
+						return { ullOffsetSearch + llOffset, true, false };
+					}
+				}
+			}
+
+			if constexpr (st.fDlgProg) {
+				if (pDlgProg->IsCanceled()) {
+					return { { }, false, true };
+				}
+				pDlgProg->SetCurrent(ullStartFrom - (ullOffsetSearch + llOffsetData));
+			}
+		}
+
+		if (fBigStep) [[unlikely]] {
+			if ((ullOffsetSearch - ullStep) < ullEnd || (ullOffsetSearch - ullStep) > ((std::numeric_limits<ULONGLONG>::max)() - ullStep))
+				break; //Lower bound reached.
+
+			ullOffsetSearch -= ullChunkMaxOffset;
+		}
+		else {
+			if ((ullOffsetSearch - ullChunkMaxOffset) < ullEnd || ((ullOffsetSearch - ullChunkMaxOffset) >
+				((std::numeric_limits<ULONGLONG>::max)() - ullChunkMaxOffset))) {
+				ullChunkSize = (ullOffsetSearch - ullEnd) + uzSizeSearch;
+				ullChunkMaxOffset = ullChunkSize - uzSizeSearch;
+				ullOffsetSearch = ullEnd;
+			}
+			else {
+				ullOffsetSearch -= ullChunkMaxOffset;
+			}
+		}
+	}
+
 	return { };
 }
\ No newline at end of file
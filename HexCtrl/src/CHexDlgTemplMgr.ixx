@@ -60,6 +60,7 @@ namespace HEXCTRL::INTERNAL {
 		[[nodiscard]] bool PreTranslateMsg(MSG* pMsg);
 		[[nodiscard]] auto ProcessMsg(const MSG& msg) -> INT_PTR;
 		void SetDlgProperties(std::uint64_t u64Flags);
+		void ShiftOffsets(const ut::COffsetShift& stShift); //Moves applied templates along with the data, when its size changes.
 		void ShowTooltips(bool fShow)override;
 		void ShowWindow(int iCmdShow);
 		void UnloadAll()override;
@@ -436,6 +437,24 @@ void CHexDlgTemplMgr::SetDlgProperties(std::uint64_t u64Flags)
 	m_u64Flags = u64Flags;
 }
 
+void CHexDlgTemplMgr::ShiftOffsets(const ut::COffsetShift& stShift)
+{
+	//Templates, whose first byte was removed, are disapplied.
+	std::vector<int> vecRemoved;
+	for (auto& ta : m_vecTemplApplied) {
+		if (const auto hs = stShift.Span({ ta.ullOffset, 1 }); hs.ullSize == 1) {
+			ta.ullOffset = hs.ullOffset;
+		}
+		else {
+			vecRemoved.emplace_back(ta.iAppliedID);
+		}
+	}
+
+	for (const auto iAppliedID : vecRemoved) {
+		TMPLRemoveApplied(iAppliedID);
+	}
+}
+
 void CHexDlgTemplMgr::ShowTooltips(bool fShow)
 {
 	m_WndBtnTT.SetCheck(fShow);
@@ -0,0 +1,368 @@
+/****************************************************************************************
+* Copyright © 2018-present Jovibor https://github.com/jovibor/                          *
+* Hex Control for Windows applications.                                                 *
+* Official git repository: https://github.com/jovibor/HexCtrl/                          *
+* This software is available under "The HexCtrl License", see the LICENSE file.         *
+****************************************************************************************/
+module;
+#include <SDKDDKVer.h>
+#include "../HexCtrl.h"
+#include <Windows.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+export module HEXCTRL:CHexPieceTable;
+
+import :HexUtility;
+
+namespace HEXCTRL::INTERNAL {
+	//Piece table edit layer over the original data, that is never written to.
+	//The data is a sequence of pieces, each one refers either to the original data, or to the add buffer,
+	//where all the edited bytes are appended to. Pieces are kept in an immutable treap (randomized search tree)
+	//with the data sizes of the subtrees, so that any edit is O(log n) of the pieces count, regardless of the data size.
+	//It's true for the data size changes as well, inserting bytes at the start of a huge data doesn't move anything.
+	//Every edit creates a new root, sharing all untouched nodes with the previous one, so the Undo/Redo
+	//snapshot is just a pointer to the previous root. Methods can be called from different threads.
+	class CHexPieceTable final {
+	public:
+		[[nodiscard]] bool CanRedo()const;
+		[[nodiscard]] bool CanUndo()const;
+		void Clear();
+		void Erase(ULONGLONG ullOffset, ULONGLONG ullSize); //Removes data, the data size decreases.
+		[[nodiscard]] auto GetDataSize()const -> ULONGLONG;
+		[[nodiscard]] auto GetEdits()const -> VecHexSpan; //Data spans that differ from the original data.
+		void Insert(ULONGLONG ullOffset, SpanCByte spnData); //Inserts data before the offset, the data size increases.
+		[[nodiscard]] bool IsLayoutChanged()const; //Original data is not at its original offsets anymore.
+		[[nodiscard]] bool IsSet()const;
+		template<typename TFunc>
+		void Read(ULONGLONG ullOffset, SpanByte spnData, const TFunc& FuncReadOrig)const; //Stitches data from the pieces.
+		auto Redo() -> std::optional<ut::COffsetShift>; //Offsets shift of the redone edit, std::nullopt if no Redo.
+		void Replace(ULONGLONG ullOffset, SpanCByte spnData); //Overwrites data at the offset.
+		void Reset(ULONGLONG ullDataSize); //Whole data is one piece of the original data.
+		void SetUndoShift(const ut::COffsetShift& stShift); //Data size change of the edit after the last Snapshot.
+		void Snapshot(); //Undo snapshot of the current data state.
+		auto Undo() -> std::optional<ut::COffsetShift>; //Offsets shift of the undone edit, std::nullopt if no Undo.
+	private:
+		struct PIECE {
+			ULONGLONG ullOffset { }; //Offset in the original data, or in the add buffer.
+			ULONGLONG ullSize { };
+			bool      fAdd { };      //Piece is in the add buffer.
+		};
+		struct NODE;
+		using PNODE = std::shared_ptr<const NODE>;
+		struct NODE {
+			PIECE         stPiece;
+			PNODE         pLeft;
+			PNODE         pRight;
+			ULONGLONG     ullSizeTree { }; //Data size of the whole subtree.
+			std::uint32_t u32Prior { };    //Treap priority, not less than the children's ones.
+		};
+		struct UNDO {
+			PNODE             pRoot;
+			ut::COffsetShift stShift; //Data size change from this state to the next one.
+		};
+		template<typename TFunc>
+		static void ForEachPiece(const PNODE& pNode, ULONGLONG ullOffsetNode, ULONGLONG ullFirst, ULONGLONG ullEnd,
+			const TFunc& Func);
+		[[nodiscard]] static auto MakeNode(const PIECE& stPiece, std::uint32_t u32Prior, PNODE pLeft, PNODE pRight) -> PNODE;
+		[[nodiscard]] static auto Merge(const PNODE& pLeft, const PNODE& pRight) -> PNODE;
+		[[nodiscard]] static auto SizeTree(const PNODE& pNode) -> ULONGLONG;
+		[[nodiscard]] static auto Split(const PNODE& pNode, ULONGLONG ullOffset) -> std::pair<PNODE, PNODE>;
+	private:
+		static constexpr auto m_dwUndoMax { 512U }; //Undo's max limit.
+		mutable std::shared_mutex m_mtx;
+		std::vector<std::byte> m_vecAdd; //Add buffer, only grows until the Reset.
+		std::deque<UNDO> m_deqUndo;      //Previous roots, the oldest ones are dropped from the front.
+		std::vector<UNDO> m_vecRedo;     //Undone roots.
+		PNODE m_pRoot;
+		ULONGLONG m_ullSizeOrig { };     //Original data size.
+		std::mt19937 m_genPrior;
+		std::atomic<bool> m_fSet { false }; //Read without the lock, on every data access.
+	};
+}
+
+using namespace HEXCTRL::INTERNAL;
+
+bool CHexPieceTable::CanRedo()const
+{
+	const std::shared_lock lock(m_mtx);
+	return !m_vecRedo.empty();
+}
+
+bool CHexPieceTable::CanUndo()const
+{
+	const std::shared_lock lock(m_mtx);
+	return !m_deqUndo.empty();
+}
+
+void CHexPieceTable::Clear()
+{
+	const std::unique_lock lock(m_mtx);
+	m_vecAdd.clear();
+	m_vecAdd.shrink_to_fit();
+	m_deqUndo.clear();
+	m_vecRedo.clear();
+	m_pRoot.reset();
+	m_ullSizeOrig = 0;
+	m_fSet = false;
+}
+
+void CHexPieceTable::Erase(ULONGLONG ullOffset, ULONGLONG ullSize)
+{
+	if (ullSize == 0)
+		return;
+
+	const std::unique_lock lock(m_mtx);
+	assert(ullOffset + ullSize <= SizeTree(m_pRoot));
+	auto [pLeft, pRest] = Split(m_pRoot, ullOffset);
+	auto [pOld, pRight] = Split(pRest, ullSize);
+	m_pRoot = Merge(pLeft, pRight);
+}
+
+auto CHexPieceTable::GetDataSize()const->ULONGLONG
+{
+	const std::shared_lock lock(m_mtx);
+	return SizeTree(m_pRoot);
+}
+
+auto CHexPieceTable::GetEdits()const->VecHexSpan
+{
+	const std::shared_lock lock(m_mtx);
+	VecHexSpan vecEdits;
+	ForEachPiece(m_pRoot, 0, 0, SizeTree(m_pRoot), [&](ULONGLONG ullOffsetPiece, const PIECE& stPiece) {
+		if (!stPiece.fAdd)
+			return;
+
+		if (!vecEdits.empty() && vecEdits.back().ullOffset + vecEdits.back().ullSize == ullOffsetPiece) {
+			vecEdits.back().ullSize += stPiece.ullSize;
+		}
+		else {
+			vecEdits.emplace_back(ullOffsetPiece, stPiece.ullSize);
+		}
+		});
+
+	return vecEdits;
+}
+
+void CHexPieceTable::Insert(ULONGLONG ullOffset, SpanCByte spnData)
+{
+	if (spnData.empty())
+		return;
+
+	const std::unique_lock lock(m_mtx);
+	assert(ullOffset <= SizeTree(m_pRoot));
+	const auto ullOffsetAdd = static_cast<ULONGLONG>(m_vecAdd.size());
+	m_vecAdd.insert(m_vecAdd.end(), spnData.begin(), spnData.end());
+
+	auto [pLeft, pRight] = Split(m_pRoot, ullOffset);
+	const auto pNew = MakeNode({ .ullOffset { ullOffsetAdd }, .ullSize { spnData.size() }, .fAdd { true } },
+		static_cast<std::uint32_t>(m_genPrior()), nullptr, nullptr);
+	m_pRoot = Merge(Merge(pLeft, pNew), pRight);
+}
+
+bool CHexPieceTable::IsLayoutChanged()const
+{
+	const std::shared_lock lock(m_mtx);
+	if (SizeTree(m_pRoot) != m_ullSizeOrig)
+		return true;
+
+	auto fChanged { false };
+	ForEachPiece(m_pRoot, 0, 0, m_ullSizeOrig, [&](ULONGLONG ullOffsetPiece, const PIECE& stPiece) {
+		if (!stPiece.fAdd && stPiece.ullOffset != ullOffsetPiece) {
+			fChanged = true;
+		}
+		});
+
+	return fChanged;
+}
+
+bool CHexPieceTable::IsSet()const
+{
+	return m_fSet;
+}
+
+template<typename TFunc>
+void CHexPieceTable::Read(ULONGLONG ullOffset, SpanByte spnData, const TFunc& FuncReadOrig)const
+{
+	//FuncReadOrig(ULONGLONG ullOffsetOrig, SpanByte spnTo) reads the original data.
+	const std::shared_lock lock(m_mtx);
+	const auto ullEnd = ullOffset + spnData.size();
+	assert(ullEnd <= SizeTree(m_pRoot));
+	ForEachPiece(m_pRoot, 0, ullOffset, ullEnd, [&](ULONGLONG ullOffsetPiece, const PIECE& stPiece) {
+		const auto ullFrom = (std::max)(ullOffset, ullOffsetPiece);
+		const auto ullTo = (std::min)(ullEnd, ullOffsetPiece + stPiece.ullSize);
+		const auto ullOffsetSrc = stPiece.ullOffset + (ullFrom - ullOffsetPiece);
+		const SpanByte spnTo { spnData.data() + (ullFrom - ullOffset), static_cast<std::size_t>(ullTo - ullFrom) };
+		if (stPiece.fAdd) {
+			std::copy_n(m_vecAdd.data() + ullOffsetSrc, spnTo.size(), spnTo.data());
+		}
+		else {
+			FuncReadOrig(ullOffsetSrc, spnTo);
+		}
+		});
+}
+
+auto CHexPieceTable::Redo()->std::optional<ut::COffsetShift>
+{
+	const std::unique_lock lock(m_mtx);
+	if (m_vecRedo.empty())
+		return std::nullopt;
+
+	auto& stRedo = m_vecRedo.back();
+	m_deqUndo.emplace_back(std::move(m_pRoot), stRedo.stShift);
+	m_pRoot = std::move(stRedo.pRoot);
+	auto stShift = std::move(stRedo.stShift);
+	m_vecRedo.pop_back();
+
+	return stShift;
+}
+
+void CHexPieceTable::Replace(ULONGLONG ullOffset, SpanCByte spnData)
+{
+	if (spnData.empty())
+		return;
+
+	const std::unique_lock lock(m_mtx);
+	assert(ullOffset + spnData.size() <= SizeTree(m_pRoot));
+	const auto ullOffsetAdd = static_cast<ULONGLONG>(m_vecAdd.size());
+	m_vecAdd.insert(m_vecAdd.end(), spnData.begin(), spnData.end());
+
+	auto [pLeft, pRest] = Split(m_pRoot, ullOffset);
+	auto [pOld, pRight] = Split(pRest, spnData.size()); //pOld is still referenced by the Undo snapshots, if any.
+	const auto pNew = MakeNode({ .ullOffset { ullOffsetAdd }, .ullSize { spnData.size() }, .fAdd { true } },
+		static_cast<std::uint32_t>(m_genPrior()), nullptr, nullptr);
+	m_pRoot = Merge(Merge(pLeft, pNew), pRight);
+}
+
+void CHexPieceTable::Reset(ULONGLONG ullDataSize)
+{
+	const std::unique_lock lock(m_mtx);
+	m_vecAdd.clear();
+	m_vecAdd.shrink_to_fit();
+	m_deqUndo.clear();
+	m_vecRedo.clear();
+	m_pRoot = ullDataSize > 0 ? MakeNode({ .ullOffset { 0 }, .ullSize { ullDataSize }, .fAdd { false } },
+		static_cast<std::uint32_t>(m_genPrior()), nullptr, nullptr) : nullptr;
+	m_ullSizeOrig = ullDataSize;
+	m_fSet = true;
+}
+
+void CHexPieceTable::SetUndoShift(const ut::COffsetShift& stShift)
+{
+	const std::unique_lock lock(m_mtx);
+	if (!m_deqUndo.empty()) {
+		m_deqUndo.back().stShift = stShift;
+	}
+}
+
+void CHexPieceTable::Snapshot()
+{
+	const std::unique_lock lock(m_mtx);
+
+	if (m_deqUndo.size() >= static_cast<std::size_t>(m_dwUndoMax)) { //Undo's max limit, the oldest snapshot is dropped.
+		m_deqUndo.pop_front();
+	}
+
+	m_deqUndo.emplace_back(m_pRoot);
+	m_vecRedo.clear(); //No Redo after a new edit.
+}
+
+auto CHexPieceTable::Undo()->std::optional<ut::COffsetShift>
+{
+	const std::unique_lock lock(m_mtx);
+	if (m_deqUndo.empty())
+		return std::nullopt;
+
+	auto& stUndo = m_deqUndo.back();
+	m_vecRedo.emplace_back(std::move(m_pRoot), stUndo.stShift);
+	m_pRoot = std::move(stUndo.pRoot);
+	auto stShift = stUndo.stShift.GetInverse();
+	m_deqUndo.pop_back();
+
+	return stShift;
+}
+
+
+//Private methods.
+
+template<typename TFunc>
+void CHexPieceTable::ForEachPiece(const PNODE& pNode, ULONGLONG ullOffsetNode, ULONGLONG ullFirst, ULONGLONG ullEnd,
+	const TFunc& Func)
+{
+	//Calls the Func(ULONGLONG ullOffsetPiece, const PIECE&) for every piece within the [ullFirst, ullEnd) data range,
+	//in the data order. The ullOffsetNode is the data offset of the pNode's subtree.
+	if (pNode == nullptr || ullFirst >= ullOffsetNode + pNode->ullSizeTree || ullEnd <= ullOffsetNode)
+		return;
+
+	const auto ullOffsetPiece = ullOffsetNode + SizeTree(pNode->pLeft);
+	const auto ullEndPiece = ullOffsetPiece + pNode->stPiece.ullSize;
+	ForEachPiece(pNode->pLeft, ullOffsetNode, ullFirst, ullEnd, Func);
+	if (ullFirst < ullEndPiece && ullEnd > ullOffsetPiece) {
+		Func(ullOffsetPiece, pNode->stPiece);
+	}
+	ForEachPiece(pNode->pRight, ullEndPiece, ullFirst, ullEnd, Func);
+}
+
+auto CHexPieceTable::MakeNode(const PIECE& stPiece, std::uint32_t u32Prior, PNODE pLeft, PNODE pRight)->PNODE
+{
+	const auto ullSizeTree = SizeTree(pLeft) + stPiece.ullSize + SizeTree(pRight);
+	return std::make_shared<const NODE>(NODE { .stPiece { stPiece }, .pLeft { std::move(pLeft) },
+		.pRight { std::move(pRight) }, .ullSizeTree { ullSizeTree }, .u32Prior { u32Prior } });
+}
+
+auto CHexPieceTable::Merge(const PNODE& pLeft, const PNODE& pRight)->PNODE
+{
+	//All the pLeft's data goes before the pRight's data.
+	if (pLeft == nullptr)
+		return pRight;
+
+	if (pRight == nullptr)
+		return pLeft;
+
+	if (pLeft->u32Prior > pRight->u32Prior)
+		return MakeNode(pLeft->stPiece, pLeft->u32Prior, pLeft->pLeft, Merge(pLeft->pRight, pRight));
+
+	return MakeNode(pRight->stPiece, pRight->u32Prior, Merge(pLeft, pRight->pLeft), pRight->pRight);
+}
+
+auto CHexPieceTable::SizeTree(const PNODE& pNode)->ULONGLONG
+{
+	return pNode == nullptr ? 0ULL : pNode->ullSizeTree;
+}
+
+auto CHexPieceTable::Split(const PNODE& pNode, ULONGLONG ullOffset)->std::pair<PNODE, PNODE>
+{
+	//Splits the tree into the first ullOffset bytes of data, and the rest. The piece at the ullOffset,
+	//if any, is split into two pieces, both with the original node's priority.
+	if (pNode == nullptr || ullOffset == 0)
+		return { nullptr, pNode };
+
+	if (ullOffset >= pNode->ullSizeTree)
+		return { pNode, nullptr };
+
+	const auto& stPiece = pNode->stPiece;
+	const auto ullSizeLeft = SizeTree(pNode->pLeft);
+	if (ullOffset <= ullSizeLeft) {
+		auto [pLeft, pRight] = Split(pNode->pLeft, ullOffset);
+		return { std::move(pLeft), MakeNode(stPiece, pNode->u32Prior, std::move(pRight), pNode->pRight) };
+	}
+
+	if (ullOffset >= ullSizeLeft + stPiece.ullSize) {
+		auto [pLeft, pRight] = Split(pNode->pRight, ullOffset - ullSizeLeft - stPiece.ullSize);
+		return { MakeNode(stPiece, pNode->u32Prior, pNode->pLeft, std::move(pLeft)), std::move(pRight) };
+	}
+
+	const auto ullSizeFirst = ullOffset - ullSizeLeft;
+	return { MakeNode({ .ullOffset { stPiece.ullOffset }, .ullSize { ullSizeFirst }, .fAdd { stPiece.fAdd } },
+		pNode->u32Prior, pNode->pLeft, nullptr),
+		MakeNode({ .ullOffset { stPiece.ullOffset + ullSizeFirst }, .ullSize { stPiece.ullSize - ullSizeFirst },
+		.fAdd { stPiece.fAdd } }, pNode->u32Prior, nullptr, pNode->pRight) };
+}
\ No newline at end of file
@@ -0,0 +1,322 @@
+/****************************************************************************************
+* Copyright © 2018-present Jovibor https://github.com/jovibor/                          *
+* Hex Control for Windows applications.                                                 *
+* Official git repository: https://github.com/jovibor/HexCtrl/                          *
+* This software is available under "The HexCtrl License", see the LICENSE file.         *
+****************************************************************************************/
+module;
+#include <SDKDDKVer.h>
+#include "../HexCtrl.h"
+#include <Windows.h>
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <optional>
+#include <vector>
+export module HEXCTRL:CHexUndo;
+
+import :HexUtility;
+
+namespace HEXCTRL::INTERNAL {
+	//Undo/Redo journal of the data modifications, within the memory budget.
+	//Steps are kept in the ring buffer, the oldest ones are dropped when the steps limit or the budget is reached.
+	//Data is stored compactly: the span of one repeated byte (e.g. after a fill) is stored as that byte only,
+	//and the self-inverse operations (XOR, NOT, bit reverse, byte swap) are stored as the operation itself.
+	//Data of the step that doesn't fit into the budget is kept in the temporary file, and read back chunk by chunk.
+	class CHexUndo final {
+	public:
+		struct RECORD { //Data to put back to the span.
+			ULONGLONG              ullOffset { };
+			ULONGLONG              ullSize { };
+			ULONGLONG              ullFileOffset { }; //Data offset in the temporary file, if fFile.
+			std::vector<std::byte> vecData; //Empty if the whole span is the one bFill byte, or the data is in the file.
+			std::byte              bFill { };
+			bool                   fFile { };   //Data is in the temporary file.
+		};
+		struct OPER { //Self-inverse operation, it's undone and redone by applying it once again.
+			VecHexSpan             vecSpan;
+			std::vector<std::byte> vecOperand;
+			EHexOperMode           eOperMode { };
+			EHexDataType           eDataType { };
+			bool                   fBigEndian { };
+		};
+		struct STEP {
+			std::vector<RECORD> vecRecords;
+			std::optional<OPER> optOper;  //Operation instead of the records.
+			ULONGLONG           ullBytes { }; //Memory the step takes.
+			ULONGLONG           ullFileBytes { }; //Temporary file space the step takes.
+		};
+		~CHexUndo();
+		[[nodiscard]] bool CanRedo()const;
+		[[nodiscard]] bool CanUndo()const;
+		void Clear();
+		[[nodiscard]] bool FileRead(ULONGLONG ullOffset, SpanByte spnData)const;
+		[[nodiscard]] auto FileReserve(ULONGLONG ullSize) -> std::optional<ULONGLONG>; //File space for the record's data.
+		[[nodiscard]] bool FileWrite(ULONGLONG ullOffset, SpanCByte spnData)const;
+		[[nodiscard]] auto GetBudget()const -> ULONGLONG;
+		void Push(STEP&& stStep); //New step after the Undo ones, all Redo steps are dropped.
+		//FuncApply(STEP&) applies the step and turns it into its own reverse, returns false if it failed.
+		template<typename TFunc>
+		bool Redo(const TFunc& FuncApply);
+		void SetBudget(ULONGLONG ullBudget);
+		template<typename TFunc>
+		bool Undo(const TFunc& FuncApply);
+		static void RecordAppend(RECORD& stRec, SpanCByte spnData); //Data is kept as the fill byte while it's the same.
+	private:
+		[[nodiscard]] auto At(std::size_t uzIndex) -> STEP&; //Step by its index from the oldest one.
+		void FileClose();
+		void PopOldest();
+		void StepRelease(STEP& stStep); //Frees the step's memory and file space.
+		void TrimToBudget(); //Drops the oldest Undo steps until the journal is within the budget.
+		[[nodiscard]] static auto GetStepBytes(const STEP& stStep) -> ULONGLONG;
+	private:
+		static constexpr auto m_uzStepsMax { 512U }; //Steps' max limit, the ring buffer's capacity.
+		std::vector<STEP> m_vecRing;   //Ring buffer of the steps.
+		std::size_t m_uzHead { };      //The oldest step's position in the ring buffer.
+		std::size_t m_uzCount { };     //All steps, Undo and Redo ones.
+		std::size_t m_uzUndo { };      //Undo steps, the first ones from the oldest, the rest are Redo ones.
+		ULONGLONG m_ullBytes { };      //Memory all the steps take.
+		ULONGLONG m_ullBudget { 0x10000000ULL };
+		ULONGLONG m_ullFileEnd { };    //End of the reserved space in the temporary file.
+		ULONGLONG m_ullFileBytes { };  //File space all the steps take, the file is reset when it's zero.
+		HANDLE m_hFile { INVALID_HANDLE_VALUE }; //Temporary file, it's created on the first use.
+	};
+}
+
+using namespace HEXCTRL::INTERNAL;
+
+CHexUndo::~CHexUndo()
+{
+	FileClose();
+}
+
+bool CHexUndo::CanRedo()const
+{
+	return m_uzUndo < m_uzCount;
+}
+
+bool CHexUndo::CanUndo()const
+{
+	return m_uzUndo > 0;
+}
+
+void CHexUndo::Clear()
+{
+	m_vecRing.clear();
+	m_uzHead = 0;
+	m_uzCount = 0;
+	m_uzUndo = 0;
+	m_ullBytes = 0;
+	FileClose();
+}
+
+bool CHexUndo::FileRead(ULONGLONG ullOffset, SpanByte spnData)const
+{
+	assert(spnData.size() <= (std::numeric_limits<DWORD>::max)());
+	OVERLAPPED stOvl { .Offset { static_cast<DWORD>(ullOffset) }, .OffsetHigh { static_cast<DWORD>(ullOffset >> 32) } };
+	DWORD dwRead { };
+	return ::ReadFile(m_hFile, spnData.data(), static_cast<DWORD>(spnData.size()), &dwRead, &stOvl) != FALSE
+		&& dwRead == spnData.size();
+}
+
+auto CHexUndo::FileReserve(ULONGLONG ullSize)->std::optional<ULONGLONG>
+{
+	if (m_hFile == INVALID_HANDLE_VALUE) {
+		wchar_t buffPath[MAX_PATH];
+		wchar_t buffName[MAX_PATH];
+		if (::GetTempPathW(MAX_PATH, buffPath) == 0 || ::GetTempFileNameW(buffPath, L"hex", 0, buffName) == 0) {
+			ut::DBG_REPORT(L"GetTempFileNameW failed.");
+			return std::nullopt;
+		}
+
+		m_hFile = ::CreateFileW(buffName, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+			FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+		if (m_hFile == INVALID_HANDLE_VALUE) {
+			::DeleteFileW(buffName);
+			ut::DBG_REPORT(L"CreateFileW failed.");
+			return std::nullopt;
+		}
+	}
+
+	//Space is taken from the end of the file, it's reused only after all the file steps are gone.
+	const auto ullOffset = m_ullFileEnd;
+	m_ullFileEnd += ullSize;
+
+	return ullOffset;
+}
+
+bool CHexUndo::FileWrite(ULONGLONG ullOffset, SpanCByte spnData)const
+{
+	assert(spnData.size() <= (std::numeric_limits<DWORD>::max)());
+	OVERLAPPED stOvl { .Offset { static_cast<DWORD>(ullOffset) }, .OffsetHigh { static_cast<DWORD>(ullOffset >> 32) } };
+	DWORD dwWritten { };
+	return ::WriteFile(m_hFile, spnData.data(), static_cast<DWORD>(spnData.size()), &dwWritten, &stOvl) != FALSE
+		&& dwWritten == spnData.size();
+}
+
+auto CHexUndo::GetBudget()const->ULONGLONG
+{
+	return m_ullBudget;
+}
+
+void CHexUndo::Push(STEP&& stStep)
+{
+	//The step's file space is accounted first, so that it's not freed along with the dropped steps.
+	for (const auto& stRec : stStep.vecRecords) {
+		stStep.ullFileBytes += stRec.fFile ? stRec.ullSize : 0;
+	}
+	m_ullFileBytes += stStep.ullFileBytes;
+
+	while (m_uzCount > m_uzUndo) { //Redo steps are of no use after a new modification.
+		StepRelease(At(--m_uzCount));
+	}
+
+	stStep.ullBytes = GetStepBytes(stStep);
+	if (stStep.ullBytes > m_ullBudget) { //Older steps can't be undone past the step that can't be kept.
+		Clear();
+		return;
+	}
+
+	while (m_uzCount > 0 && (m_uzCount == m_uzStepsMax || m_ullBytes + stStep.ullBytes > m_ullBudget)) {
+		PopOldest();
+	}
+
+	if (m_vecRing.empty()) {
+		m_vecRing.resize(m_uzStepsMax);
+	}
+
+	m_ullBytes += stStep.ullBytes;
+	At(m_uzCount++) = std::move(stStep);
+	m_uzUndo = m_uzCount;
+}
+
+template<typename TFunc>
+bool CHexUndo::Redo(const TFunc& FuncApply)
+{
+	if (!CanRedo())
+		return false;
+
+	auto& stStep = At(m_uzUndo);
+	m_ullBytes -= stStep.ullBytes;
+	if (!FuncApply(stStep)) {
+		Clear();
+		return false;
+	}
+
+	stStep.ullBytes = GetStepBytes(stStep);
+	m_ullBytes += stStep.ullBytes;
+	++m_uzUndo;
+	TrimToBudget();
+
+	return true;
+}
+
+void CHexUndo::SetBudget(ULONGLONG ullBudget)
+{
+	m_ullBudget = ullBudget;
+	TrimToBudget();
+}
+
+template<typename TFunc>
+bool CHexUndo::Undo(const TFunc& FuncApply)
+{
+	if (!CanUndo())
+		return false;
+
+	auto& stStep = At(m_uzUndo - 1);
+	m_ullBytes -= stStep.ullBytes;
+	if (!FuncApply(stStep)) {
+		Clear();
+		return false;
+	}
+
+	stStep.ullBytes = GetStepBytes(stStep);
+	m_ullBytes += stStep.ullBytes;
+	--m_uzUndo;
+	TrimToBudget();
+
+	return true;
+}
+
+void CHexUndo::RecordAppend(RECORD& stRec, SpanCByte spnData)
+{
+	if (spnData.empty())
+		return;
+
+	if (stRec.vecData.empty()) {
+		const auto bFill = stRec.ullSize == 0 ? spnData.front() : stRec.bFill;
+		if (std::all_of(spnData.begin(), spnData.end(), [bFill](std::byte byte) { return byte == bFill; })) {
+			stRec.bFill = bFill;
+			stRec.ullSize += spnData.size();
+			return;
+		}
+
+		stRec.vecData.assign(static_cast<std::size_t>(stRec.ullSize), stRec.bFill); //Data is not the one byte anymore.
+	}
+
+	stRec.vecData.insert(stRec.vecData.end(), spnData.begin(), spnData.end());
+	stRec.ullSize += spnData.size();
+}
+
+
+//Private methods.
+
+auto CHexUndo::At(std::size_t uzIndex)->STEP&
+{
+	return m_vecRing[(m_uzHead + uzIndex) % m_uzStepsMax];
+}
+
+void CHexUndo::FileClose()
+{
+	if (m_hFile != INVALID_HANDLE_VALUE) {
+		::CloseHandle(m_hFile); //The file is deleted on close.
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+
+	m_ullFileEnd = 0;
+	m_ullFileBytes = 0;
+}
+
+void CHexUndo::PopOldest()
+{
+	StepRelease(At(0));
+	m_uzHead = (m_uzHead + 1) % m_uzStepsMax;
+	--m_uzCount;
+	--m_uzUndo;
+}
+
+void CHexUndo::StepRelease(STEP& stStep)
+{
+	m_ullBytes -= stStep.ullBytes;
+	m_ullFileBytes -= stStep.ullFileBytes;
+	stStep = { };
+
+	if (m_ullFileBytes == 0 && m_ullFileEnd > 0) { //No data is in the file anymore, its space is freed.
+		LARGE_INTEGER llZero { };
+		::SetFilePointerEx(m_hFile, llZero, nullptr, FILE_BEGIN);
+		::SetEndOfFile(m_hFile);
+		m_ullFileEnd = 0;
+	}
+}
+
+void CHexUndo::TrimToBudget()
+{
+	//Only Undo steps are dropped, Redo steps can't be redone without the older Redo ones.
+	while (m_uzUndo > 0 && m_ullBytes > m_ullBudget) {
+		PopOldest();
+	}
+}
+
+auto CHexUndo::GetStepBytes(const STEP& stStep)->ULONGLONG
+{
+	auto ullBytes = static_cast<ULONGLONG>(sizeof(STEP) + stStep.vecRecords.size() * sizeof(RECORD));
+	for (const auto& stRec : stStep.vecRecords) {
+		ullBytes += stRec.vecData.size();
+	}
+
+	if (stStep.optOper) {
+		ullBytes += stStep.optOper->vecSpan.size() * sizeof(HEXSPAN) + stStep.optOper->vecOperand.size();
+	}
+
+	return ullBytes;
+}
@@ -14,6 +14,7 @@ module;
 #include <bit>
 #include <cassert>
 #include <cmath>
+#include <cstring>
 #include <cwctype>
 #include <format>
 #include <locale>
@@ -334,6 +335,80 @@ namespace HEXCTRL::INTERNAL::ut { //Utility methods and stuff.
 		return { pBegin, pEnd };
 	}
 
+	//Maps data offsets through the data size change, where the edits' bytes were inserted (fInsert), or removed.
+	//Edits are sorted, don't overlap and are in the offsets the data had before the change.
+	class COffsetShift final {
+	public:
+		COffsetShift() = default;
+		COffsetShift(SpanHexSpan spnEdits, bool fInsert);
+		[[nodiscard]] auto GetInverse()const -> COffsetShift; //Shift that maps the offsets back.
+		[[nodiscard]] bool IsEmpty()const;
+		[[nodiscard]] auto Offset(ULONGLONG ullOffset)const -> ULONGLONG; //Removed bytes collapse to the removal's offset.
+		[[nodiscard]] auto Span(const HEXSPAN& hs)const -> HEXSPAN;      //Span of zero size if all its bytes were removed.
+	private:
+		VecHexSpan m_vecEdits;
+		std::vector<ULONGLONG> m_vecSizeBefore; //Sum of the sizes of all edits before the given one.
+		bool m_fInsert { };
+	};
+
+	COffsetShift::COffsetShift(SpanHexSpan spnEdits, bool fInsert) :
+		m_vecEdits(spnEdits.begin(), spnEdits.end()), m_fInsert { fInsert } {
+		assert(std::is_sorted(m_vecEdits.begin(), m_vecEdits.end(), [](const HEXSPAN& lhs, const HEXSPAN& rhs) {
+			return lhs.ullOffset < rhs.ullOffset; }));
+		m_vecSizeBefore.reserve(m_vecEdits.size());
+		auto ullSizeBefore = 0ULL;
+		for (const auto& hs : m_vecEdits) {
+			m_vecSizeBefore.emplace_back(ullSizeBefore);
+			ullSizeBefore += hs.ullSize;
+		}
+	}
+
+	auto COffsetShift::GetInverse()const->COffsetShift {
+		//Inserted bytes are removed and vice versa, at the offsets the data has after the change.
+		VecHexSpan vecEdits;
+		vecEdits.reserve(m_vecEdits.size());
+		for (std::size_t uzIndex = 0; uzIndex < m_vecEdits.size(); ++uzIndex) {
+			const auto& hs = m_vecEdits[uzIndex];
+			vecEdits.emplace_back(m_fInsert ? hs.ullOffset + m_vecSizeBefore[uzIndex]
+				: hs.ullOffset - m_vecSizeBefore[uzIndex], hs.ullSize);
+		}
+
+		return { vecEdits, !m_fInsert };
+	}
+
+	bool COffsetShift::IsEmpty()const {
+		return m_vecEdits.empty();
+	}
+
+	auto COffsetShift::Offset(ULONGLONG ullOffset)const->ULONGLONG {
+		//The last edit at, or before, the offset.
+		const auto it = std::upper_bound(m_vecEdits.begin(), m_vecEdits.end(), ullOffset,
+			[](ULONGLONG ullOff, const HEXSPAN& hs) { return ullOff < hs.ullOffset; });
+		if (it == m_vecEdits.begin())
+			return ullOffset;
+
+		const auto uzIndex = static_cast<std::size_t>(it - m_vecEdits.begin()) - 1;
+		const auto& hs = m_vecEdits[uzIndex];
+		const auto ullSizeBefore = m_vecSizeBefore[uzIndex];
+		if (m_fInsert)
+			return ullOffset + ullSizeBefore + hs.ullSize;
+
+		if (ullOffset < hs.ullOffset + hs.ullSize) //Offset within the removed bytes.
+			return hs.ullOffset - ullSizeBefore;
+
+		return ullOffset - ullSizeBefore - hs.ullSize;
+	}
+
+	auto COffsetShift::Span(const HEXSPAN& hs)const->HEXSPAN {
+		//Bytes inserted at the span's very start move the span, bytes inserted within it make it bigger.
+		const auto ullBegin = Offset(hs.ullOffset);
+		if (hs.ullSize == 0)
+			return { ullBegin, 0 };
+
+		const auto ullEnd = m_fInsert ? Offset(hs.ullOffset + hs.ullSize - 1) + 1 : Offset(hs.ullOffset + hs.ullSize);
+		return { ullBegin, ullEnd - ullBegin };
+	}
+
 	[[nodiscard]] auto GetLocale() -> std::locale {
 		static const auto loc { std::locale("en_US.UTF-8") };
 		return loc;
@@ -1744,8 +1819,37 @@ namespace HEXCTRL::INTERNAL::simd {
 	#endif
 	}
 
+	[[nodiscard]] bool HasAVX512() { //AVX-512F, AVX-512BW, and AVX-512VL.
+	#if defined(HEXCTRL_FORCE_AVX1) || defined(HEXCTRL_FORCE_AVX2)
+		return false;
+	#elif defined(HEXCTRL_FORCE_AVX512) // ^^^ HEXCTRL_FORCE_AVX1 || HEXCTRL_FORCE_AVX2 / vvv HEXCTRL_FORCE_AVX512
+		return true;
+	#else // ^^^ HEXCTRL_FORCE_AVX512 / vvv Runtime check.
+		const static bool fHasAVX512 = []() {
+			int arrInfo[4] { };
+			::__cpuid(arrInfo, 0);
+			if (arrInfo[0] < 7)
+				return false;
+
+			::__cpuid(arrInfo, 1);
+			if ((arrInfo[2] & (1 << 27)) == 0) //OSXSAVE, the _xgetbv is available.
+				return false;
+
+			//The OS must save the XMM, YMM, opmask, and ZMM registers state on the context switch.
+			if ((::_xgetbv(0) & 0b11100110) != 0b11100110)
+				return false;
+
+			::__cpuid(arrInfo, 7);
+			constexpr auto iAVX512FBWVL = (1 << 16) | (1 << 30) | (1 << 31);
+			return (arrInfo[1] & iAVX512FBWVL) == iAVX512FBWVL;
+			}();
+		return fHasAVX512;
+	#endif
+	}
+
 	template<typename T> concept TVec128 = (std::is_same_v<T, __m128> || std::is_same_v<T, __m128i> || std::is_same_v<T, __m128d>);
 	template<typename T> concept TVec256 = (std::is_same_v<T, __m256> || std::is_same_v<T, __m256i> || std::is_same_v<T, __m256d>);
+	template<typename T> concept TVec512 = (std::is_same_v<T, __m512> || std::is_same_v<T, __m512i> || std::is_same_v<T, __m512d>);
 
 	template<ut::TSize1248 TIntegral, TVec128 TVec>	//Bytes swap inside vector types: __m128, __m128i, __m128d.
 	[[nodiscard]] auto __vectorcall ByteSwapVec(const TVec m128T) -> TVec {
@@ -1823,13 +1927,46 @@ namespace HEXCTRL::INTERNAL::simd {
 			return _mm256_load_pd(dblData); //Returning local array as __m256d.
 		}
 	}
+
+	template<ut::TSize1248 TIntegral, TVec512 TVec>	//Bytes swap inside vector types: __m512, __m512i, __m512d.
+	[[nodiscard]] auto __vectorcall ByteSwapVec(const TVec m512T) -> TVec {
+		if constexpr (sizeof(TIntegral) == sizeof(std::uint8_t)) { //1 bytes.
+			return m512T;
+		}
+		else {
+			//The _mm512_shuffle_epi8 shuffles inside each 128-bit lane, so the same mask is used for all four lanes.
+			__m128i m128iMask;
+			if constexpr (sizeof(TIntegral) == sizeof(std::uint16_t)) { //2 bytes.
+				m128iMask = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+			}
+			else if constexpr (sizeof(TIntegral) == sizeof(std::uint32_t)) { //4 bytes.
+				m128iMask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+			}
+			else if constexpr (sizeof(TIntegral) == sizeof(std::uint64_t)) { //8 bytes.
+				m128iMask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+			}
+			const auto m512iMask = _mm512_broadcast_i32x4(m128iMask);
+
+			if constexpr (std::is_same_v<TVec, __m512i>) { //Integrals.
+				return _mm512_shuffle_epi8(m512T, m512iMask);
+			}
+			else if constexpr (std::is_same_v<TVec, __m512>) { //Floats.
+				return _mm512_castsi512_ps(_mm512_shuffle_epi8(_mm512_castps_si512(m512T), m512iMask));
+			}
+			else if constexpr (std::is_same_v<TVec, __m512d>) { //Doubles.
+				return _mm512_castsi512_pd(_mm512_shuffle_epi8(_mm512_castpd_si512(m512T), m512iMask));
+			}
+		}
+	}
 #endif // ^^^ _M_IX86 || _M_X64
 
 	enum class EVecType : std::uint8_t {
 		VECTOR_128 = 16U, //SSE4.2, ARM64NEON.
-		VECTOR_256 = 32U  //AVX2.
+		VECTOR_256 = 32U, //AVX2.
+		VECTOR_512 = 64U  //AVX-512BW/VL.
 	};
 
+	//Vector type for all the kernels, VECTOR_128 or VECTOR_256.
 	[[nodiscard]] auto GetVectorType() -> EVecType {
 		using enum EVecType;
 	#if defined(_M_IX86) || defined(_M_X64)
@@ -1839,16 +1976,59 @@ namespace HEXCTRL::INTERNAL::simd {
 	#endif //^^^ _M_ARM64
 	}
 
+	//Widest vector type, the kernels' function pointers are chosen by it once, at their first use.
+	//Only the MemCmpEQ1/2/4 and ModifyOperVec have the VECTOR_512 tier, the rest of the kernels
+	//work with the 32-bit masks, and take the GetVectorType's tier instead.
+	[[nodiscard]] auto GetVectorTypeMax() -> EVecType {
+	#if defined(_M_IX86) || defined(_M_X64)
+		return HasAVX512() ? EVecType::VECTOR_512 : GetVectorType();
+	#elif defined(_M_ARM64) //^^^ _M_IX86 || _M_X64 / vvv _M_ARM64
+		return GetVectorType();
+	#endif //^^^ _M_ARM64
+	}
+
 	[[nodiscard]] constexpr auto VecTypeToSize(EVecType eVecType) -> std::uint32_t {
 		using enum EVecType;
 		switch (eVecType) {
 		case VECTOR_128: return 16U;
 		case VECTOR_256: return 32U;
+		case VECTOR_512: return 64U;
 		default:
 			return 0U;
 		};
 	}
 
+	//Mask of the sizeof(vec) offsets that are multiples of the u32Step, counted from the first offset,
+	//or from the last one if fFromLast. Vectorized step search uses it to mask out offsets that are off the step.
+	[[nodiscard]] constexpr auto StepMask(EVecType eVecType, std::uint32_t u32Step, bool fFromLast = false) -> std::uint32_t {
+		const auto u32VecSize = VecTypeToSize(eVecType);
+		std::uint32_t u32Mask { };
+		for (auto i = 0U; i < u32VecSize; i += u32Step) {
+			u32Mask |= 1U << (fFromLast ? u32VecSize - 1 - i : i);
+		}
+
+		return u32Mask;
+	}
+
+	//Set of bytes for the FindFirstOf, split into the low and high nibbles lookup tables.
+	//The byte is in the set if (arrLo[byte & 0x0F] & arrHi[byte >> 4]) != 0. Bytes whose high nibbles
+	//differ only in the 4th bit share the same bit, so the check can give false positives, but never false negatives.
+	struct NIBBLESET {
+		alignas(16) std::uint8_t arrLo[16] { };
+		alignas(16) std::uint8_t arrHi[16] { };
+	};
+
+	[[nodiscard]] constexpr auto MakeNibbleSet(std::span<const std::uint8_t> spnBytes) -> NIBBLESET {
+		NIBBLESET stSet;
+		for (const auto u8Byte : spnBytes) {
+			const auto u8Bit = static_cast<std::uint8_t>(1U << ((u8Byte >> 4) & 0x07U));
+			stSet.arrLo[u8Byte & 0x0FU] |= u8Bit;
+			stSet.arrHi[u8Byte >> 4] = u8Bit;
+		}
+
+		return stSet;
+	}
+
 //MemCmp*.
 #if defined(_M_IX86) || defined(_M_X64)
 	template<EVecType eVecType, bool fEqual = true>
@@ -1881,6 +2061,23 @@ namespace HEXCTRL::INTERNAL::simd {
 
 			return std::countr_zero(u32Mask);
 		}
+		else if constexpr (eVecType == EVecType::VECTOR_512) {
+			const auto m512iWhere = _mm512_loadu_si512(pWhere);
+			const auto m512iWhat = _mm512_set1_epi8(static_cast<char>(u8What));
+			std::uint64_t u64Mask; //AVX-512BW compares straight into the 64-bit mask register, no movemask needed.
+			if constexpr (fEqual) {
+				u64Mask = _mm512_cmpeq_epi8_mask(m512iWhere, m512iWhat);
+			}
+			else {
+				u64Mask = _mm512_cmpneq_epi8_mask(m512iWhere, m512iWhat);
+			}
+
+			if (u64Mask == 0) {
+				return 0xFFFFFFFFU;
+			}
+
+			return std::countr_zero(u64Mask);
+		}
 	}
 
 	template<EVecType eVecType, bool fEqual = true>
@@ -1942,6 +2139,26 @@ namespace HEXCTRL::INTERNAL::simd {
 			const auto iRes1 = std::countr_zero(u32Mask1);
 			return (std::min)(iRes0, iRes1); //>31 here means not found, all in mask are zeros.
 		}
+		else if constexpr (eVecType == EVecType::VECTOR_512) {
+			//Instead of the shifted vector, the second load is at pWhere + 1, so all 64 offsets are checked.
+			//Each byte of the u16What is compared with its own load, the bit N of the ANDed masks is set
+			//if both bytes at the offset N match. The caller must have one more byte after the 64 bytes vector.
+			const auto m512iWhere0 = _mm512_loadu_si512(pWhere);
+			const auto m512iWhere1 = _mm512_loadu_si512(pWhere + 1);
+			const auto u64Mask0 = _mm512_cmpeq_epi8_mask(m512iWhere0, _mm512_set1_epi8(static_cast<char>(u16What & 0xFFU)));
+			const auto u64Mask1 = _mm512_cmpeq_epi8_mask(m512iWhere1, _mm512_set1_epi8(static_cast<char>(u16What >> 8)));
+			std::uint64_t u64Mask = u64Mask0 & u64Mask1;
+
+			if constexpr (!fEqual) {
+				u64Mask = ~u64Mask;
+			}
+
+			if (u64Mask == 0) {
+				return 0xFFFFFFFFU;
+			}
+
+			return std::countr_zero(u64Mask);
+		}
 	}
 
 	template<EVecType eVecType, bool fEqual = true>
@@ -2022,6 +2239,420 @@ namespace HEXCTRL::INTERNAL::simd {
 			const auto iRes3 = std::countr_zero(u32Mask3);
 			return (std::min)(iRes0, (std::min)(iRes1, (std::min)(iRes2, iRes3)));
 		}
+		else if constexpr (eVecType == EVecType::VECTOR_512) {
+			//Same as in the MemCmpEQ2, four loads at pWhere + 0...3 for the four bytes of the u32What.
+			//The caller must have three more bytes after the 64 bytes vector.
+			std::uint64_t u64Mask = 0xFFFFFFFFFFFFFFFFULL;
+			for (auto i = 0; i < 4; ++i) {
+				const auto m512iWhere = _mm512_loadu_si512(pWhere + i);
+				const auto m512iWhat = _mm512_set1_epi8(static_cast<char>((u32What >> (i * 8)) & 0xFFU));
+				u64Mask &= _mm512_cmpeq_epi8_mask(m512iWhere, m512iWhat);
+			}
+
+			if constexpr (!fEqual) {
+				u64Mask = ~u64Mask;
+			}
+
+			if (u64Mask == 0) {
+				return 0xFFFFFFFFU;
+			}
+
+			return std::countr_zero(u64Mask);
+		}
+	}
+
+	//Index of the first byte that is (possibly) in the set, or 0xFFFFFFFFU if there are none.
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline auto FindFirstOf(const std::byte* pWhere, const NIBBLESET& stSet)noexcept -> std::uint64_t {
+		if constexpr (eVecType == EVecType::VECTOR_128) {
+			const auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere));
+			const auto m128iNibble = _mm_set1_epi8(0x0F);
+			const auto m128iLo = _mm_and_si128(m128iWhere, m128iNibble);
+			const auto m128iHi = _mm_and_si128(_mm_srli_epi16(m128iWhere, 4), m128iNibble); //No 8-bit shift in SSE.
+			const auto m128iBitsLo = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(stSet.arrLo)), m128iLo);
+			const auto m128iBitsHi = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(stSet.arrHi)), m128iHi);
+			const auto m128iResult = _mm_cmpeq_epi8(_mm_and_si128(m128iBitsLo, m128iBitsHi), _mm_setzero_si128());
+			const std::uint32_t u32Mask = _mm_movemask_epi8(m128iResult) ^ 0xFFFF; //Inverting the "not in set" mask.
+			if (u32Mask == 0) {
+				return 0xFFFFFFFFU;
+			}
+
+			return std::countr_zero(u32Mask);
+		}
+		else if constexpr (eVecType == EVecType::VECTOR_256) {
+			const auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere));
+			const auto m256iNibble = _mm256_set1_epi8(0x0F);
+			const auto m256iLo = _mm256_and_si256(m256iWhere, m256iNibble);
+			const auto m256iHi = _mm256_and_si256(_mm256_srli_epi16(m256iWhere, 4), m256iNibble);
+			//_mm256_shuffle_epi8 works within 128-bit lanes, so tables are duplicated in both lanes.
+			const auto m256iTblLo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(stSet.arrLo)));
+			const auto m256iTblHi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(stSet.arrHi)));
+			const auto m256iBits = _mm256_and_si256(_mm256_shuffle_epi8(m256iTblLo, m256iLo), _mm256_shuffle_epi8(m256iTblHi, m256iHi));
+			const auto m256iResult = _mm256_cmpeq_epi8(m256iBits, _mm256_setzero_si256());
+			const std::uint32_t u32Mask = _mm256_movemask_epi8(m256iResult) ^ 0xFFFFFFFFU;
+			if (u32Mask == 0) {
+				return 0xFFFFFFFFU;
+			}
+
+			return std::countr_zero(u32Mask);
+		}
+	}
+
+	//Mask of the offsets where uzSize bytes differ from the pWhat in no more than u8MaxErrors bytes (Hamming distance):
+	//bit N is for the pWhere + N. Reads sizeof(vec) + uzSize - 1 bytes. Mismatches of all the sizeof(vec) offsets
+	//are counted at once, in 8-bit lanes, and the counting stops as soon as all the lanes are over the u8MaxErrors.
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline auto HammingMask(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize,
+		std::uint8_t u8MaxErrors)noexcept -> std::uint32_t {
+		if constexpr (eVecType == EVecType::VECTOR_128) {
+			const auto m128iMax = _mm_set1_epi8(static_cast<char>(u8MaxErrors));
+			const auto m128iOne = _mm_set1_epi8(1);
+			auto m128iErrors = _mm_setzero_si128();
+			std::uint32_t u32Mask { 0xFFFFU };
+			for (std::size_t i = 0; i < uzSize; ++i) {
+				const auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + i));
+				const auto m128iEq = _mm_cmpeq_epi8(m128iWhere, _mm_set1_epi8(static_cast<char>(pWhat[i])));
+				m128iErrors = _mm_adds_epu8(m128iErrors, _mm_andnot_si128(m128iEq, m128iOne)); //Saturated, no wrap around.
+				if (i >= u8MaxErrors) { //Lanes within the limit: min(errors, max) == errors.
+					u32Mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(m128iErrors, m128iMax), m128iErrors)));
+					if (u32Mask == 0)
+						break;
+				}
+			}
+
+			return u32Mask;
+		}
+		else if constexpr (eVecType == EVecType::VECTOR_256) {
+			const auto m256iMax = _mm256_set1_epi8(static_cast<char>(u8MaxErrors));
+			const auto m256iOne = _mm256_set1_epi8(1);
+			auto m256iErrors = _mm256_setzero_si256();
+			std::uint32_t u32Mask { 0xFFFFFFFFU };
+			for (std::size_t i = 0; i < uzSize; ++i) {
+				const auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + i));
+				const auto m256iEq = _mm256_cmpeq_epi8(m256iWhere, _mm256_set1_epi8(static_cast<char>(pWhat[i])));
+				m256iErrors = _mm256_adds_epu8(m256iErrors, _mm256_andnot_si256(m256iEq, m256iOne));
+				if (i >= u8MaxErrors) {
+					u32Mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(m256iErrors, m256iMax), m256iErrors)));
+					if (u32Mask == 0)
+						break;
+				}
+			}
+
+			return u32Mask;
+		}
+	}
+
+	//Mask of the offsets where T data equals (or not equals if !fEqual) the tWhat: bit N is for the pWhere + N.
+	//All sizeof(vec) offsets are checked, unlike in the MemCmpEQ*, reads sizeof(vec) + sizeof(T) - 1 bytes.
+	//Every load, one byte further than the previous, checks every sizeof(T)-th offset, and only
+	//the movemask bits of the lanes' first bytes are taken, so the mask can be scanned in both directions.
+	//With the u32Step (power of two) only the loads for the offsets on the step are done: multiples of the u32Step
+	//counted from the first offset, or from the last one if fFromLast. Only these offsets' bits are valid,
+	//the others must be masked out with the StepMask.
+	template<EVecType eVecType, ut::TSize1248 T, bool fEqual = true>
+	[[nodiscard]] __forceinline auto MemCmpEQMask(const std::byte* pWhere, T tWhat, std::uint32_t u32Step = 1,
+		bool fFromLast = false)noexcept -> std::uint32_t {
+		constexpr std::uint32_t u32LaneFirst = sizeof(T) == 1 ? 0xFFFFFFFFU : (sizeof(T) == 2 ? 0x55555555U :
+			(sizeof(T) == 4 ? 0x11111111U : 0x01010101U));
+		std::uint32_t u32Mask { };
+		for (auto i = fFromLast ? (u32Step - 1) % sizeof(T) : 0U; i < sizeof(T); i += u32Step) {
+			std::uint32_t u32MaskLoad;
+			if constexpr (eVecType == EVecType::VECTOR_128) {
+				const auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + i));
+				if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+					u32MaskLoad = _mm_movemask_epi8(_mm_cmpeq_epi8(m128iWhere, _mm_set1_epi8(static_cast<char>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+					u32MaskLoad = _mm_movemask_epi8(_mm_cmpeq_epi16(m128iWhere, _mm_set1_epi16(static_cast<short>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+					u32MaskLoad = _mm_movemask_epi8(_mm_cmpeq_epi32(m128iWhere, _mm_set1_epi32(static_cast<int>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+					u32MaskLoad = _mm_movemask_epi8(_mm_cmpeq_epi64(m128iWhere, _mm_set1_epi64x(static_cast<long long>(tWhat))));
+				}
+			}
+			else if constexpr (eVecType == EVecType::VECTOR_256) {
+				const auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + i));
+				if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+					u32MaskLoad = _mm256_movemask_epi8(_mm256_cmpeq_epi8(m256iWhere, _mm256_set1_epi8(static_cast<char>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+					u32MaskLoad = _mm256_movemask_epi8(_mm256_cmpeq_epi16(m256iWhere, _mm256_set1_epi16(static_cast<short>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+					u32MaskLoad = _mm256_movemask_epi8(_mm256_cmpeq_epi32(m256iWhere, _mm256_set1_epi32(static_cast<int>(tWhat))));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+					u32MaskLoad = _mm256_movemask_epi8(_mm256_cmpeq_epi64(m256iWhere, _mm256_set1_epi64x(static_cast<long long>(tWhat))));
+				}
+			}
+			u32Mask |= (u32MaskLoad & u32LaneFirst) << i;
+		}
+
+		if constexpr (!fEqual) {
+			u32Mask ^= eVecType == EVecType::VECTOR_128 ? 0xFFFFU : 0xFFFFFFFFU;
+		}
+
+		return u32Mask;
+	}
+
+	//Lanes of the T numbers that are within the [tFrom, tTo] range are set to all ones.
+	template<ut::TSize1248 T>
+	[[nodiscard]] __forceinline auto __vectorcall InRangeVec(const __m128i m128iData, T tFrom, T tTo)noexcept -> __m128i {
+		if constexpr (std::is_same_v<T, float>) {
+			const auto m128Data = _mm_castsi128_ps(m128iData);
+			return _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(m128Data, _mm_set1_ps(tFrom)), _mm_cmple_ps(m128Data, _mm_set1_ps(tTo))));
+		}
+		else if constexpr (std::is_same_v<T, double>) {
+			const auto m128dData = _mm_castsi128_pd(m128iData);
+			return _mm_castpd_si128(_mm_and_pd(_mm_cmpge_pd(m128dData, _mm_set1_pd(tFrom)), _mm_cmple_pd(m128dData, _mm_set1_pd(tTo))));
+		}
+		else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+			//There are no 64-bit min/max before AVX-512, so compares are used instead.
+			//Unsigned numbers are compared as signed ones, with the flipped sign bits.
+			auto m128iWhere = m128iData;
+			auto m128iFrom = _mm_set1_epi64x(static_cast<long long>(tFrom));
+			auto m128iTo = _mm_set1_epi64x(static_cast<long long>(tTo));
+			if constexpr (std::is_unsigned_v<T>) {
+				const auto m128iSign = _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+				m128iWhere = _mm_xor_si128(m128iWhere, m128iSign);
+				m128iFrom = _mm_xor_si128(m128iFrom, m128iSign);
+				m128iTo = _mm_xor_si128(m128iTo, m128iSign);
+			}
+			const auto m128iOut = _mm_or_si128(_mm_cmpgt_epi64(m128iFrom, m128iWhere), _mm_cmpgt_epi64(m128iWhere, m128iTo));
+			return _mm_andnot_si128(m128iOut, _mm_set1_epi8(-1));
+		}
+		else { //Number is within the range if max(number, tFrom) == number and min(number, tTo) == number.
+			if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				const auto m128iFrom = _mm_set1_epi8(static_cast<char>(tFrom));
+				const auto m128iTo = _mm_set1_epi8(static_cast<char>(tTo));
+				const auto m128iMax = std::is_signed_v<T> ? _mm_max_epi8(m128iData, m128iFrom) : _mm_max_epu8(m128iData, m128iFrom);
+				const auto m128iMin = std::is_signed_v<T> ? _mm_min_epi8(m128iData, m128iTo) : _mm_min_epu8(m128iData, m128iTo);
+				return _mm_and_si128(_mm_cmpeq_epi8(m128iMax, m128iData), _mm_cmpeq_epi8(m128iMin, m128iData));
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				const auto m128iFrom = _mm_set1_epi16(static_cast<short>(tFrom));
+				const auto m128iTo = _mm_set1_epi16(static_cast<short>(tTo));
+				const auto m128iMax = std::is_signed_v<T> ? _mm_max_epi16(m128iData, m128iFrom) : _mm_max_epu16(m128iData, m128iFrom);
+				const auto m128iMin = std::is_signed_v<T> ? _mm_min_epi16(m128iData, m128iTo) : _mm_min_epu16(m128iData, m128iTo);
+				return _mm_and_si128(_mm_cmpeq_epi16(m128iMax, m128iData), _mm_cmpeq_epi16(m128iMin, m128iData));
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				const auto m128iFrom = _mm_set1_epi32(static_cast<int>(tFrom));
+				const auto m128iTo = _mm_set1_epi32(static_cast<int>(tTo));
+				const auto m128iMax = std::is_signed_v<T> ? _mm_max_epi32(m128iData, m128iFrom) : _mm_max_epu32(m128iData, m128iFrom);
+				const auto m128iMin = std::is_signed_v<T> ? _mm_min_epi32(m128iData, m128iTo) : _mm_min_epu32(m128iData, m128iTo);
+				return _mm_and_si128(_mm_cmpeq_epi32(m128iMax, m128iData), _mm_cmpeq_epi32(m128iMin, m128iData));
+			}
+		}
+	}
+
+	template<ut::TSize1248 T>
+	[[nodiscard]] __forceinline auto __vectorcall InRangeVec(const __m256i m256iData, T tFrom, T tTo)noexcept -> __m256i {
+		if constexpr (std::is_same_v<T, float>) {
+			const auto m256Data = _mm256_castsi256_ps(m256iData);
+			return _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(m256Data, _mm256_set1_ps(tFrom), _CMP_GE_OQ),
+				_mm256_cmp_ps(m256Data, _mm256_set1_ps(tTo), _CMP_LE_OQ)));
+		}
+		else if constexpr (std::is_same_v<T, double>) {
+			const auto m256dData = _mm256_castsi256_pd(m256iData);
+			return _mm256_castpd_si256(_mm256_and_pd(_mm256_cmp_pd(m256dData, _mm256_set1_pd(tFrom), _CMP_GE_OQ),
+				_mm256_cmp_pd(m256dData, _mm256_set1_pd(tTo), _CMP_LE_OQ)));
+		}
+		else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+			auto m256iWhere = m256iData;
+			auto m256iFrom = _mm256_set1_epi64x(static_cast<long long>(tFrom));
+			auto m256iTo = _mm256_set1_epi64x(static_cast<long long>(tTo));
+			if constexpr (std::is_unsigned_v<T>) {
+				const auto m256iSign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+				m256iWhere = _mm256_xor_si256(m256iWhere, m256iSign);
+				m256iFrom = _mm256_xor_si256(m256iFrom, m256iSign);
+				m256iTo = _mm256_xor_si256(m256iTo, m256iSign);
+			}
+			const auto m256iOut = _mm256_or_si256(_mm256_cmpgt_epi64(m256iFrom, m256iWhere), _mm256_cmpgt_epi64(m256iWhere, m256iTo));
+			return _mm256_andnot_si256(m256iOut, _mm256_set1_epi8(-1));
+		}
+		else {
+			if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				const auto m256iFrom = _mm256_set1_epi8(static_cast<char>(tFrom));
+				const auto m256iTo = _mm256_set1_epi8(static_cast<char>(tTo));
+				const auto m256iMax = std::is_signed_v<T> ? _mm256_max_epi8(m256iData, m256iFrom) : _mm256_max_epu8(m256iData, m256iFrom);
+				const auto m256iMin = std::is_signed_v<T> ? _mm256_min_epi8(m256iData, m256iTo) : _mm256_min_epu8(m256iData, m256iTo);
+				return _mm256_and_si256(_mm256_cmpeq_epi8(m256iMax, m256iData), _mm256_cmpeq_epi8(m256iMin, m256iData));
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				const auto m256iFrom = _mm256_set1_epi16(static_cast<short>(tFrom));
+				const auto m256iTo = _mm256_set1_epi16(static_cast<short>(tTo));
+				const auto m256iMax = std::is_signed_v<T> ? _mm256_max_epi16(m256iData, m256iFrom) : _mm256_max_epu16(m256iData, m256iFrom);
+				const auto m256iMin = std::is_signed_v<T> ? _mm256_min_epi16(m256iData, m256iTo) : _mm256_min_epu16(m256iData, m256iTo);
+				return _mm256_and_si256(_mm256_cmpeq_epi16(m256iMax, m256iData), _mm256_cmpeq_epi16(m256iMin, m256iData));
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				const auto m256iFrom = _mm256_set1_epi32(static_cast<int>(tFrom));
+				const auto m256iTo = _mm256_set1_epi32(static_cast<int>(tTo));
+				const auto m256iMax = std::is_signed_v<T> ? _mm256_max_epi32(m256iData, m256iFrom) : _mm256_max_epu32(m256iData, m256iFrom);
+				const auto m256iMin = std::is_signed_v<T> ? _mm256_min_epi32(m256iData, m256iTo) : _mm256_min_epu32(m256iData, m256iTo);
+				return _mm256_and_si256(_mm256_cmpeq_epi32(m256iMax, m256iData), _mm256_cmpeq_epi32(m256iMin, m256iData));
+			}
+		}
+	}
+
+	//Mask of the offsets where T data is within the [tFrom, tTo] range: bit N is for the pWhere + N.
+	//Data is byte-swapped before comparison if fBigEndian. The mask layout and the u32Step are the same as in the MemCmpEQMask.
+	template<EVecType eVecType, ut::TSize1248 T, bool fBigEndian = false>
+	[[nodiscard]] __forceinline auto MemCmpRngMask(const std::byte* pWhere, T tFrom, T tTo,
+		std::uint32_t u32Step = 1, bool fFromLast = false)noexcept -> std::uint32_t {
+		constexpr std::uint32_t u32LaneFirst = sizeof(T) == 1 ? 0xFFFFFFFFU : (sizeof(T) == 2 ? 0x55555555U :
+			(sizeof(T) == 4 ? 0x11111111U : 0x01010101U));
+		std::uint32_t u32Mask { };
+		for (auto i = fFromLast ? (u32Step - 1) % sizeof(T) : 0U; i < sizeof(T); i += u32Step) {
+			std::uint32_t u32MaskLoad;
+			if constexpr (eVecType == EVecType::VECTOR_128) {
+				auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + i));
+				if constexpr (fBigEndian) {
+					m128iWhere = ByteSwapVec<T>(m128iWhere); //Integral swap, for floats too.
+				}
+				u32MaskLoad = _mm_movemask_epi8(InRangeVec<T>(m128iWhere, tFrom, tTo));
+			}
+			else if constexpr (eVecType == EVecType::VECTOR_256) {
+				auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + i));
+				if constexpr (fBigEndian) {
+					m256iWhere = ByteSwapVec<T>(m256iWhere);
+				}
+				u32MaskLoad = _mm256_movemask_epi8(InRangeVec<T>(m256iWhere, tFrom, tTo));
+			}
+			u32Mask |= (u32MaskLoad & u32LaneFirst) << i;
+		}
+
+		return u32Mask;
+	}
+
+	//Lower-cases ASCII 'A'-'Z' letters in 8-bit (fWchar == false) or in 16-bit lanes:
+	//lanes within the 'A'-'Z' range are found by two compares, and OR-ed with 0x20 ('a' - 'A' = 32).
+	template<bool fWchar>
+	[[nodiscard]] __forceinline auto __vectorcall ToLowerVec(const __m128i m128iData)noexcept -> __m128i {
+		if constexpr (fWchar) {
+			const auto m128iUpper = _mm_and_si128(_mm_cmpgt_epi16(m128iData, _mm_set1_epi16('A' - 1)),
+				_mm_cmplt_epi16(m128iData, _mm_set1_epi16('Z' + 1)));
+			return _mm_or_si128(m128iData, _mm_and_si128(m128iUpper, _mm_set1_epi16(0x20)));
+		}
+		else {
+			const auto m128iUpper = _mm_and_si128(_mm_cmpgt_epi8(m128iData, _mm_set1_epi8('A' - 1)),
+				_mm_cmplt_epi8(m128iData, _mm_set1_epi8('Z' + 1)));
+			return _mm_or_si128(m128iData, _mm_and_si128(m128iUpper, _mm_set1_epi8(0x20)));
+		}
+	}
+
+	template<bool fWchar>
+	[[nodiscard]] __forceinline auto __vectorcall ToLowerVec(const __m256i m256iData)noexcept -> __m256i {
+		if constexpr (fWchar) {
+			const auto m256iUpper = _mm256_and_si256(_mm256_cmpgt_epi16(m256iData, _mm256_set1_epi16('A' - 1)),
+				_mm256_cmpgt_epi16(_mm256_set1_epi16('Z' + 1), m256iData));
+			return _mm256_or_si256(m256iData, _mm256_and_si256(m256iUpper, _mm256_set1_epi16(0x20)));
+		}
+		else {
+			const auto m256iUpper = _mm256_and_si256(_mm256_cmpgt_epi8(m256iData, _mm256_set1_epi8('A' - 1)),
+				_mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), m256iData));
+			return _mm256_or_si256(m256iData, _mm256_and_si256(m256iUpper, _mm256_set1_epi8(0x20)));
+		}
+	}
+
+	//Mask of the candidates for the long data search: bit N is set if pWhere[N] == u8First
+	//and pWhere[N + uzLastOffset] == u8Last. Reads sizeof(vec) + uzLastOffset bytes.
+	//If fMatchCase == false, data bytes are lower-cased before comparison, u8First and u8Last must be lower-case.
+	template<EVecType eVecType, bool fMatchCase = true>
+	[[nodiscard]] __forceinline auto MemCmpEQFirstLast(const std::byte* pWhere, std::uint8_t u8First, std::uint8_t u8Last,
+		std::size_t uzLastOffset)noexcept -> std::uint32_t {
+		if constexpr (eVecType == EVecType::VECTOR_128) {
+			auto m128iFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere));
+			auto m128iLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + uzLastOffset));
+			if constexpr (!fMatchCase) {
+				m128iFirst = ToLowerVec<false>(m128iFirst);
+				m128iLast = ToLowerVec<false>(m128iLast);
+			}
+			const auto m128iResult = _mm_and_si128(_mm_cmpeq_epi8(m128iFirst, _mm_set1_epi8(static_cast<char>(u8First))),
+				_mm_cmpeq_epi8(m128iLast, _mm_set1_epi8(static_cast<char>(u8Last))));
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(m128iResult));
+		}
+		else if constexpr (eVecType == EVecType::VECTOR_256) {
+			auto m256iFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere));
+			auto m256iLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + uzLastOffset));
+			if constexpr (!fMatchCase) {
+				m256iFirst = ToLowerVec<false>(m256iFirst);
+				m256iLast = ToLowerVec<false>(m256iLast);
+			}
+			const auto m256iResult = _mm256_and_si256(_mm256_cmpeq_epi8(m256iFirst, _mm256_set1_epi8(static_cast<char>(u8First))),
+				_mm256_cmpeq_epi8(m256iLast, _mm256_set1_epi8(static_cast<char>(u8Last))));
+			return static_cast<std::uint32_t>(_mm256_movemask_epi8(m256iResult));
+		}
+	}
+
+	//Are uzSize bytes at pWhere and at pWhat equal.
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline bool MemEqual(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize)noexcept {
+		std::size_t uzOffset { 0 };
+		if constexpr (eVecType == EVecType::VECTOR_128) {
+			for (; uzOffset + 16U <= uzSize; uzOffset += 16U) {
+				const auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + uzOffset));
+				const auto m128iWhat = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhat + uzOffset));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(m128iWhere, m128iWhat)) != 0xFFFF)
+					return false;
+			}
+		}
+		else if constexpr (eVecType == EVecType::VECTOR_256) {
+			for (; uzOffset + 32U <= uzSize; uzOffset += 32U) {
+				const auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + uzOffset));
+				const auto m256iWhat = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhat + uzOffset));
+				if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(m256iWhere, m256iWhat))) != 0xFFFFFFFFU)
+					return false;
+			}
+		}
+
+		return std::equal(pWhere + uzOffset, pWhere + uzSize, pWhat + uzOffset);
+	}
+
+	//Are uzSize bytes at pWhere equal to the pWhat, as text of chars or wchars (fWchar).
+	//If fMatchCase == false, data is lower-cased before comparison, pWhat must be lower-case.
+	//If fWildcard == true, bytes where pWCMask is 0xFF are wildcards, and always match.
+	//The uzSize must be at least sizeof(vec), the last vector overlaps the previous one.
+	template<EVecType eVecType, bool fWchar, bool fMatchCase, bool fWildcard>
+	[[nodiscard]] __forceinline bool MemEqualText(const std::byte* pWhere, const std::byte* pWhat, const std::byte* pWCMask,
+		std::size_t uzSize)noexcept {
+		constexpr auto uVecSize = VecTypeToSize(eVecType);
+		assert(uzSize >= uVecSize);
+		const auto lmbEqual = [=](std::size_t uzOffset) {
+			if constexpr (eVecType == EVecType::VECTOR_128) {
+				auto m128iWhere = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhere + uzOffset));
+				if constexpr (!fMatchCase) {
+					m128iWhere = ToLowerVec<fWchar>(m128iWhere);
+				}
+				auto m128iResult = _mm_cmpeq_epi8(m128iWhere, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWhat + uzOffset)));
+				if constexpr (fWildcard) {
+					m128iResult = _mm_or_si128(m128iResult, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pWCMask + uzOffset)));
+				}
+				return _mm_movemask_epi8(m128iResult) == 0xFFFF;
+			}
+			else if constexpr (eVecType == EVecType::VECTOR_256) {
+				auto m256iWhere = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhere + uzOffset));
+				if constexpr (!fMatchCase) {
+					m256iWhere = ToLowerVec<fWchar>(m256iWhere);
+				}
+				auto m256iResult = _mm256_cmpeq_epi8(m256iWhere, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWhat + uzOffset)));
+				if constexpr (fWildcard) {
+					m256iResult = _mm256_or_si256(m256iResult, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pWCMask + uzOffset)));
+				}
+				return static_cast<std::uint32_t>(_mm256_movemask_epi8(m256iResult)) == 0xFFFFFFFFU;
+			}
+			};
+
+		std::size_t uzOffset { 0 };
+		for (; uzOffset + uVecSize <= uzSize; uzOffset += uVecSize) {
+			if (!lmbEqual(uzOffset))
+				return false;
+		}
+
+		return uzOffset == uzSize || lmbEqual(uzSize - uVecSize);
 	}
 #elif defined(_M_ARM64) //^^^ _M_IX86 || _M_X64 / vvv _M_ARM64
 	//Convert __n128 mask of 16 8-bit values into 16 4-bit values.
@@ -2108,1935 +2739,792 @@ namespace HEXCTRL::INTERNAL::simd {
 
 		return 0xFFFFFFFFU;
 	}
-#endif //^^^ _M_ARM64
 
-//ModifyOperVec.
-#if defined(_M_IX86) || defined(_M_X64)
-	void OperVec128_i8(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		alignas(16) std::int8_t i8Data[16];
-		_mm_store_si128(reinterpret_cast<__m128i*>(i8Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto i8Oper = *reinterpret_cast<const std::int8_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi8(i8Oper);
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline auto FindFirstOf(const std::byte* pWhere, const NIBBLESET& stSet)noexcept -> std::uint64_t {
+		for (auto i = 0U; i < 16U; ++i) {
+			const auto u8Data = *reinterpret_cast<const std::uint8_t*>(pWhere + i);
+			if ((stSet.arrLo[u8Data & 0x0FU] & stSet.arrHi[u8Data >> 4]) != 0) {
+				return i;
+			}
+		}
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi8(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi8(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-		{
-			const auto m128iEven = _mm_mullo_epi16(m128iData, m128iOper);
-			const auto m128iOdd = _mm_mullo_epi16(_mm_srli_epi16(m128iData, 8), _mm_srli_epi16(m128iOper, 8));
-			m128iData = _mm_or_si128(_mm_slli_epi16(m128iOdd, 8), _mm_srli_epi16(_mm_slli_epi16(m128iEven, 8), 8));
+		return 0xFFFFFFFFU;
+	}
+
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline auto HammingMask(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize,
+		std::uint8_t u8MaxErrors)noexcept -> std::uint32_t {
+		std::uint32_t u32Mask { };
+		for (auto i = 0U; i < 16U; ++i) {
+			std::size_t uzErrors { 0 };
+			for (std::size_t j = 0; j < uzSize && uzErrors <= u8MaxErrors; ++j) {
+				uzErrors += pWhere[i + j] != pWhat[j] ? 1 : 0;
+			}
+			if (uzErrors <= u8MaxErrors) {
+				u32Mask |= 1U << i;
+			}
 		}
-		break;
-		case OPER_DIV:
-			assert(i8Oper > 0);
-			m128iData = _mm_setr_epi8(i8Data[0] / i8Oper, i8Data[1] / i8Oper, i8Data[2] / i8Oper, i8Data[3] / i8Oper,
-				i8Data[4] / i8Oper, i8Data[5] / i8Oper, i8Data[6] / i8Oper, i8Data[7] / i8Oper,
-				i8Data[8] / i8Oper, i8Data[9] / i8Oper, i8Data[10] / i8Oper, i8Data[11] / i8Oper,
-				i8Data[12] / i8Oper, i8Data[13] / i8Oper, i8Data[14] / i8Oper, i8Data[15] / i8Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epi8(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epi8(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_SWAP: //No need for the int8_t.
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_setr_epi8(i8Data[0] << i8Oper, i8Data[1] << i8Oper, i8Data[2] << i8Oper, i8Data[3] << i8Oper,
-				i8Data[4] << i8Oper, i8Data[5] << i8Oper, i8Data[6] << i8Oper, i8Data[7] << i8Oper,
-				i8Data[8] << i8Oper, i8Data[9] << i8Oper, i8Data[10] << i8Oper, i8Data[11] << i8Oper,
-				i8Data[12] << i8Oper, i8Data[13] << i8Oper, i8Data[14] << i8Oper, i8Data[15] << i8Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_setr_epi8(i8Data[0] >> i8Oper, i8Data[1] >> i8Oper, i8Data[2] >> i8Oper, i8Data[3] >> i8Oper,
-				i8Data[4] >> i8Oper, i8Data[5] >> i8Oper, i8Data[6] >> i8Oper, i8Data[7] >> i8Oper,
-				i8Data[8] >> i8Oper, i8Data[9] >> i8Oper, i8Data[10] >> i8Oper, i8Data[11] >> i8Oper,
-				i8Data[12] >> i8Oper, i8Data[13] >> i8Oper, i8Data[14] >> i8Oper, i8Data[15] >> i8Oper);
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi8(std::rotl(static_cast<std::uint8_t>(i8Data[0]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[1]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[2]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[3]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[4]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[5]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[6]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[7]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[8]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[9]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[10]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[11]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[12]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[13]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[14]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[15]), i8Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi8(std::rotr(static_cast<std::uint8_t>(i8Data[0]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[1]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[2]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[3]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[4]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[5]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[6]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[7]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[8]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[9]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[10]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[11]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[12]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[13]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[14]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[15]), i8Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi8(ut::BitReverse(i8Data[0]), ut::BitReverse(i8Data[1]), ut::BitReverse(i8Data[2]),
-				ut::BitReverse(i8Data[3]), ut::BitReverse(i8Data[4]), ut::BitReverse(i8Data[5]), ut::BitReverse(i8Data[6]),
-				ut::BitReverse(i8Data[7]), ut::BitReverse(i8Data[8]), ut::BitReverse(i8Data[9]), ut::BitReverse(i8Data[10]),
-				ut::BitReverse(i8Data[11]), ut::BitReverse(i8Data[12]), ut::BitReverse(i8Data[13]), ut::BitReverse(i8Data[14]),
-				ut::BitReverse(i8Data[15]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int8_t operation.");
-			break;
+
+		return u32Mask;
+	}
+
+	template<EVecType eVecType, ut::TSize1248 T, bool fEqual = true>
+	[[nodiscard]] __forceinline auto MemCmpEQMask(const std::byte* pWhere, T tWhat, std::uint32_t u32Step = 1,
+		bool fFromLast = false)noexcept -> std::uint32_t {
+		std::uint32_t u32Mask { };
+		for (auto i = fFromLast ? u32Step - 1 : 0U; i < 16U; i += u32Step) {
+			if ((*reinterpret_cast<const T*>(pWhere + i) == tWhat) == fEqual) {
+				u32Mask |= 1U << i;
+			}
 		}
 
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
+		return u32Mask;
 	}
 
-	void OperVec128_u8(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		alignas(16) std::uint8_t u8Data[16];
-		_mm_store_si128(reinterpret_cast<__m128i*>(u8Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto u8Oper = *reinterpret_cast<const std::uint8_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi8(u8Oper);
+	template<EVecType eVecType, ut::TSize1248 T, bool fBigEndian = false>
+	[[nodiscard]] __forceinline auto MemCmpRngMask(const std::byte* pWhere, T tFrom, T tTo,
+		std::uint32_t u32Step = 1, bool fFromLast = false)noexcept -> std::uint32_t {
+		std::uint32_t u32Mask { };
+		for (auto i = fFromLast ? u32Step - 1 : 0U; i < 16U; i += u32Step) {
+			auto tData = *reinterpret_cast<const T*>(pWhere + i);
+			if constexpr (fBigEndian) {
+				tData = ut::ByteSwap(tData);
+			}
+			if (tData >= tFrom && tData <= tTo) {
+				u32Mask |= 1U << i;
+			}
+		}
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi8(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi8(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_setr_epi8(u8Data[0] * u8Oper, u8Data[1] * u8Oper, u8Data[2] * u8Oper,
-				u8Data[3] * u8Oper, u8Data[4] * u8Oper, u8Data[5] * u8Oper, u8Data[6] * u8Oper,
-				u8Data[7] * u8Oper, u8Data[8] * u8Oper, u8Data[9] * u8Oper, u8Data[10] * u8Oper,
-				u8Data[11] * u8Oper, u8Data[12] * u8Oper, u8Data[13] * u8Oper, u8Data[14] * u8Oper,
-				u8Data[15] * u8Oper);
-			break;
-		case OPER_DIV:
-			assert(u8Oper > 0);
-			m128iData = _mm_setr_epi8(u8Data[0] / u8Oper, u8Data[1] / u8Oper, u8Data[2] / u8Oper,
-				u8Data[3] / u8Oper, u8Data[4] / u8Oper, u8Data[5] / u8Oper, u8Data[6] / u8Oper,
-				u8Data[7] / u8Oper, u8Data[8] / u8Oper, u8Data[9] / u8Oper, u8Data[10] / u8Oper,
-				u8Data[11] / u8Oper, u8Data[12] / u8Oper, u8Data[13] / u8Oper, u8Data[14] / u8Oper,
-				u8Data[15] / u8Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epu8(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epu8(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_SWAP:	//No need for the uint8_t.
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_setr_epi8(u8Data[0] << u8Oper, u8Data[1] << u8Oper, u8Data[2] << u8Oper, u8Data[3] << u8Oper,
-				u8Data[4] << u8Oper, u8Data[5] << u8Oper, u8Data[6] << u8Oper, u8Data[7] << u8Oper,
-				u8Data[8] << u8Oper, u8Data[9] << u8Oper, u8Data[10] << u8Oper, u8Data[11] << u8Oper,
-				u8Data[12] << u8Oper, u8Data[13] << u8Oper, u8Data[14] << u8Oper, u8Data[15] << u8Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_setr_epi8(u8Data[0] >> u8Oper, u8Data[1] >> u8Oper, u8Data[2] >> u8Oper, u8Data[3] >> u8Oper,
-				u8Data[4] >> u8Oper, u8Data[5] >> u8Oper, u8Data[6] >> u8Oper, u8Data[7] >> u8Oper,
-				u8Data[8] >> u8Oper, u8Data[9] >> u8Oper, u8Data[10] >> u8Oper, u8Data[11] >> u8Oper,
-				u8Data[12] >> u8Oper, u8Data[13] >> u8Oper, u8Data[14] >> u8Oper, u8Data[15] >> u8Oper);
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi8(std::rotl(u8Data[0], u8Oper), std::rotl(u8Data[1], u8Oper),
-				std::rotl(u8Data[2], u8Oper), std::rotl(u8Data[3], u8Oper), std::rotl(u8Data[4], u8Oper),
-				std::rotl(u8Data[5], u8Oper), std::rotl(u8Data[6], u8Oper), std::rotl(u8Data[7], u8Oper),
-				std::rotl(u8Data[8], u8Oper), std::rotl(u8Data[9], u8Oper), std::rotl(u8Data[10], u8Oper),
-				std::rotl(u8Data[11], u8Oper), std::rotl(u8Data[12], u8Oper), std::rotl(u8Data[13], u8Oper),
-				std::rotl(u8Data[14], u8Oper), std::rotl(u8Data[15], u8Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi8(std::rotr(u8Data[0], u8Oper), std::rotr(u8Data[1], u8Oper),
-				std::rotr(u8Data[2], u8Oper), std::rotr(u8Data[3], u8Oper), std::rotr(u8Data[4], u8Oper),
-				std::rotr(u8Data[5], u8Oper), std::rotr(u8Data[6], u8Oper), std::rotr(u8Data[7], u8Oper),
-				std::rotr(u8Data[8], u8Oper), std::rotr(u8Data[9], u8Oper), std::rotr(u8Data[10], u8Oper),
-				std::rotr(u8Data[11], u8Oper), std::rotr(u8Data[12], u8Oper), std::rotr(u8Data[13], u8Oper),
-				std::rotr(u8Data[14], u8Oper), std::rotr(u8Data[15], u8Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi8(ut::BitReverse(u8Data[0]), ut::BitReverse(u8Data[1]), ut::BitReverse(u8Data[2]),
-				ut::BitReverse(u8Data[3]), ut::BitReverse(u8Data[4]), ut::BitReverse(u8Data[5]), ut::BitReverse(u8Data[6]),
-				ut::BitReverse(u8Data[7]), ut::BitReverse(u8Data[8]), ut::BitReverse(u8Data[9]), ut::BitReverse(u8Data[10]),
-				ut::BitReverse(u8Data[11]), ut::BitReverse(u8Data[12]), ut::BitReverse(u8Data[13]), ut::BitReverse(u8Data[14]),
-				ut::BitReverse(u8Data[15]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint8_t operation.");
-			break;
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_i16(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::int16_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::int16_t i16Data[8];
-		_mm_store_si128(reinterpret_cast<__m128i*>(i16Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto i16Oper = *reinterpret_cast<const std::int16_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi16(i16Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi16(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi16(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_mullo_epi16(m128iData, m128iOper);
-			break;
-		case OPER_DIV:
-			assert(i16Oper > 0);
-			m128iData = _mm_setr_epi16(i16Data[0] / i16Oper, i16Data[1] / i16Oper, i16Data[2] / i16Oper,
-				i16Data[3] / i16Oper, i16Data[4] / i16Oper, i16Data[5] / i16Oper, i16Data[6] / i16Oper, i16Data[7] / i16Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epi16(m128iData, m128iOper);
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epi16(m128iData, m128iOper);
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::int16_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi16(m128iData, i16Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_srai_epi16(m128iData, i16Oper); //Arithmetic shift.
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi16(std::rotl(static_cast<std::uint16_t>(i16Data[0]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[1]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[2]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[3]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[4]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[5]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[6]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[7]), i16Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi16(std::rotr(static_cast<std::uint16_t>(i16Data[0]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[1]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[2]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[3]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[4]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[5]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[6]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[7]), i16Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi16(ut::BitReverse(i16Data[0]), ut::BitReverse(i16Data[1]), ut::BitReverse(i16Data[2]),
-				ut::BitReverse(i16Data[3]), ut::BitReverse(i16Data[4]), ut::BitReverse(i16Data[5]), ut::BitReverse(i16Data[6]),
-				ut::BitReverse(i16Data[7]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int16_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::int16_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_u16(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::uint16_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::uint16_t u16Data[8];
-		_mm_store_si128(reinterpret_cast<__m128i*>(u16Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto u16Oper = *reinterpret_cast<const std::uint16_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi16(u16Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi16(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi16(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_setr_epi16(u16Data[0] * u16Oper, u16Data[1] * u16Oper, u16Data[2] * u16Oper,
-				u16Data[3] * u16Oper, u16Data[4] * u16Oper, u16Data[5] * u16Oper, u16Data[6] * u16Oper,
-				u16Data[7] * u16Oper);
-			break;
-		case OPER_DIV:
-			assert(u16Oper > 0);
-			m128iData = _mm_setr_epi16(u16Data[0] / u16Oper, u16Data[1] / u16Oper, u16Data[2] / u16Oper,
-				u16Data[3] / u16Oper, u16Data[4] / u16Oper, u16Data[5] / u16Oper, u16Data[6] / u16Oper,
-				u16Data[7] / u16Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epu16(m128iData, m128iOper);
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epu16(m128iData, m128iOper);
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::uint16_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi16(m128iData, u16Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_srli_epi16(m128iData, u16Oper); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi16(std::rotl(u16Data[0], u16Oper), std::rotl(u16Data[1], u16Oper),
-				std::rotl(u16Data[2], u16Oper), std::rotl(u16Data[3], u16Oper), std::rotl(u16Data[4], u16Oper),
-				std::rotl(u16Data[5], u16Oper), std::rotl(u16Data[6], u16Oper), std::rotl(u16Data[7], u16Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi16(std::rotr(u16Data[0], u16Oper), std::rotr(u16Data[1], u16Oper),
-				std::rotr(u16Data[2], u16Oper), std::rotr(u16Data[3], u16Oper), std::rotr(u16Data[4], u16Oper),
-				std::rotr(u16Data[5], u16Oper), std::rotr(u16Data[6], u16Oper), std::rotr(u16Data[7], u16Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi16(ut::BitReverse(u16Data[0]), ut::BitReverse(u16Data[1]), ut::BitReverse(u16Data[2]),
-				ut::BitReverse(u16Data[3]), ut::BitReverse(u16Data[4]), ut::BitReverse(u16Data[5]), ut::BitReverse(u16Data[6]),
-				ut::BitReverse(u16Data[7]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint16_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::uint16_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_i32(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::int32_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::int32_t i32Data[4];
-		_mm_store_si128(reinterpret_cast<__m128i*>(i32Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto i32Oper = *reinterpret_cast<const std::int32_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi32(i32Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi32(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi32(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_mullo_epi32(m128iData, m128iOper);
-			break;
-		case OPER_DIV:
-			assert(i32Oper > 0);
-			m128iData = _mm_setr_epi32(i32Data[0] / i32Oper, i32Data[1] / i32Oper, i32Data[2] / i32Oper,
-				i32Data[3] / i32Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epi32(m128iData, m128iOper);
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epi32(m128iData, m128iOper);
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::int32_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi32(m128iData, i32Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_srai_epi32(m128iData, i32Oper); //Arithmetic shift.
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi32(std::rotl(static_cast<std::uint32_t>(i32Data[0]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[1]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[2]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[3]), i32Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi32(std::rotr(static_cast<std::uint32_t>(i32Data[0]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[1]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[2]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[3]), i32Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi32(ut::BitReverse(i32Data[0]), ut::BitReverse(i32Data[1]), ut::BitReverse(i32Data[2]),
-				ut::BitReverse(i32Data[3]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int32_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::int32_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_u32(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::uint32_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::uint32_t u32Data[4];
-		_mm_store_si128(reinterpret_cast<__m128i*>(u32Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto u32Oper = *reinterpret_cast<const std::uint32_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi32(u32Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi32(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi32(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_setr_epi32(u32Data[0] * u32Oper, u32Data[1] * u32Oper, u32Data[2] * u32Oper,
-				u32Data[3] * u32Oper);
-			break;
-		case OPER_DIV:
-			assert(u32Oper > 0);
-			m128iData = _mm_setr_epi32(u32Data[0] / u32Oper, u32Data[1] / u32Oper, u32Data[2] / u32Oper,
-				u32Data[3] / u32Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_max_epu32(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_MAX:
-			m128iData = _mm_min_epu32(m128iData, m128iOper); //SSE4.1
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::uint32_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi32(m128iData, u32Oper);
-			break;
-		case OPER_SHR:
-			m128iData = _mm_srli_epi32(m128iData, u32Oper); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi32(std::rotl(u32Data[0], u32Oper), std::rotl(u32Data[1], u32Oper),
-				std::rotl(u32Data[2], u32Oper), std::rotl(u32Data[3], u32Oper));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi32(std::rotr(u32Data[0], u32Oper), std::rotr(u32Data[1], u32Oper),
-				std::rotr(u32Data[2], u32Oper), std::rotr(u32Data[3], u32Oper));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi32(ut::BitReverse(u32Data[0]), ut::BitReverse(u32Data[1]), ut::BitReverse(u32Data[2]),
-				ut::BitReverse(u32Data[3]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint32_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::uint32_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_i64(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::int64_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::int64_t i64Data[2];
-		_mm_store_si128(reinterpret_cast<__m128i*>(i64Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto i64Oper = *reinterpret_cast<const std::int64_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi64x(i64Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi64(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi64(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_setr_epi64x(i64Data[0] * i64Oper, i64Data[1] * i64Oper);
-			break;
-		case OPER_DIV:
-			assert(i64Oper > 0);
-			m128iData = _mm_setr_epi64x(i64Data[0] / i64Oper, i64Data[1] / i64Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_setr_epi64x((std::max)(i64Data[0], i64Oper), (std::max)(i64Data[1], i64Oper));
-			break;
-		case OPER_MAX:
-			m128iData = _mm_setr_epi64x((std::min)(i64Data[0], i64Oper), (std::min)(i64Data[1], i64Oper));
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::int64_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi64(m128iData, static_cast<int>(i64Oper));
-			break;
-		case OPER_SHR:
-			m128iData = _mm_setr_epi64x(i64Data[0] >> i64Oper, i64Data[1] >> i64Oper);
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi64x(std::rotl(static_cast<std::uint64_t>(i64Data[0]), static_cast<const int>(i64Oper)),
-				std::rotl(static_cast<std::uint64_t>(i64Data[1]), static_cast<const int>(i64Oper)));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi64x(std::rotr(static_cast<std::uint64_t>(i64Data[0]), static_cast<const int>(i64Oper)),
-				std::rotr(static_cast<std::uint64_t>(i64Data[1]), static_cast<const int>(i64Oper)));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi64x(ut::BitReverse(i64Data[0]), ut::BitReverse(i64Data[1]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int64_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::int64_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_u64(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128iData = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
-		if (hms.fBigEndian) {
-			m128iData = ByteSwapVec<std::uint64_t>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)));
-		}
-
-		alignas(16) std::uint64_t u64Data[2];
-		_mm_store_si128(reinterpret_cast<__m128i*>(u64Data), m128iData);
-		assert(!hms.spnData.empty());
-		const auto u64Oper = *reinterpret_cast<const std::uint64_t*>(hms.spnData.data());
-		const auto m128iOper = _mm_set1_epi64x(u64Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128iData = _mm_add_epi64(m128iData, m128iOper);
-			break;
-		case OPER_SUB:
-			m128iData = _mm_sub_epi64(m128iData, m128iOper);
-			break;
-		case OPER_MUL:
-			m128iData = _mm_setr_epi64x(u64Data[0] * u64Oper, u64Data[1] * u64Oper);
-			break;
-		case OPER_DIV:
-			assert(u64Oper > 0);
-			m128iData = _mm_setr_epi64x(u64Data[0] / u64Oper, u64Data[1] / u64Oper);
-			break;
-		case OPER_MIN:
-			m128iData = _mm_setr_epi64x((std::max)(u64Data[0], u64Oper), (std::max)(u64Data[1], u64Oper));
-			break;
-		case OPER_MAX:
-			m128iData = _mm_setr_epi64x((std::min)(u64Data[0], u64Oper), (std::min)(u64Data[1], u64Oper));
-			break;
-		case OPER_SWAP:
-			m128iData = ByteSwapVec<std::uint64_t>(m128iData);
-			break;
-		case OPER_OR:
-			m128iData = _mm_or_si128(m128iData, m128iOper);
-			break;
-		case OPER_XOR:
-			m128iData = _mm_xor_si128(m128iData, m128iOper);
-			break;
-		case OPER_AND:
-			m128iData = _mm_and_si128(m128iData, m128iOper);
-			break;
-		case OPER_NOT:
-			//_mm_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m128iData = _mm_xor_si128(m128iData, _mm_cmpeq_epi64(m128iData, m128iData)); //SSE4.1
-			break;
-		case OPER_SHL:
-			m128iData = _mm_slli_epi64(m128iData, static_cast<int>(u64Oper));
-			break;
-		case OPER_SHR:
-			m128iData = _mm_srli_epi64(m128iData, static_cast<int>(u64Oper)); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m128iData = _mm_setr_epi64x(std::rotl(u64Data[0], static_cast<const int>(u64Oper)),
-				std::rotl(u64Data[1], static_cast<const int>(u64Oper)));
-			break;
-		case OPER_ROTR:
-			m128iData = _mm_setr_epi64x(std::rotr(u64Data[0], static_cast<const int>(u64Oper)),
-				std::rotr(u64Data[1], static_cast<const int>(u64Oper)));
-			break;
-		case OPER_BITREV:
-			m128iData = _mm_setr_epi64x(ut::BitReverse(u64Data[0]), ut::BitReverse(u64Data[1]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint64_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128iData = ByteSwapVec<std::uint64_t>(m128iData);
-		}
-
-		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData), m128iData);
-	}
-
-	void OperVec128_f(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128Data = _mm_loadu_ps(reinterpret_cast<const float*>(pData));
-		if (hms.fBigEndian) {
-			m128Data = ByteSwapVec<float>(_mm_loadu_ps(reinterpret_cast<const float*>(pData)));
-		}
-
-		assert(std::isfinite(*reinterpret_cast<const float*>(hms.spnData.data())));
-		const auto m128Oper = _mm_set_ps1(*reinterpret_cast<const float*>(hms.spnData.data()));
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128Data = _mm_add_ps(m128Data, m128Oper);
-			break;
-		case OPER_SUB:
-			m128Data = _mm_sub_ps(m128Data, m128Oper);
-			break;
-		case OPER_MUL:
-			m128Data = _mm_mul_ps(m128Data, m128Oper);
-			break;
-		case OPER_DIV:
-			assert(*reinterpret_cast<const float*>(hms.spnData.data()) > 0.F);
-			m128Data = _mm_div_ps(m128Data, m128Oper);
-			break;
-		case OPER_MIN:
-			m128Data = _mm_max_ps(m128Data, m128Oper);
-			break;
-		case OPER_MAX:
-			m128Data = _mm_min_ps(m128Data, m128Oper);
-			break;
-		case OPER_SWAP:
-			m128Data = ByteSwapVec<float>(m128Data);
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported float operation.");
-			return;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128Data = ByteSwapVec<float>(m128Data);
-		}
-
-		_mm_storeu_ps(reinterpret_cast<float*>(pData), m128Data);
-	}
-
-	void OperVec128_d(std::byte* pData, const HEXMODIFY& hms) {
-		auto m128dData = _mm_loadu_pd(reinterpret_cast<const double*>(pData));
-		if (hms.fBigEndian) {
-			m128dData = ByteSwapVec<double>(_mm_loadu_pd(reinterpret_cast<const double*>(pData)));
-		}
-
-		assert(std::isfinite(*reinterpret_cast<const double*>(hms.spnData.data())));
-		const auto m128dOper = _mm_set1_pd(*reinterpret_cast<const double*>(hms.spnData.data()));
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m128dData = _mm_add_pd(m128dData, m128dOper);
-			break;
-		case OPER_SUB:
-			m128dData = _mm_sub_pd(m128dData, m128dOper);
-			break;
-		case OPER_MUL:
-			m128dData = _mm_mul_pd(m128dData, m128dOper);
-			break;
-		case OPER_DIV:
-			assert(*reinterpret_cast<const double*>(hms.spnData.data()) > 0.);
-			m128dData = _mm_div_pd(m128dData, m128dOper);
-			break;
-		case OPER_MIN:
-			m128dData = _mm_max_pd(m128dData, m128dOper);
-			break;
-		case OPER_MAX:
-			m128dData = _mm_min_pd(m128dData, m128dOper);
-			break;
-		case OPER_SWAP:
-			m128dData = ByteSwapVec<double>(m128dData);
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported double operation.");
-			return;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m128dData = ByteSwapVec<double>(m128dData);
-		}
-
-		_mm_storeu_pd(reinterpret_cast<double*>(pData), m128dData);
-	}
-
-	void OperVec256_i8(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		alignas(32) std::int8_t i8Data[32];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(i8Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto i8Oper = *reinterpret_cast<const std::int8_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi8(i8Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi8(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi8(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-		{
-			const auto m256iEven = _mm256_mullo_epi16(m256iData, m256iOper);
-			const auto m256iOdd = _mm256_mullo_epi16(_mm256_srli_epi16(m256iData, 8), _mm256_srli_epi16(m256iOper, 8));
-			m256iData = _mm256_or_si256(_mm256_slli_epi16(m256iOdd, 8), _mm256_srli_epi16(_mm256_slli_epi16(m256iEven, 8), 8));
-		}
-		break;
-		case OPER_DIV:
-			assert(i8Oper > 0);
-			m256iData = _mm256_setr_epi8(i8Data[0] / i8Oper, i8Data[1] / i8Oper, i8Data[2] / i8Oper, i8Data[3] / i8Oper,
-				i8Data[4] / i8Oper, i8Data[5] / i8Oper, i8Data[6] / i8Oper, i8Data[7] / i8Oper, i8Data[8] / i8Oper,
-				i8Data[9] / i8Oper, i8Data[10] / i8Oper, i8Data[11] / i8Oper, i8Data[12] / i8Oper, i8Data[13] / i8Oper,
-				i8Data[14] / i8Oper, i8Data[15] / i8Oper, i8Data[16] / i8Oper, i8Data[17] / i8Oper, i8Data[18] / i8Oper,
-				i8Data[19] / i8Oper, i8Data[20] / i8Oper, i8Data[21] / i8Oper, i8Data[22] / i8Oper, i8Data[23] / i8Oper,
-				i8Data[24] / i8Oper, i8Data[25] / i8Oper, i8Data[26] / i8Oper, i8Data[27] / i8Oper, i8Data[28] / i8Oper,
-				i8Data[29] / i8Oper, i8Data[30] / i8Oper, i8Data[31] / i8Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epi8(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epi8(m256iData, m256iOper);
-			break;
-		case OPER_SWAP: //No need for the int8_t.
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_setr_epi8(i8Data[0] << i8Oper, i8Data[1] << i8Oper, i8Data[2] << i8Oper,
-				i8Data[3] << i8Oper, i8Data[4] << i8Oper, i8Data[5] << i8Oper, i8Data[6] << i8Oper,
-				i8Data[7] << i8Oper, i8Data[8] << i8Oper, i8Data[9] << i8Oper, i8Data[10] << i8Oper,
-				i8Data[11] << i8Oper, i8Data[12] << i8Oper, i8Data[13] << i8Oper, i8Data[14] << i8Oper,
-				i8Data[15] << i8Oper, i8Data[16] << i8Oper, i8Data[17] << i8Oper, i8Data[18] << i8Oper,
-				i8Data[19] << i8Oper, i8Data[20] << i8Oper, i8Data[21] << i8Oper, i8Data[22] << i8Oper,
-				i8Data[23] << i8Oper, i8Data[24] << i8Oper, i8Data[25] << i8Oper, i8Data[26] << i8Oper,
-				i8Data[27] << i8Oper, i8Data[28] << i8Oper, i8Data[29] << i8Oper, i8Data[30] << i8Oper,
-				i8Data[31] << i8Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_setr_epi8(i8Data[0] >> i8Oper, i8Data[1] >> i8Oper, i8Data[2] >> i8Oper,
-				i8Data[3] >> i8Oper, i8Data[4] >> i8Oper, i8Data[5] >> i8Oper, i8Data[6] >> i8Oper,
-				i8Data[7] >> i8Oper, i8Data[8] >> i8Oper, i8Data[9] >> i8Oper, i8Data[10] >> i8Oper,
-				i8Data[11] >> i8Oper, i8Data[12] >> i8Oper, i8Data[13] >> i8Oper, i8Data[14] >> i8Oper,
-				i8Data[15] >> i8Oper, i8Data[16] >> i8Oper, i8Data[17] >> i8Oper, i8Data[18] >> i8Oper,
-				i8Data[19] >> i8Oper, i8Data[20] >> i8Oper, i8Data[21] >> i8Oper, i8Data[22] >> i8Oper,
-				i8Data[23] >> i8Oper, i8Data[24] >> i8Oper, i8Data[25] >> i8Oper, i8Data[26] >> i8Oper,
-				i8Data[27] >> i8Oper, i8Data[28] >> i8Oper, i8Data[29] >> i8Oper, i8Data[30] >> i8Oper,
-				i8Data[31] >> i8Oper);
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi8(std::rotl(static_cast<std::uint8_t>(i8Data[0]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[1]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[2]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[3]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[4]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[5]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[6]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[7]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[8]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[9]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[10]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[11]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[12]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[13]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[14]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[15]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[16]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[17]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[18]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[19]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[20]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[21]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[22]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[23]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[24]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[25]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[26]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[27]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[28]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[29]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[30]), i8Oper),
-				std::rotl(static_cast<std::uint8_t>(i8Data[31]), i8Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi8(std::rotr(static_cast<std::uint8_t>(i8Data[0]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[1]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[2]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[3]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[4]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[5]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[6]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[7]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[8]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[9]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[10]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[11]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[12]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[13]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[14]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[15]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[16]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[17]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[18]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[19]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[20]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[21]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[22]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[23]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[24]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[25]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[26]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[27]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[28]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[29]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[30]), i8Oper),
-				std::rotr(static_cast<std::uint8_t>(i8Data[31]), i8Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi8(ut::BitReverse(i8Data[0]), ut::BitReverse(i8Data[1]), ut::BitReverse(i8Data[2]),
-				ut::BitReverse(i8Data[3]), ut::BitReverse(i8Data[4]), ut::BitReverse(i8Data[5]), ut::BitReverse(i8Data[6]),
-				ut::BitReverse(i8Data[7]), ut::BitReverse(i8Data[8]), ut::BitReverse(i8Data[9]), ut::BitReverse(i8Data[10]),
-				ut::BitReverse(i8Data[11]), ut::BitReverse(i8Data[12]), ut::BitReverse(i8Data[13]), ut::BitReverse(i8Data[14]),
-				ut::BitReverse(i8Data[15]), ut::BitReverse(i8Data[16]), ut::BitReverse(i8Data[17]), ut::BitReverse(i8Data[18]),
-				ut::BitReverse(i8Data[19]), ut::BitReverse(i8Data[20]), ut::BitReverse(i8Data[21]), ut::BitReverse(i8Data[22]),
-				ut::BitReverse(i8Data[23]), ut::BitReverse(i8Data[24]), ut::BitReverse(i8Data[25]), ut::BitReverse(i8Data[26]),
-				ut::BitReverse(i8Data[27]), ut::BitReverse(i8Data[28]), ut::BitReverse(i8Data[29]), ut::BitReverse(i8Data[30]),
-				ut::BitReverse(i8Data[31]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int8_t operation.");
-			break;
-		}
-
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
-	}
-
-	void OperVec256_u8(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		alignas(32) std::uint8_t u8Data[32];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(u8Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto u8Oper = *reinterpret_cast<const std::uint8_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi8(u8Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi8(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi8(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_setr_epi8(u8Data[0] * u8Oper, u8Data[1] * u8Oper, u8Data[2] * u8Oper,
-				u8Data[3] * u8Oper, u8Data[4] * u8Oper, u8Data[5] * u8Oper, u8Data[6] * u8Oper,
-				u8Data[7] * u8Oper, u8Data[8] * u8Oper, u8Data[9] * u8Oper, u8Data[10] * u8Oper,
-				u8Data[11] * u8Oper, u8Data[12] * u8Oper, u8Data[13] * u8Oper, u8Data[14] * u8Oper,
-				u8Data[15] * u8Oper, u8Data[16] * u8Oper, u8Data[17] * u8Oper, u8Data[18] * u8Oper,
-				u8Data[19] * u8Oper, u8Data[20] * u8Oper, u8Data[21] * u8Oper, u8Data[22] * u8Oper,
-				u8Data[23] * u8Oper, u8Data[24] * u8Oper, u8Data[25] * u8Oper, u8Data[26] * u8Oper,
-				u8Data[27] * u8Oper, u8Data[28] * u8Oper, u8Data[29] * u8Oper, u8Data[30] * u8Oper,
-				u8Data[31] * u8Oper);
-			break;
-		case OPER_DIV:
-			assert(u8Oper > 0);
-			m256iData = _mm256_setr_epi8(u8Data[0] / u8Oper, u8Data[1] / u8Oper, u8Data[2] / u8Oper,
-				u8Data[3] / u8Oper, u8Data[4] / u8Oper, u8Data[5] / u8Oper, u8Data[6] / u8Oper,
-				u8Data[7] / u8Oper, u8Data[8] / u8Oper, u8Data[9] / u8Oper, u8Data[10] / u8Oper,
-				u8Data[11] / u8Oper, u8Data[12] / u8Oper, u8Data[13] / u8Oper, u8Data[14] / u8Oper,
-				u8Data[15] / u8Oper, u8Data[16] / u8Oper, u8Data[17] / u8Oper, u8Data[18] / u8Oper,
-				u8Data[19] / u8Oper, u8Data[20] / u8Oper, u8Data[21] / u8Oper, u8Data[22] / u8Oper,
-				u8Data[23] / u8Oper, u8Data[24] / u8Oper, u8Data[25] / u8Oper, u8Data[26] / u8Oper,
-				u8Data[27] / u8Oper, u8Data[28] / u8Oper, u8Data[29] / u8Oper, u8Data[30] / u8Oper,
-				u8Data[31] / u8Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epu8(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epu8(m256iData, m256iOper);
-			break;
-		case OPER_SWAP:	//No need for the uint8_t.
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_setr_epi8(u8Data[0] << u8Oper, u8Data[1] << u8Oper, u8Data[2] << u8Oper,
-				u8Data[3] << u8Oper, u8Data[4] << u8Oper, u8Data[5] << u8Oper, u8Data[6] << u8Oper,
-				u8Data[7] << u8Oper, u8Data[8] << u8Oper, u8Data[9] << u8Oper, u8Data[10] << u8Oper,
-				u8Data[11] << u8Oper, u8Data[12] << u8Oper, u8Data[13] << u8Oper, u8Data[14] << u8Oper,
-				u8Data[15] << u8Oper, u8Data[16] << u8Oper, u8Data[17] << u8Oper, u8Data[18] << u8Oper,
-				u8Data[19] << u8Oper, u8Data[20] << u8Oper, u8Data[21] << u8Oper, u8Data[22] << u8Oper,
-				u8Data[23] << u8Oper, u8Data[24] << u8Oper, u8Data[25] << u8Oper, u8Data[26] << u8Oper,
-				u8Data[27] << u8Oper, u8Data[28] << u8Oper, u8Data[29] << u8Oper, u8Data[30] << u8Oper,
-				u8Data[31] << u8Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_setr_epi8(u8Data[0] >> u8Oper, u8Data[1] >> u8Oper, u8Data[2] >> u8Oper,
-				u8Data[3] >> u8Oper, u8Data[4] >> u8Oper, u8Data[5] >> u8Oper, u8Data[6] >> u8Oper,
-				u8Data[7] >> u8Oper, u8Data[8] >> u8Oper, u8Data[9] >> u8Oper, u8Data[10] >> u8Oper,
-				u8Data[11] >> u8Oper, u8Data[12] >> u8Oper, u8Data[13] >> u8Oper, u8Data[14] >> u8Oper,
-				u8Data[15] >> u8Oper, u8Data[16] >> u8Oper, u8Data[17] >> u8Oper, u8Data[18] >> u8Oper,
-				u8Data[19] >> u8Oper, u8Data[20] >> u8Oper, u8Data[21] >> u8Oper, u8Data[22] >> u8Oper,
-				u8Data[23] >> u8Oper, u8Data[24] >> u8Oper, u8Data[25] >> u8Oper, u8Data[26] >> u8Oper,
-				u8Data[27] >> u8Oper, u8Data[28] >> u8Oper, u8Data[29] >> u8Oper, u8Data[30] >> u8Oper,
-				u8Data[31] >> u8Oper);
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi8(std::rotl(u8Data[0], u8Oper), std::rotl(u8Data[1], u8Oper),
-				std::rotl(u8Data[2], u8Oper), std::rotl(u8Data[3], u8Oper), std::rotl(u8Data[4], u8Oper),
-				std::rotl(u8Data[5], u8Oper), std::rotl(u8Data[6], u8Oper), std::rotl(u8Data[7], u8Oper),
-				std::rotl(u8Data[8], u8Oper), std::rotl(u8Data[9], u8Oper), std::rotl(u8Data[10], u8Oper),
-				std::rotl(u8Data[11], u8Oper), std::rotl(u8Data[12], u8Oper), std::rotl(u8Data[13], u8Oper),
-				std::rotl(u8Data[14], u8Oper), std::rotl(u8Data[15], u8Oper), std::rotl(u8Data[16], u8Oper),
-				std::rotl(u8Data[17], u8Oper), std::rotl(u8Data[18], u8Oper), std::rotl(u8Data[19], u8Oper),
-				std::rotl(u8Data[20], u8Oper), std::rotl(u8Data[21], u8Oper), std::rotl(u8Data[22], u8Oper),
-				std::rotl(u8Data[23], u8Oper), std::rotl(u8Data[24], u8Oper), std::rotl(u8Data[25], u8Oper),
-				std::rotl(u8Data[26], u8Oper), std::rotl(u8Data[27], u8Oper), std::rotl(u8Data[28], u8Oper),
-				std::rotl(u8Data[29], u8Oper), std::rotl(u8Data[30], u8Oper), std::rotl(u8Data[31], u8Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi8(std::rotr(u8Data[0], u8Oper), std::rotr(u8Data[1], u8Oper),
-				std::rotr(u8Data[2], u8Oper), std::rotr(u8Data[3], u8Oper), std::rotr(u8Data[4], u8Oper),
-				std::rotr(u8Data[5], u8Oper), std::rotr(u8Data[6], u8Oper), std::rotr(u8Data[7], u8Oper),
-				std::rotr(u8Data[8], u8Oper), std::rotr(u8Data[9], u8Oper), std::rotr(u8Data[10], u8Oper),
-				std::rotr(u8Data[11], u8Oper), std::rotr(u8Data[12], u8Oper), std::rotr(u8Data[13], u8Oper),
-				std::rotr(u8Data[14], u8Oper), std::rotr(u8Data[15], u8Oper), std::rotr(u8Data[16], u8Oper),
-				std::rotr(u8Data[17], u8Oper), std::rotr(u8Data[18], u8Oper), std::rotr(u8Data[19], u8Oper),
-				std::rotr(u8Data[20], u8Oper), std::rotr(u8Data[21], u8Oper), std::rotr(u8Data[22], u8Oper),
-				std::rotr(u8Data[23], u8Oper), std::rotr(u8Data[24], u8Oper), std::rotr(u8Data[25], u8Oper),
-				std::rotr(u8Data[26], u8Oper), std::rotr(u8Data[27], u8Oper), std::rotr(u8Data[28], u8Oper),
-				std::rotr(u8Data[29], u8Oper), std::rotr(u8Data[30], u8Oper), std::rotr(u8Data[31], u8Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi8(ut::BitReverse(u8Data[0]), ut::BitReverse(u8Data[1]), ut::BitReverse(u8Data[2]),
-				ut::BitReverse(u8Data[3]), ut::BitReverse(u8Data[4]), ut::BitReverse(u8Data[5]), ut::BitReverse(u8Data[6]),
-				ut::BitReverse(u8Data[7]), ut::BitReverse(u8Data[8]), ut::BitReverse(u8Data[9]), ut::BitReverse(u8Data[10]),
-				ut::BitReverse(u8Data[11]), ut::BitReverse(u8Data[12]), ut::BitReverse(u8Data[13]), ut::BitReverse(u8Data[14]),
-				ut::BitReverse(u8Data[15]), ut::BitReverse(u8Data[16]), ut::BitReverse(u8Data[17]), ut::BitReverse(u8Data[18]),
-				ut::BitReverse(u8Data[19]), ut::BitReverse(u8Data[20]), ut::BitReverse(u8Data[21]), ut::BitReverse(u8Data[22]),
-				ut::BitReverse(u8Data[23]), ut::BitReverse(u8Data[24]), ut::BitReverse(u8Data[25]), ut::BitReverse(u8Data[26]),
-				ut::BitReverse(u8Data[27]), ut::BitReverse(u8Data[28]), ut::BitReverse(u8Data[29]), ut::BitReverse(u8Data[30]),
-				ut::BitReverse(u8Data[31]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint8_t operation.");
-			break;
-		}
-
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
+		return u32Mask;
 	}
 
-	void OperVec256_i16(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::int16_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
-		}
-
-		alignas(32) std::int16_t i16Data[16];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(i16Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto i16Oper = *reinterpret_cast<const std::int16_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi16(i16Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi16(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi16(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_mullo_epi16(m256iData, m256iOper);
-			break;
-		case OPER_DIV:
-			assert(i16Oper > 0);
-			m256iData = _mm256_setr_epi16(i16Data[0] / i16Oper, i16Data[1] / i16Oper, i16Data[2] / i16Oper,
-				i16Data[3] / i16Oper, i16Data[4] / i16Oper, i16Data[5] / i16Oper, i16Data[6] / i16Oper,
-				i16Data[7] / i16Oper, i16Data[8] / i16Oper, i16Data[9] / i16Oper, i16Data[10] / i16Oper,
-				i16Data[11] / i16Oper, i16Data[12] / i16Oper, i16Data[13] / i16Oper, i16Data[14] / i16Oper,
-				i16Data[15] / i16Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epi16(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epi16(m256iData, m256iOper);
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::int16_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi16(m256iData, i16Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_srai_epi16(m256iData, i16Oper); //Arithmetic shift.
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi16(std::rotl(static_cast<std::uint16_t>(i16Data[0]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[1]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[2]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[3]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[4]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[5]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[6]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[7]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[8]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[9]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[10]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[11]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[12]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[13]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[14]), i16Oper),
-				std::rotl(static_cast<std::uint16_t>(i16Data[15]), i16Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi16(std::rotr(static_cast<std::uint16_t>(i16Data[0]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[1]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[2]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[3]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[4]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[5]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[6]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[7]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[8]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[9]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[10]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[11]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[12]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[13]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[14]), i16Oper),
-				std::rotr(static_cast<std::uint16_t>(i16Data[15]), i16Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi16(ut::BitReverse(i16Data[0]), ut::BitReverse(i16Data[1]), ut::BitReverse(i16Data[2]),
-				ut::BitReverse(i16Data[3]), ut::BitReverse(i16Data[4]), ut::BitReverse(i16Data[5]), ut::BitReverse(i16Data[6]),
-				ut::BitReverse(i16Data[7]), ut::BitReverse(i16Data[8]), ut::BitReverse(i16Data[9]), ut::BitReverse(i16Data[10]),
-				ut::BitReverse(i16Data[11]), ut::BitReverse(i16Data[12]), ut::BitReverse(i16Data[13]), ut::BitReverse(i16Data[14]),
-				ut::BitReverse(i16Data[15]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int16_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::int16_t>(m256iData);
-		}
-
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
-	}
-
-	void OperVec256_u16(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::uint16_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
-		}
-
-		alignas(32) std::uint16_t u16Data[16];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(u16Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto u16Oper = *reinterpret_cast<const std::uint16_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi16(u16Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi16(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi16(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_setr_epi16(u16Data[0] * u16Oper, u16Data[1] * u16Oper, u16Data[2] * u16Oper,
-				u16Data[3] * u16Oper, u16Data[4] * u16Oper, u16Data[5] * u16Oper, u16Data[6] * u16Oper,
-				u16Data[7] * u16Oper, u16Data[8] * u16Oper, u16Data[9] * u16Oper, u16Data[10] * u16Oper,
-				u16Data[11] * u16Oper, u16Data[12] * u16Oper, u16Data[13] * u16Oper, u16Data[14] * u16Oper,
-				u16Data[15] * u16Oper);
-			break;
-		case OPER_DIV:
-			assert(u16Oper > 0);
-			m256iData = _mm256_setr_epi16(u16Data[0] / u16Oper, u16Data[1] / u16Oper, u16Data[2] / u16Oper,
-				u16Data[3] / u16Oper, u16Data[4] / u16Oper, u16Data[5] / u16Oper, u16Data[6] / u16Oper,
-				u16Data[7] / u16Oper, u16Data[8] / u16Oper, u16Data[9] / u16Oper, u16Data[10] / u16Oper,
-				u16Data[11] / u16Oper, u16Data[12] / u16Oper, u16Data[13] / u16Oper, u16Data[14] / u16Oper,
-				u16Data[15] / u16Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epu16(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epu16(m256iData, m256iOper);
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::uint16_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi16(m256iData, u16Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_srli_epi16(m256iData, u16Oper); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi16(std::rotl(u16Data[0], u16Oper), std::rotl(u16Data[1], u16Oper),
-				std::rotl(u16Data[2], u16Oper), std::rotl(u16Data[3], u16Oper), std::rotl(u16Data[4], u16Oper),
-				std::rotl(u16Data[5], u16Oper), std::rotl(u16Data[6], u16Oper), std::rotl(u16Data[7], u16Oper),
-				std::rotl(u16Data[8], u16Oper), std::rotl(u16Data[9], u16Oper), std::rotl(u16Data[10], u16Oper),
-				std::rotl(u16Data[11], u16Oper), std::rotl(u16Data[12], u16Oper), std::rotl(u16Data[13], u16Oper),
-				std::rotl(u16Data[14], u16Oper), std::rotl(u16Data[15], u16Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi16(std::rotr(u16Data[0], u16Oper), std::rotr(u16Data[1], u16Oper),
-				std::rotr(u16Data[2], u16Oper), std::rotr(u16Data[3], u16Oper), std::rotr(u16Data[4], u16Oper),
-				std::rotr(u16Data[5], u16Oper), std::rotr(u16Data[6], u16Oper), std::rotr(u16Data[7], u16Oper),
-				std::rotr(u16Data[8], u16Oper), std::rotr(u16Data[9], u16Oper), std::rotr(u16Data[10], u16Oper),
-				std::rotr(u16Data[11], u16Oper), std::rotr(u16Data[12], u16Oper), std::rotr(u16Data[13], u16Oper),
-				std::rotr(u16Data[14], u16Oper), std::rotr(u16Data[15], u16Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi16(ut::BitReverse(u16Data[0]), ut::BitReverse(u16Data[1]), ut::BitReverse(u16Data[2]),
-				ut::BitReverse(u16Data[3]), ut::BitReverse(u16Data[4]), ut::BitReverse(u16Data[5]), ut::BitReverse(u16Data[6]),
-				ut::BitReverse(u16Data[7]), ut::BitReverse(u16Data[8]), ut::BitReverse(u16Data[9]), ut::BitReverse(u16Data[10]),
-				ut::BitReverse(u16Data[11]), ut::BitReverse(u16Data[12]), ut::BitReverse(u16Data[13]), ut::BitReverse(u16Data[14]),
-				ut::BitReverse(u16Data[15]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint16_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::uint16_t>(m256iData);
+	template<EVecType eVecType, bool fMatchCase = true>
+	[[nodiscard]] __forceinline auto MemCmpEQFirstLast(const std::byte* pWhere, std::uint8_t u8First, std::uint8_t u8Last,
+		std::size_t uzLastOffset)noexcept -> std::uint32_t {
+		const auto lmbToLower = [](std::uint8_t u8Data) {
+			return (!fMatchCase && u8Data >= 'A' && u8Data <= 'Z') ? static_cast<std::uint8_t>(u8Data + 32) : u8Data; };
+		std::uint32_t u32Mask { };
+		for (auto i = 0U; i < 16U; ++i) {
+			if (lmbToLower(*reinterpret_cast<const std::uint8_t*>(pWhere + i)) == u8First
+				&& lmbToLower(*reinterpret_cast<const std::uint8_t*>(pWhere + i + uzLastOffset)) == u8Last) {
+				u32Mask |= 1U << i;
+			}
 		}
 
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
+		return u32Mask;
 	}
 
-	void OperVec256_i32(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::int32_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
-		}
-
-		alignas(32) std::int32_t i32Data[8];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(i32Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto i32Oper = *reinterpret_cast<const std::int32_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi32(i32Oper);
+	template<EVecType eVecType>
+	[[nodiscard]] __forceinline bool MemEqual(const std::byte* pWhere, const std::byte* pWhat, std::size_t uzSize)noexcept {
+		return std::equal(pWhere, pWhere + uzSize, pWhat);
+	}
+
+	template<EVecType eVecType, bool fWchar, bool fMatchCase, bool fWildcard>
+	[[nodiscard]] __forceinline bool MemEqualText(const std::byte* pWhere, const std::byte* pWhat, const std::byte* pWCMask,
+		std::size_t uzSize)noexcept {
+		using TChar = std::conditional_t<fWchar, std::uint16_t, std::uint8_t>;
+		for (std::size_t i { 0 }; i < uzSize; i += sizeof(TChar)) {
+			if constexpr (fWildcard) {
+				if (pWCMask[i] != std::byte { 0 })
+					continue;
+			}
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi32(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi32(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_mullo_epi32(m256iData, m256iOper);
-			break;
-		case OPER_DIV:
-			assert(i32Oper > 0);
-			m256iData = _mm256_setr_epi32(i32Data[0] / i32Oper, i32Data[1] / i32Oper, i32Data[2] / i32Oper,
-				i32Data[3] / i32Oper, i32Data[4] / i32Oper, i32Data[5] / i32Oper, i32Data[6] / i32Oper,
-				i32Data[7] / i32Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epi32(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epi32(m256iData, m256iOper);
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::int32_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi32(m256iData, i32Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_srai_epi32(m256iData, i32Oper); //Arithmetic shift.
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi32(std::rotl(static_cast<std::uint32_t>(i32Data[0]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[1]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[2]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[3]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[4]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[5]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[6]), i32Oper),
-				std::rotl(static_cast<std::uint32_t>(i32Data[7]), i32Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi32(std::rotr(static_cast<std::uint32_t>(i32Data[0]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[1]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[2]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[3]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[4]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[5]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[6]), i32Oper),
-				std::rotr(static_cast<std::uint32_t>(i32Data[7]), i32Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi32(ut::BitReverse(i32Data[0]), ut::BitReverse(i32Data[1]), ut::BitReverse(i32Data[2]),
-				ut::BitReverse(i32Data[3]), ut::BitReverse(i32Data[4]), ut::BitReverse(i32Data[5]), ut::BitReverse(i32Data[6]),
-				ut::BitReverse(i32Data[7]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int32_t operation.");
-			break;
-		}
+			auto tData = *reinterpret_cast<const TChar*>(pWhere + i);
+			if constexpr (!fMatchCase) {
+				if (tData >= 'A' && tData <= 'Z') {
+					tData += 32;
+				}
+			}
 
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::int32_t>(m256iData);
+			if (tData != *reinterpret_cast<const TChar*>(pWhat + i))
+				return false;
 		}
 
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
+		return true;
 	}
+#endif //^^^ _M_ARM64
 
-	void OperVec256_u32(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::uint32_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
-		}
-
-		alignas(32) std::uint32_t u32Data[8];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(u32Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto u32Oper = *reinterpret_cast<const std::uint32_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi32(u32Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi32(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi32(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_setr_epi32(u32Data[0] * u32Oper, u32Data[1] * u32Oper, u32Data[2] * u32Oper,
-				u32Data[3] * u32Oper, u32Data[4] * u32Oper, u32Data[5] * u32Oper, u32Data[6] * u32Oper,
-				u32Data[7] * u32Oper);
-			break;
-		case OPER_DIV:
-			assert(u32Oper > 0);
-			m256iData = _mm256_setr_epi32(u32Data[0] / u32Oper, u32Data[1] / u32Oper, u32Data[2] / u32Oper,
-				u32Data[3] / u32Oper, u32Data[4] / u32Oper, u32Data[5] / u32Oper, u32Data[6] / u32Oper,
-				u32Data[7] / u32Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_max_epu32(m256iData, m256iOper);
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_min_epu32(m256iData, m256iOper);
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::uint32_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi32(m256iData, u32Oper);
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_srli_epi32(m256iData, u32Oper); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi32(std::rotl(u32Data[0], u32Oper), std::rotl(u32Data[1], u32Oper),
-				std::rotl(u32Data[2], u32Oper), std::rotl(u32Data[3], u32Oper), std::rotl(u32Data[4], u32Oper),
-				std::rotl(u32Data[5], u32Oper), std::rotl(u32Data[6], u32Oper), std::rotl(u32Data[7], u32Oper));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi32(std::rotr(u32Data[0], u32Oper), std::rotr(u32Data[1], u32Oper),
-				std::rotr(u32Data[2], u32Oper), std::rotr(u32Data[3], u32Oper), std::rotr(u32Data[4], u32Oper),
-				std::rotr(u32Data[5], u32Oper), std::rotr(u32Data[6], u32Oper), std::rotr(u32Data[7], u32Oper));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi32(ut::BitReverse(u32Data[0]), ut::BitReverse(u32Data[1]), ut::BitReverse(u32Data[2]),
-				ut::BitReverse(u32Data[3]), ut::BitReverse(u32Data[4]), ut::BitReverse(u32Data[5]), ut::BitReverse(u32Data[6]),
-				ut::BitReverse(u32Data[7]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint32_t operation.");
-			break;
-		}
-
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::uint32_t>(m256iData);
-		}
-
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
-	};
-
-	void OperVec256_i64(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::int64_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
-		}
-
-		alignas(32) std::int64_t i64Data[4];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(i64Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto i64Oper = *reinterpret_cast<const std::int64_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi64x(i64Oper);
-
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi64(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi64(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_setr_epi64x(i64Data[0] * i64Oper, i64Data[1] * i64Oper, i64Data[2] * i64Oper,
-				i64Data[3] * i64Oper);
-			break;
-		case OPER_DIV:
-			assert(i64Oper > 0);
-			m256iData = _mm256_setr_epi64x(i64Data[0] / i64Oper, i64Data[1] / i64Oper, i64Data[2] / i64Oper,
-				i64Data[3] / i64Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_setr_epi64x((std::max)(i64Data[0], i64Oper), (std::max)(i64Data[1], i64Oper),
-				(std::max)(i64Data[2], i64Oper), (std::max)(i64Data[3], i64Oper));
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_setr_epi64x((std::min)(i64Data[0], i64Oper), (std::min)(i64Data[1], i64Oper),
-				(std::min)(i64Data[2], i64Oper), (std::min)(i64Data[3], i64Oper));
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::int64_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi64(m256iData, static_cast<int>(i64Oper));
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_setr_epi64x(i64Data[0] >> i64Oper, i64Data[1] >> i64Oper, i64Data[2] >> i64Oper,
-				i64Data[3] >> i64Oper);
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi64x(std::rotl(static_cast<std::uint64_t>(i64Data[0]), static_cast<const int>(i64Oper)),
-					std::rotl(static_cast<std::uint64_t>(i64Data[1]), static_cast<const int>(i64Oper)),
-					std::rotl(static_cast<std::uint64_t>(i64Data[2]), static_cast<const int>(i64Oper)),
-					std::rotl(static_cast<std::uint64_t>(i64Data[3]), static_cast<const int>(i64Oper)));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi64x(std::rotr(static_cast<std::uint64_t>(i64Data[0]), static_cast<const int>(i64Oper)),
-				std::rotr(static_cast<std::uint64_t>(i64Data[1]), static_cast<const int>(i64Oper)),
-				std::rotr(static_cast<std::uint64_t>(i64Data[2]), static_cast<const int>(i64Oper)),
-				std::rotr(static_cast<std::uint64_t>(i64Data[3]), static_cast<const int>(i64Oper)));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi64x(ut::BitReverse(i64Data[0]), ut::BitReverse(i64Data[1]), ut::BitReverse(i64Data[2]),
-				ut::BitReverse(i64Data[3]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported int64_t operation.");
-			break;
+//ModifyOperVec.
+	//Vector of the eVecType size with the lanes of T, the one definition that all the vector modify kernels are built upon.
+	//On x86 operations map to the SSE4.2, AVX2, or AVX-512F/BW intrinsics, depending on the eVecType.
+	//On any other platform (ARM64) the vector is a plain array of lanes, and operations are loops over it,
+	//which are left to the compiler's auto-vectorization.
+	template<typename T, EVecType eVecType>
+	struct VECT {
+		static constexpr auto uLanes = static_cast<std::uint32_t>(eVecType) / sizeof(T);
+		struct LANES { T arr[uLanes]; };
+	#if defined(_M_IX86) || defined(_M_X64)
+		static constexpr auto f128 = eVecType == EVecType::VECTOR_128;
+		static constexpr auto f256 = eVecType == EVecType::VECTOR_256;
+		template<typename T128, typename T256, typename T512>
+		using TPick = std::conditional_t<f128, T128, std::conditional_t<f256, T256, T512>>;
+		using TReg = std::conditional_t<std::is_same_v<T, float>, TPick<__m128, __m256, __m512>,
+			std::conditional_t<std::is_same_v<T, double>, TPick<__m128d, __m256d, __m512d>, TPick<__m128i, __m256i, __m512i>>>;
+		using VEC8 = VECT<std::uint8_t, eVecType>;   //Integral vectors share the same register type,
+		using VEC16 = VECT<std::uint16_t, eVecType>; //so the operations of one lanes type are built
+		using VEC32 = VECT<std::uint32_t, eVecType>; //with the operations of the others.
+		using VEC64 = VECT<std::uint64_t, eVecType>;
+	#else //^^^ _M_IX86 || _M_X64 / vvv Any other platform.
+		using TReg = LANES;
+	#endif
+
+		template<typename TFunc> //Operation lane by lane.
+		[[nodiscard]] static auto Lanes(TReg tReg, TFunc Func) -> TReg {
+			auto stLanes = std::bit_cast<LANES>(tReg);
+			for (auto& ref : stLanes.arr) {
+				ref = static_cast<T>(Func(ref));
+			}
+			return std::bit_cast<TReg>(stLanes);
 		}
 
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::int64_t>(m256iData);
+		template<typename TFunc> //Operation lane by lane, over two vectors.
+		[[nodiscard]] static auto Lanes(TReg tReg1, TReg tReg2, TFunc Func) -> TReg {
+			auto stLanes1 = std::bit_cast<LANES>(tReg1);
+			const auto stLanes2 = std::bit_cast<LANES>(tReg2);
+			for (auto i = 0U; i < uLanes; ++i) {
+				stLanes1.arr[i] = static_cast<T>(Func(stLanes1.arr[i], stLanes2.arr[i]));
+			}
+			return std::bit_cast<TReg>(stLanes1);
 		}
 
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
-	}
+		[[nodiscard]] static auto Load(const std::byte* pData) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				const auto pFlt = reinterpret_cast<const float*>(pData);
+				if constexpr (f128) { return _mm_loadu_ps(pFlt); }
+				else if constexpr (f256) { return _mm256_loadu_ps(pFlt); }
+				else { return _mm512_loadu_ps(pFlt); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				const auto pDbl = reinterpret_cast<const double*>(pData);
+				if constexpr (f128) { return _mm_loadu_pd(pDbl); }
+				else if constexpr (f256) { return _mm256_loadu_pd(pDbl); }
+				else { return _mm512_loadu_pd(pDbl); }
+			}
+			else {
+				if constexpr (f128) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData)); }
+				else if constexpr (f256) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)); }
+				else { return _mm512_loadu_si512(pData); }
+			}
+		#else
+			TReg tReg;
+			std::memcpy(&tReg, pData, sizeof(tReg));
+			return tReg;
+		#endif
+		}
+
+		static void Store(std::byte* pData, TReg tReg) {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				const auto pFlt = reinterpret_cast<float*>(pData);
+				if constexpr (f128) { _mm_storeu_ps(pFlt, tReg); }
+				else if constexpr (f256) { _mm256_storeu_ps(pFlt, tReg); }
+				else { _mm512_storeu_ps(pFlt, tReg); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				const auto pDbl = reinterpret_cast<double*>(pData);
+				if constexpr (f128) { _mm_storeu_pd(pDbl, tReg); }
+				else if constexpr (f256) { _mm256_storeu_pd(pDbl, tReg); }
+				else { _mm512_storeu_pd(pDbl, tReg); }
+			}
+			else {
+				if constexpr (f128) { _mm_storeu_si128(reinterpret_cast<__m128i*>(pData), tReg); }
+				else if constexpr (f256) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), tReg); }
+				else { _mm512_storeu_si512(pData, tReg); }
+			}
+		#else
+			std::memcpy(pData, &tReg, sizeof(tReg));
+		#endif
+		}
 
-	void OperVec256_u64(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256iData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData));
-		if (hms.fBigEndian) {
-			m256iData = ByteSwapVec<std::uint64_t>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData)));
+		[[nodiscard]] static auto Set1(T tValue) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_set1_ps(tValue); }
+				else if constexpr (f256) { return _mm256_set1_ps(tValue); }
+				else { return _mm512_set1_ps(tValue); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_set1_pd(tValue); }
+				else if constexpr (f256) { return _mm256_set1_pd(tValue); }
+				else { return _mm512_set1_pd(tValue); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				const auto chValue = static_cast<char>(tValue);
+				if constexpr (f128) { return _mm_set1_epi8(chValue); }
+				else if constexpr (f256) { return _mm256_set1_epi8(chValue); }
+				else { return _mm512_set1_epi8(chValue); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				const auto shValue = static_cast<short>(tValue);
+				if constexpr (f128) { return _mm_set1_epi16(shValue); }
+				else if constexpr (f256) { return _mm256_set1_epi16(shValue); }
+				else { return _mm512_set1_epi16(shValue); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				const auto iValue = static_cast<int>(tValue);
+				if constexpr (f128) { return _mm_set1_epi32(iValue); }
+				else if constexpr (f256) { return _mm256_set1_epi32(iValue); }
+				else { return _mm512_set1_epi32(iValue); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+				const auto llValue = static_cast<long long>(tValue);
+				if constexpr (f128) { return _mm_set1_epi64x(llValue); }
+				else if constexpr (f256) { return _mm256_set1_epi64x(llValue); }
+				else { return _mm512_set1_epi64(llValue); }
+			}
+		#else
+			TReg tReg;
+			std::fill_n(tReg.arr, uLanes, tValue);
+			return tReg;
+		#endif
+		}
+
+		[[nodiscard]] static auto Add(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_add_ps(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_ps(tReg1, tReg2); }
+				else { return _mm512_add_ps(tReg1, tReg2); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_add_pd(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_pd(tReg1, tReg2); }
+				else { return _mm512_add_pd(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				if constexpr (f128) { return _mm_add_epi8(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_epi8(tReg1, tReg2); }
+				else { return _mm512_add_epi8(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				if constexpr (f128) { return _mm_add_epi16(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_epi16(tReg1, tReg2); }
+				else { return _mm512_add_epi16(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				if constexpr (f128) { return _mm_add_epi32(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_epi32(tReg1, tReg2); }
+				else { return _mm512_add_epi32(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+				if constexpr (f128) { return _mm_add_epi64(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_add_epi64(tReg1, tReg2); }
+				else { return _mm512_add_epi64(tReg1, tReg2); }
+			}
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 + t2; });
+		#endif
 		}
 
-		alignas(32) std::uint64_t u64Data[4];
-		_mm256_store_si256(reinterpret_cast<__m256i*>(u64Data), m256iData);
-		assert(!hms.spnData.empty());
-		const auto u64Oper = *reinterpret_cast<const std::uint64_t*>(hms.spnData.data());
-		const auto m256iOper = _mm256_set1_epi64x(u64Oper);
+		[[nodiscard]] static auto Sub(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_sub_ps(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_ps(tReg1, tReg2); }
+				else { return _mm512_sub_ps(tReg1, tReg2); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_sub_pd(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_pd(tReg1, tReg2); }
+				else { return _mm512_sub_pd(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				if constexpr (f128) { return _mm_sub_epi8(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_epi8(tReg1, tReg2); }
+				else { return _mm512_sub_epi8(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				if constexpr (f128) { return _mm_sub_epi16(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_epi16(tReg1, tReg2); }
+				else { return _mm512_sub_epi16(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				if constexpr (f128) { return _mm_sub_epi32(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_epi32(tReg1, tReg2); }
+				else { return _mm512_sub_epi32(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+				if constexpr (f128) { return _mm_sub_epi64(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_sub_epi64(tReg1, tReg2); }
+				else { return _mm512_sub_epi64(tReg1, tReg2); }
+			}
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 - t2; });
+		#endif
+		}
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256iData = _mm256_add_epi64(m256iData, m256iOper);
-			break;
-		case OPER_SUB:
-			m256iData = _mm256_sub_epi64(m256iData, m256iOper);
-			break;
-		case OPER_MUL:
-			m256iData = _mm256_setr_epi64x(u64Data[0] * u64Oper, u64Data[1] * u64Oper, u64Data[2] * u64Oper,
-				u64Data[3] * u64Oper);
-			break;
-		case OPER_DIV:
-			assert(u64Oper > 0);
-			m256iData = _mm256_setr_epi64x(u64Data[0] / u64Oper, u64Data[1] / u64Oper, u64Data[2] / u64Oper,
-				u64Data[3] / u64Oper);
-			break;
-		case OPER_MIN:
-			m256iData = _mm256_setr_epi64x((std::max)(u64Data[0], u64Oper), (std::max)(u64Data[1], u64Oper),
-				(std::max)(u64Data[2], u64Oper), (std::max)(u64Data[3], u64Oper));
-			break;
-		case OPER_MAX:
-			m256iData = _mm256_setr_epi64x((std::min)(u64Data[0], u64Oper), (std::min)(u64Data[1], u64Oper),
-				 (std::min)(u64Data[2], u64Oper), (std::min)(u64Data[3], u64Oper));
-			break;
-		case OPER_SWAP:
-			m256iData = ByteSwapVec<std::uint64_t>(m256iData);
-			break;
-		case OPER_OR:
-			m256iData = _mm256_or_si256(m256iData, m256iOper);
-			break;
-		case OPER_XOR:
-			m256iData = _mm256_xor_si256(m256iData, m256iOper);
-			break;
-		case OPER_AND:
-			m256iData = _mm256_and_si256(m256iData, m256iOper);
-			break;
-		case OPER_NOT:
-			//_mm256_cmpeq_epi64(a,a) will result in all 1s, then XOR to reverse bits.
-			m256iData = _mm256_xor_si256(m256iData, _mm256_cmpeq_epi64(m256iData, m256iData));
-			break;
-		case OPER_SHL:
-			m256iData = _mm256_slli_epi64(m256iData, static_cast<int>(u64Oper));
-			break;
-		case OPER_SHR:
-			m256iData = _mm256_srli_epi64(m256iData, static_cast<int>(u64Oper)); //Logical shift.
-			break;
-		case OPER_ROTL:
-			m256iData = _mm256_setr_epi64x(std::rotl(u64Data[0], static_cast<const int>(u64Oper)),
-				std::rotl(u64Data[1], static_cast<const int>(u64Oper)),
-				std::rotl(u64Data[2], static_cast<const int>(u64Oper)),
-				std::rotl(u64Data[3], static_cast<const int>(u64Oper)));
-			break;
-		case OPER_ROTR:
-			m256iData = _mm256_setr_epi64x(std::rotr(u64Data[0], static_cast<const int>(u64Oper)),
-				std::rotr(u64Data[1], static_cast<const int>(u64Oper)),
-				std::rotr(u64Data[2], static_cast<const int>(u64Oper)),
-				std::rotr(u64Data[3], static_cast<const int>(u64Oper)));
-			break;
-		case OPER_BITREV:
-			m256iData = _mm256_setr_epi64x(ut::BitReverse(u64Data[0]), ut::BitReverse(u64Data[1]), ut::BitReverse(u64Data[2]),
-				ut::BitReverse(u64Data[3]));
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported uint64_t operation.");
-			break;
+		[[nodiscard]] static auto Mul(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_mul_ps(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_mul_ps(tReg1, tReg2); }
+				else { return _mm512_mul_ps(tReg1, tReg2); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_mul_pd(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_mul_pd(tReg1, tReg2); }
+				else { return _mm512_mul_pd(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint8_t)) { //Even and odd bytes are multiplied as 16-bit lanes.
+				const auto tRegEven = VEC16::Mul(tReg1, tReg2);
+				const auto tRegOdd = VEC16::Mul(VEC16::Shr(tReg1, 8), VEC16::Shr(tReg2, 8));
+				return Or(VEC16::Shl(tRegOdd, 8), VEC16::Shr(VEC16::Shl(tRegEven, 8), 8));
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				if constexpr (f128) { return _mm_mullo_epi16(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_mullo_epi16(tReg1, tReg2); }
+				else { return _mm512_mullo_epi16(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				if constexpr (f128) { return _mm_mullo_epi32(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_mullo_epi32(tReg1, tReg2); }
+				else { return _mm512_mullo_epi32(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) { //No 64-bit multiplication below the AVX-512DQ.
+				//Lo1*Lo2 + ((Hi1*Lo2 + Lo1*Hi2) << 32), from the 32x32=64 bit multiplications of the low halves.
+				const auto lmbMulLo32 = [](TReg tRegA, TReg tRegB) {
+					if constexpr (f128) { return _mm_mul_epu32(tRegA, tRegB); }
+					else if constexpr (f256) { return _mm256_mul_epu32(tRegA, tRegB); }
+					else { return _mm512_mul_epu32(tRegA, tRegB); }
+					};
+				const auto tRegCross = Add(lmbMulLo32(VEC64::Shr(tReg1, 32), tReg2), lmbMulLo32(tReg1, VEC64::Shr(tReg2, 32)));
+				return Add(lmbMulLo32(tReg1, tReg2), VEC64::Shl(tRegCross, 32));
+			}
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 * t2; });
+		#endif
 		}
 
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256iData = ByteSwapVec<std::uint64_t>(m256iData);
+		[[nodiscard]] static auto Div(TReg tReg, T tDivisor) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_div_ps(tReg, Set1(tDivisor)); }
+				else if constexpr (f256) { return _mm256_div_ps(tReg, Set1(tDivisor)); }
+				else { return _mm512_div_ps(tReg, Set1(tDivisor)); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_div_pd(tReg, Set1(tDivisor)); }
+				else if constexpr (f256) { return _mm256_div_pd(tReg, Set1(tDivisor)); }
+				else { return _mm512_div_pd(tReg, Set1(tDivisor)); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) { //No exact 64-bit division in the floating point.
+				return Lanes(tReg, [tDivisor](T tData) { return tData / tDivisor; });
+			}
+			else { //The 128-bit parts, one by one.
+				struct PARTS { __m128i arr[uLanes * sizeof(T) / 16]; };
+				auto stParts = std::bit_cast<PARTS>(tReg);
+				for (auto& ref : stParts.arr) {
+					ref = Div128(ref, tDivisor);
+				}
+				return std::bit_cast<TReg>(stParts);
+			}
+		#else
+			return Lanes(tReg, [tDivisor](T tData) { return tData / tDivisor; });
+		#endif
 		}
 
-		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData), m256iData);
-	}
+		[[nodiscard]] static auto Min(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_min_ps(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_min_ps(tReg1, tReg2); }
+				else { return _mm512_min_ps(tReg1, tReg2); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_min_pd(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_min_pd(tReg1, tReg2); }
+				else { return _mm512_min_pd(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t) && (f128 || f256)) { //No 64-bit min below the AVX-512F.
+				return Blend(tReg1, tReg2, CmpGt(tReg1, tReg2));
+			}
+			else {
+				return MinMax<true>(tReg1, tReg2);
+			}
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) {
+				if constexpr (std::is_floating_point_v<T>) { return std::fmin(t1, t2); }
+				else { return (std::min)(t1, t2); }
+				});
+		#endif
+		}
+
+		[[nodiscard]] static auto Max(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (std::is_same_v<T, float>) {
+				if constexpr (f128) { return _mm_max_ps(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_max_ps(tReg1, tReg2); }
+				else { return _mm512_max_ps(tReg1, tReg2); }
+			}
+			else if constexpr (std::is_same_v<T, double>) {
+				if constexpr (f128) { return _mm_max_pd(tReg1, tReg2); }
+				else if constexpr (f256) { return _mm256_max_pd(tReg1, tReg2); }
+				else { return _mm512_max_pd(tReg1, tReg2); }
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t) && (f128 || f256)) { //No 64-bit max below the AVX-512F.
+				return Blend(tReg2, tReg1, CmpGt(tReg1, tReg2));
+			}
+			else {
+				return MinMax<false>(tReg1, tReg2);
+			}
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) {
+				if constexpr (std::is_floating_point_v<T>) { return std::fmax(t1, t2); }
+				else { return (std::max)(t1, t2); }
+				});
+		#endif
+		}
 
-	void OperVec256_f(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256Data = _mm256_loadu_ps(reinterpret_cast<const float*>(pData));
-		if (hms.fBigEndian) {
-			m256Data = ByteSwapVec<float>(_mm256_loadu_ps(reinterpret_cast<const float*>(pData)));
+		[[nodiscard]] static auto ByteSwap(TReg tReg) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			return ByteSwapVec<T>(tReg);
+		#else
+			return Lanes(tReg, [](T tData) { return ut::ByteSwap(tData); });
+		#endif
 		}
 
-		assert(std::isfinite(*reinterpret_cast<const float*>(hms.spnData.data())));
-		const auto m256Oper = _mm256_set1_ps(*reinterpret_cast<const float*>(hms.spnData.data()));
+		//Operations only for integral types.
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256Data = _mm256_add_ps(m256Data, m256Oper);
-			break;
-		case OPER_SUB:
-			m256Data = _mm256_sub_ps(m256Data, m256Oper);
-			break;
-		case OPER_MUL:
-			m256Data = _mm256_mul_ps(m256Data, m256Oper);
-			break;
-		case OPER_DIV:
-			assert(*reinterpret_cast<const float*>(hms.spnData.data()) > 0.F);
-			m256Data = _mm256_div_ps(m256Data, m256Oper);
-			break;
-		case OPER_MIN:
-			m256Data = _mm256_max_ps(m256Data, m256Oper);
-			break;
-		case OPER_MAX:
-			m256Data = _mm256_min_ps(m256Data, m256Oper);
-			break;
-		case OPER_SWAP:
-			m256Data = ByteSwapVec<float>(m256Data);
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported float operation.");
-			return;
+		[[nodiscard]] static auto And(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (f128) { return _mm_and_si128(tReg1, tReg2); }
+			else if constexpr (f256) { return _mm256_and_si256(tReg1, tReg2); }
+			else { return _mm512_and_si512(tReg1, tReg2); }
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 & t2; });
+		#endif
 		}
 
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256Data = ByteSwapVec<float>(m256Data);
+		[[nodiscard]] static auto Or(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (f128) { return _mm_or_si128(tReg1, tReg2); }
+			else if constexpr (f256) { return _mm256_or_si256(tReg1, tReg2); }
+			else { return _mm512_or_si512(tReg1, tReg2); }
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 | t2; });
+		#endif
 		}
 
-		_mm256_storeu_ps(reinterpret_cast<float*>(pData), m256Data);
-	}
+		[[nodiscard]] static auto Xor(TReg tReg1, TReg tReg2) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (f128) { return _mm_xor_si128(tReg1, tReg2); }
+			else if constexpr (f256) { return _mm256_xor_si256(tReg1, tReg2); }
+			else { return _mm512_xor_si512(tReg1, tReg2); }
+		#else
+			return Lanes(tReg1, tReg2, [](T t1, T t2) { return t1 ^ t2; });
+		#endif
+		}
 
-	void OperVec256_d(std::byte* pData, const HEXMODIFY& hms) {
-		auto m256dData = _mm256_loadu_pd(reinterpret_cast<const double*>(pData));
-		if (hms.fBigEndian) {
-			m256dData = ByteSwapVec<double>(_mm256_loadu_pd(reinterpret_cast<const double*>(pData)));
+		[[nodiscard]] static auto Not(TReg tReg) -> TReg {
+			return Xor(tReg, Set1(static_cast<T>(-1))); //XOR with all 1s reverses bits.
 		}
 
-		assert(std::isfinite(*reinterpret_cast<const double*>(hms.spnData.data())));
-		const auto m256dOper = _mm256_set1_pd(*reinterpret_cast<const double*>(hms.spnData.data()));
+		[[nodiscard]] static auto Shl(TReg tReg, int iCount) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (sizeof(T) == sizeof(std::uint8_t)) { //No 8-bit shifts, 16-bit shift with the bits crossed the byte masked out.
+				if (static_cast<unsigned>(iCount) > 7U)
+					return Set1(0);
 
-		using enum EHexOperMode;
-		switch (hms.eOperMode) {
-		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
-			break;
-		case OPER_ADD:
-			m256dData = _mm256_add_pd(m256dData, m256dOper);
-			break;
-		case OPER_SUB:
-			m256dData = _mm256_sub_pd(m256dData, m256dOper);
-			break;
-		case OPER_MUL:
-			m256dData = _mm256_mul_pd(m256dData, m256dOper);
-			break;
-		case OPER_DIV:
-			assert(*reinterpret_cast<const double*>(hms.spnData.data()) > 0.);
-			m256dData = _mm256_div_pd(m256dData, m256dOper);
-			break;
-		case OPER_MIN:
-			m256dData = _mm256_max_pd(m256dData, m256dOper);
-			break;
-		case OPER_MAX:
-			m256dData = _mm256_min_pd(m256dData, m256dOper);
-			break;
-		case OPER_SWAP:
-			m256dData = ByteSwapVec<double>(m256dData);
-			break;
-		default:
-			ut::DBG_REPORT(L"Unsupported double operation.");
-			return;
+				return And(VEC16::Shl(tReg, iCount), Set1(static_cast<T>(0xFFU << iCount)));
+			}
+			else {
+				const auto m128iCount = _mm_cvtsi32_si128(iCount);
+				if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+					if constexpr (f128) { return _mm_sll_epi16(tReg, m128iCount); }
+					else if constexpr (f256) { return _mm256_sll_epi16(tReg, m128iCount); }
+					else { return _mm512_sll_epi16(tReg, m128iCount); }
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+					if constexpr (f128) { return _mm_sll_epi32(tReg, m128iCount); }
+					else if constexpr (f256) { return _mm256_sll_epi32(tReg, m128iCount); }
+					else { return _mm512_sll_epi32(tReg, m128iCount); }
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+					if constexpr (f128) { return _mm_sll_epi64(tReg, m128iCount); }
+					else if constexpr (f256) { return _mm256_sll_epi64(tReg, m128iCount); }
+					else { return _mm512_sll_epi64(tReg, m128iCount); }
+				}
+			}
+		#else
+			return Lanes(tReg, [iCount](T tData) { return tData << iCount; });
+		#endif
+		}
+
+		[[nodiscard]] static auto Shr(TReg tReg, int iCount) -> TReg { //Arithmetic shift for the signed types, logical for the unsigned.
+		#if defined(_M_IX86) || defined(_M_X64)
+			if constexpr (sizeof(T) == sizeof(std::uint8_t)) { //No 8-bit shifts, 16-bit shift with the bits crossed the byte masked out.
+				if constexpr (std::is_signed_v<T>) {
+					//Sign bit is extended by the ((Data >> Count) ^ Mask) - Mask, where the Mask is the sign bit shifted.
+					iCount = (std::min)(static_cast<unsigned>(iCount), 7U);
+					const auto tRegMask = Set1(static_cast<T>(0x80U >> iCount));
+					return Sub(Xor(VEC8::Shr(tReg, iCount), tRegMask), tRegMask);
+				}
+				else {
+					if (static_cast<unsigned>(iCount) > 7U)
+						return Set1(0);
+
+					return And(VEC16::Shr(tReg, iCount), Set1(static_cast<T>(0xFFU >> iCount)));
+				}
+			}
+			else {
+				const auto m128iCount = _mm_cvtsi32_si128(iCount);
+				if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+					if constexpr (std::is_signed_v<T>) {
+						if constexpr (f128) { return _mm_sra_epi16(tReg, m128iCount); }
+						else if constexpr (f256) { return _mm256_sra_epi16(tReg, m128iCount); }
+						else { return _mm512_sra_epi16(tReg, m128iCount); }
+					}
+					else {
+						if constexpr (f128) { return _mm_srl_epi16(tReg, m128iCount); }
+						else if constexpr (f256) { return _mm256_srl_epi16(tReg, m128iCount); }
+						else { return _mm512_srl_epi16(tReg, m128iCount); }
+					}
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+					if constexpr (std::is_signed_v<T>) {
+						if constexpr (f128) { return _mm_sra_epi32(tReg, m128iCount); }
+						else if constexpr (f256) { return _mm256_sra_epi32(tReg, m128iCount); }
+						else { return _mm512_sra_epi32(tReg, m128iCount); }
+					}
+					else {
+						if constexpr (f128) { return _mm_srl_epi32(tReg, m128iCount); }
+						else if constexpr (f256) { return _mm256_srl_epi32(tReg, m128iCount); }
+						else { return _mm512_srl_epi32(tReg, m128iCount); }
+					}
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+					if constexpr (std::is_signed_v<T>) {
+						if constexpr (f128 || f256) { //No 64-bit arithmetic shift below the AVX-512F.
+							iCount = (std::min)(static_cast<unsigned>(iCount), 63U);
+							const auto tRegSign = CmpGt(Set1(0), tReg);
+							return Or(VEC64::Shr(tReg, iCount), VEC64::Shl(tRegSign, 64 - iCount));
+						}
+						else { return _mm512_sra_epi64(tReg, m128iCount); }
+					}
+					else {
+						if constexpr (f128) { return _mm_srl_epi64(tReg, m128iCount); }
+						else if constexpr (f256) { return _mm256_srl_epi64(tReg, m128iCount); }
+						else { return _mm512_srl_epi64(tReg, m128iCount); }
+					}
+				}
+			}
+		#else
+			return Lanes(tReg, [iCount](T tData) { return tData >> iCount; });
+		#endif
+		}
+
+		[[nodiscard]] static auto Rotl(TReg tReg, int iCount) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			using VECU = VECT<std::make_unsigned_t<T>, eVecType>;
+			constexpr auto iBits = static_cast<int>(sizeof(T) * 8);
+			iCount &= iBits - 1; //Negative count rotates right, as in the std::rotl.
+			return Or(VECU::Shl(tReg, iCount), VECU::Shr(tReg, iBits - iCount)); //Shift by iBits gives 0.
+		#else
+			return Lanes(tReg, [iCount](T tData) { return std::rotl(static_cast<std::make_unsigned_t<T>>(tData), iCount); });
+		#endif
+		}
+
+		[[nodiscard]] static auto Rotr(TReg tReg, int iCount) -> TReg {
+			return Rotl(tReg, -iCount);
+		}
+
+		[[nodiscard]] static auto BitReverse(TReg tReg) -> TReg {
+		#if defined(_M_IX86) || defined(_M_X64)
+			//Bytes bits are reversed by the nibbles lookup tables, then bytes are reversed inside the lanes.
+			const auto m128iRevLo = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E,
+				0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+			const auto m128iRevHi = _mm_slli_epi16(m128iRevLo, 4);
+			const auto tRegNibble = Set1(static_cast<T>(0x0F0F0F0F0F0F0F0FULL));
+			const auto tRegLo = And(tReg, tRegNibble);
+			const auto tRegHi = And(VEC16::Shr(tReg, 4), tRegNibble);
+			TReg tRegBytes;
+			if constexpr (f128) {
+				tRegBytes = _mm_or_si128(_mm_shuffle_epi8(m128iRevHi, tRegLo), _mm_shuffle_epi8(m128iRevLo, tRegHi));
+			}
+			else if constexpr (f256) {
+				tRegBytes = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(m128iRevHi), tRegLo),
+					_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(m128iRevLo), tRegHi));
+			}
+			else {
+				tRegBytes = _mm512_or_si512(_mm512_shuffle_epi8(_mm512_broadcast_i32x4(m128iRevHi), tRegLo),
+					_mm512_shuffle_epi8(_mm512_broadcast_i32x4(m128iRevLo), tRegHi));
+			}
+
+			return ByteSwap(tRegBytes);
+		#else
+			return Lanes(tReg, [](T tData) { return ut::BitReverse(tData); });
+		#endif
 		}
 
-		if (hms.fBigEndian) { //Swap bytes back.
-			m256dData = ByteSwapVec<double>(m256dData);
+	#if defined(_M_IX86) || defined(_M_X64)
+	private:
+		template<bool fMin> //8, 16, 32-bit lanes, and 64-bit lanes of the AVX-512.
+		[[nodiscard]] static auto MinMax(TReg tReg1, TReg tReg2) -> TReg {
+			constexpr auto fSigned = std::is_signed_v<T>;
+			if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+				if constexpr (f128) {
+					if constexpr (fSigned) { return fMin ? _mm_min_epi8(tReg1, tReg2) : _mm_max_epi8(tReg1, tReg2); }
+					else { return fMin ? _mm_min_epu8(tReg1, tReg2) : _mm_max_epu8(tReg1, tReg2); }
+				}
+				else if constexpr (f256) {
+					if constexpr (fSigned) { return fMin ? _mm256_min_epi8(tReg1, tReg2) : _mm256_max_epi8(tReg1, tReg2); }
+					else { return fMin ? _mm256_min_epu8(tReg1, tReg2) : _mm256_max_epu8(tReg1, tReg2); }
+				}
+				else {
+					if constexpr (fSigned) { return fMin ? _mm512_min_epi8(tReg1, tReg2) : _mm512_max_epi8(tReg1, tReg2); }
+					else { return fMin ? _mm512_min_epu8(tReg1, tReg2) : _mm512_max_epu8(tReg1, tReg2); }
+				}
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+				if constexpr (f128) {
+					if constexpr (fSigned) { return fMin ? _mm_min_epi16(tReg1, tReg2) : _mm_max_epi16(tReg1, tReg2); }
+					else { return fMin ? _mm_min_epu16(tReg1, tReg2) : _mm_max_epu16(tReg1, tReg2); }
+				}
+				else if constexpr (f256) {
+					if constexpr (fSigned) { return fMin ? _mm256_min_epi16(tReg1, tReg2) : _mm256_max_epi16(tReg1, tReg2); }
+					else { return fMin ? _mm256_min_epu16(tReg1, tReg2) : _mm256_max_epu16(tReg1, tReg2); }
+				}
+				else {
+					if constexpr (fSigned) { return fMin ? _mm512_min_epi16(tReg1, tReg2) : _mm512_max_epi16(tReg1, tReg2); }
+					else { return fMin ? _mm512_min_epu16(tReg1, tReg2) : _mm512_max_epu16(tReg1, tReg2); }
+				}
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				if constexpr (f128) {
+					if constexpr (fSigned) { return fMin ? _mm_min_epi32(tReg1, tReg2) : _mm_max_epi32(tReg1, tReg2); }
+					else { return fMin ? _mm_min_epu32(tReg1, tReg2) : _mm_max_epu32(tReg1, tReg2); }
+				}
+				else if constexpr (f256) {
+					if constexpr (fSigned) { return fMin ? _mm256_min_epi32(tReg1, tReg2) : _mm256_max_epi32(tReg1, tReg2); }
+					else { return fMin ? _mm256_min_epu32(tReg1, tReg2) : _mm256_max_epu32(tReg1, tReg2); }
+				}
+				else {
+					if constexpr (fSigned) { return fMin ? _mm512_min_epi32(tReg1, tReg2) : _mm512_max_epi32(tReg1, tReg2); }
+					else { return fMin ? _mm512_min_epu32(tReg1, tReg2) : _mm512_max_epu32(tReg1, tReg2); }
+				}
+			}
+			else if constexpr (sizeof(T) == sizeof(std::uint64_t)) {
+				if constexpr (fSigned) { return fMin ? _mm512_min_epi64(tReg1, tReg2) : _mm512_max_epi64(tReg1, tReg2); }
+				else { return fMin ? _mm512_min_epu64(tReg1, tReg2) : _mm512_max_epu64(tReg1, tReg2); }
+			}
 		}
 
-		_mm256_storeu_pd(reinterpret_cast<double*>(pData), m256dData);
-	}
+		[[nodiscard]] static auto CmpGt(TReg tReg1, TReg tReg2) -> TReg { //64-bit lanes of the 128/256-bit vectors.
+			if constexpr (!std::is_signed_v<T>) { //Unsigned compare is the signed one with the sign bits flipped.
+				const auto tRegSign = Set1(static_cast<T>(0x8000000000000000ULL));
+				tReg1 = Xor(tReg1, tRegSign);
+				tReg2 = Xor(tReg2, tRegSign);
+			}
 
-	template<EVecType eVecType>
-	void ModifyOperVec(std::byte* pData, const HEXMODIFY& hms, [[maybe_unused]] SpanCByte)
-	{
-		assert(pData != nullptr);
-		using enum EHexDataType;
+			if constexpr (f128) { return _mm_cmpgt_epi64(tReg1, tReg2); }
+			else { return _mm256_cmpgt_epi64(tReg1, tReg2); }
+		}
 
-		if constexpr (eVecType == EVecType::VECTOR_128) {
-			switch (hms.eDataType) {
-			case DATA_INT8:
-				OperVec128_i8(pData, hms);
-				break;
-			case DATA_UINT8:
-				OperVec128_u8(pData, hms);
-				break;
-			case DATA_INT16:
-				OperVec128_i16(pData, hms);
-				break;
-			case DATA_UINT16:
-				OperVec128_u16(pData, hms);
-				break;
-			case DATA_INT32:
-				OperVec128_i32(pData, hms);
-				break;
-			case DATA_UINT32:
-				OperVec128_u32(pData, hms);
-				break;
-			case DATA_INT64:
-				OperVec128_i64(pData, hms);
-				break;
-			case DATA_UINT64:
-				OperVec128_u64(pData, hms);
-				break;
-			case DATA_FLOAT:
-				OperVec128_f(pData, hms);
-				break;
-			case DATA_DOUBLE:
-				OperVec128_d(pData, hms);
-				break;
-			default:
-				break;
-			}
+		[[nodiscard]] static auto Blend(TReg tReg1, TReg tReg2, TReg tRegMask) -> TReg { //tReg2 lanes where the tRegMask is set.
+			if constexpr (f128) { return _mm_blendv_epi8(tReg1, tReg2, tRegMask); }
+			else { return _mm256_blendv_epi8(tReg1, tReg2, tRegMask); }
 		}
-		else if constexpr (eVecType == EVecType::VECTOR_256) {
-			switch (hms.eDataType) {
-			case DATA_INT8:
-				OperVec256_i8(pData, hms);
-				break;
-			case DATA_UINT8:
-				OperVec256_u8(pData, hms);
-				break;
-			case DATA_INT16:
-				OperVec256_i16(pData, hms);
-				break;
-			case DATA_UINT16:
-				OperVec256_u16(pData, hms);
-				break;
-			case DATA_INT32:
-				OperVec256_i32(pData, hms);
-				break;
-			case DATA_UINT32:
-				OperVec256_u32(pData, hms);
-				break;
-			case DATA_INT64:
-				OperVec256_i64(pData, hms);
-				break;
-			case DATA_UINT64:
-				OperVec256_u64(pData, hms);
-				break;
-			case DATA_FLOAT:
-				OperVec256_f(pData, hms);
-				break;
-			case DATA_DOUBLE:
-				OperVec256_d(pData, hms);
-				break;
-			default:
-				break;
+
+		//8, 16, and 32-bit lanes are divided as the floats or the doubles, which is exact for them.
+		//Lanes are widened to 32-bit, four at a time, for the floats, and two at a time for the doubles.
+		[[nodiscard]] static auto Div128(__m128i m128iData, T tDivisor) -> __m128i {
+			constexpr auto fSigned = std::is_signed_v<T>;
+			if constexpr (sizeof(T) == sizeof(std::uint32_t)) {
+				const auto m128dDivisor = _mm_set1_pd(static_cast<double>(tDivisor));
+				const auto lmbDiv2 = [m128dDivisor](__m128i m128i2) { //Two lanes at the low 64 bits.
+					if constexpr (fSigned) {
+						return _mm_cvttpd_epi32(_mm_div_pd(_mm_cvtepi32_pd(m128i2), m128dDivisor));
+					}
+					else { //Unsigned are biased to the signed range and back, only the signed conversion is there.
+						const auto m128iBias = _mm_set1_epi32(static_cast<int>(0x80000000U));
+						const auto m128dBias = _mm_set1_pd(2147483648.);
+						const auto m128dData = _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(m128i2, m128iBias)), m128dBias);
+						const auto m128dQuot = _mm_sub_pd(_mm_floor_pd(_mm_div_pd(m128dData, m128dDivisor)), m128dBias);
+						return _mm_xor_si128(_mm_cvttpd_epi32(m128dQuot), m128iBias);
+					}
+					};
+				return _mm_unpacklo_epi64(lmbDiv2(m128iData), lmbDiv2(_mm_srli_si128(m128iData, 8)));
+			}
+			else {
+				const auto m128Divisor = _mm_set1_ps(static_cast<float>(tDivisor));
+				const auto lmbDiv4 = [m128Divisor](__m128i m128i4) { //Four lanes widened to 32-bit.
+					return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(m128i4), m128Divisor));
+					};
+
+				if constexpr (sizeof(T) == sizeof(std::uint16_t)) {
+					const auto m128iLo = fSigned ? _mm_cvtepi16_epi32(m128iData) : _mm_cvtepu16_epi32(m128iData);
+					const auto m128iDataHi = _mm_srli_si128(m128iData, 8);
+					const auto m128iHi = fSigned ? _mm_cvtepi16_epi32(m128iDataHi) : _mm_cvtepu16_epi32(m128iDataHi);
+					return fSigned ? _mm_packs_epi32(lmbDiv4(m128iLo), lmbDiv4(m128iHi)) :
+						_mm_packus_epi32(lmbDiv4(m128iLo), lmbDiv4(m128iHi));
+				}
+				else if constexpr (sizeof(T) == sizeof(std::uint8_t)) {
+					const auto lmbWiden = [](__m128i m128i4) {
+						return fSigned ? _mm_cvtepi8_epi32(m128i4) : _mm_cvtepu8_epi32(m128i4);
+						};
+					const auto m128i0 = lmbDiv4(lmbWiden(m128iData));
+					const auto m128i1 = lmbDiv4(lmbWiden(_mm_srli_si128(m128iData, 4)));
+					const auto m128i2 = lmbDiv4(lmbWiden(_mm_srli_si128(m128iData, 8)));
+					const auto m128i3 = lmbDiv4(lmbWiden(_mm_srli_si128(m128iData, 12)));
+					if constexpr (fSigned) {
+						return _mm_packs_epi16(_mm_packs_epi32(m128i0, m128i1), _mm_packs_epi32(m128i2, m128i3));
+					}
+					else {
+						return _mm_packus_epi16(_mm_packus_epi32(m128i0, m128i1), _mm_packus_epi32(m128i2, m128i3));
+					}
+				}
 			}
 		}
-	}
-#elif defined(_M_ARM64) //^^^ _M_IX86 || _M_X64 / vvv _M_ARM64
-	template<typename T>
-	void OperScalarT(T* pData, const HEXMODIFY& hms) {
-		constexpr auto uChunksData = 16U / sizeof(T);
+	#endif //^^^ _M_IX86 || _M_X64
+	};
+
+	template<typename T, EVecType eVecType>
+	void OperVecT(std::byte* pData, const HEXMODIFY& hms) {
+		using VEC = VECT<T, eVecType>;
+		auto tReg = VEC::Load(pData);
 		if (hms.fBigEndian) {
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] = ut::ByteSwap(pData[i]);
-			}
+			tReg = VEC::ByteSwap(tReg);
 		}
 
 		assert(!hms.spnData.empty());
 		const T tOper = *reinterpret_cast<const T*>(hms.spnData.data());
+		if constexpr (std::is_floating_point_v<T>) {
+			assert(std::isfinite(tOper));
+		}
+
+		const auto tRegOper = VEC::Set1(tOper);
 
 		using enum EHexOperMode;
 		if constexpr (std::is_integral_v<T>) { //Operations only for integral types.
 			switch (hms.eOperMode) {
 			case OPER_OR:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] |= tOper;
-				}
+				tReg = VEC::Or(tReg, tRegOper);
 				break;
 			case OPER_XOR:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] ^= tOper;
-				}
+				tReg = VEC::Xor(tReg, tRegOper);
 				break;
 			case OPER_AND:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] &= tOper;
-				}
+				tReg = VEC::And(tReg, tRegOper);
 				break;
 			case OPER_NOT:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] = ~pData[i];
-				}
+				tReg = VEC::Not(tReg);
 				break;
 			case OPER_SHL:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] <<= tOper;
-				}
+				tReg = VEC::Shl(tReg, static_cast<int>(tOper));
 				break;
 			case OPER_SHR:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] >>= tOper;
-				}
+				tReg = VEC::Shr(tReg, static_cast<int>(tOper));
 				break;
 			case OPER_ROTL:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] = std::rotl(static_cast<std::make_unsigned_t<T>>(pData[i]), static_cast<const int>(tOper));
-				}
+				tReg = VEC::Rotl(tReg, static_cast<int>(tOper));
 				break;
 			case OPER_ROTR:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] = std::rotr(static_cast<std::make_unsigned_t<T>>(pData[i]), static_cast<const int>(tOper));
-				}
+				tReg = VEC::Rotr(tReg, static_cast<int>(tOper));
 				break;
 			case OPER_BITREV:
-				for (auto i = 0U; i < uChunksData; ++i) {
-					pData[i] = ut::BitReverse(pData[i]);
-				}
+				tReg = VEC::BitReverse(tReg);
 				break;
 			default:
 				break;
@@ -4047,60 +3535,36 @@ namespace HEXCTRL::INTERNAL::simd {
 		case OPER_ASSIGN: //Implemented as MODIFY_REPEAT.
 			break;
 		case OPER_ADD:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] += tOper;
-			}
+			tReg = VEC::Add(tReg, tRegOper);
 			break;
 		case OPER_SUB:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] -= tOper;
-			}
+			tReg = VEC::Sub(tReg, tRegOper);
 			break;
 		case OPER_MUL:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] *= tOper;
-			}
+			tReg = VEC::Mul(tReg, tRegOper);
 			break;
 		case OPER_DIV:
 			assert(tOper > 0);
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] /= tOper;
-			}
+			tReg = VEC::Div(tReg, tOper);
 			break;
 		case OPER_MIN:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				if constexpr (std::is_floating_point_v<T>) {
-					pData[i] = std::fmax(pData[i], tOper);
-				}
-				else {
-					pData[i] = (std::max)(pData[i], tOper);
-				}
-			}
+			tReg = VEC::Max(tReg, tRegOper);
 			break;
 		case OPER_MAX:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				if constexpr (std::is_floating_point_v<T>) {
-					pData[i] = std::fmin(pData[i], tOper);
-				}
-				else {
-					pData[i] = (std::min)(pData[i], tOper);
-				}
-			}
+			tReg = VEC::Min(tReg, tRegOper);
 			break;
 		case OPER_SWAP:
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] = ut::ByteSwap(pData[i]);
-			}
+			tReg = VEC::ByteSwap(tReg);
 			break;
 		default:
 			break;
 		}
 
 		if (hms.fBigEndian) { //Swap bytes back.
-			for (auto i = 0U; i < uChunksData; ++i) {
-				pData[i] = ut::ByteSwap(pData[i]);
-			}
+			tReg = VEC::ByteSwap(tReg);
 		}
+
+		VEC::Store(pData, tReg);
 	}
 
 	template<EVecType eVecType>
@@ -4111,38 +3575,37 @@ namespace HEXCTRL::INTERNAL::simd {
 
 		switch (hms.eDataType) {
 		case DATA_INT8:
-			OperScalarT(reinterpret_cast<std::int8_t*>(pData), hms);
+			OperVecT<std::int8_t, eVecType>(pData, hms);
 			break;
 		case DATA_UINT8:
-			OperScalarT(reinterpret_cast<std::uint8_t*>(pData), hms);
+			OperVecT<std::uint8_t, eVecType>(pData, hms);
 			break;
 		case DATA_INT16:
-			OperScalarT(reinterpret_cast<std::int16_t*>(pData), hms);
+			OperVecT<std::int16_t, eVecType>(pData, hms);
 			break;
 		case DATA_UINT16:
-			OperScalarT(reinterpret_cast<std::uint16_t*>(pData), hms);
+			OperVecT<std::uint16_t, eVecType>(pData, hms);
 			break;
 		case DATA_INT32:
-			OperScalarT(reinterpret_cast<std::int32_t*>(pData), hms);
+			OperVecT<std::int32_t, eVecType>(pData, hms);
 			break;
 		case DATA_UINT32:
-			OperScalarT(reinterpret_cast<std::uint32_t*>(pData), hms);
+			OperVecT<std::uint32_t, eVecType>(pData, hms);
 			break;
 		case DATA_INT64:
-			OperScalarT(reinterpret_cast<std::int64_t*>(pData), hms);
+			OperVecT<std::int64_t, eVecType>(pData, hms);
 			break;
 		case DATA_UINT64:
-			OperScalarT(reinterpret_cast<std::uint64_t*>(pData), hms);
+			OperVecT<std::uint64_t, eVecType>(pData, hms);
 			break;
 		case DATA_FLOAT:
-			OperScalarT(reinterpret_cast<float*>(pData), hms);
+			OperVecT<float, eVecType>(pData, hms);
 			break;
 		case DATA_DOUBLE:
-			OperScalarT(reinterpret_cast<double*>(pData), hms);
+			OperVecT<double, eVecType>(pData, hms);
 			break;
 		default:
 			break;
 		}
 	}
-#endif //^^^ _M_ARM64
 }
\ No newline at end of file
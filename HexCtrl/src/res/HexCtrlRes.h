@@ -85,6 +85,7 @@
 #define IDC_HEXCTRL_TEMPLMGR_STAT_AVAIL 9089
 #define IDC_HEXCTRL_TEMPLMGR_STAT_APPLY 9090
 #define IDC_HEXCTRL_SEARCH_EDIT_WC      9091
+#define IDC_HEXCTRL_SEARCH_BTN_PAUSE    9092
 #define IDM_HEXCTRL_SEARCH_SEARCH       33001
 #define IDM_HEXCTRL_SEARCH_NEXT         33002
 #define IDM_HEXCTRL_SEARCH_PREV         33003
@@ -146,9 +147,9 @@
 // 
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
-#define _APS_NEXT_RESOURCE_VALUE        9092
+#define _APS_NEXT_RESOURCE_VALUE        9093
 #define _APS_NEXT_COMMAND_VALUE         33057
-#define _APS_NEXT_CONTROL_VALUE         9092
-#define _APS_NEXT_SYMED_VALUE           9092
+#define _APS_NEXT_CONTROL_VALUE         9093
+#define _APS_NEXT_SYMED_VALUE           9093
 #endif
 #endif
@@ -1,3 +1,4 @@
+#pragma once
 #include "../../HexCtrl/HexCtrl.h"
 #include "CppUnitTest.h"
 #include <bit>
@@ -50,17 +51,30 @@ namespace TestHexCtrl {
 		return arrDataReference;
 	}
 
+	[[nodiscard]] inline auto CreateTestHexCtrl() -> IHexCtrlPtr {
+		auto pHex { CreateHexCtrl() };
+		pHex->Create({ .hInstRes { ::GetModuleHandleW(WIDEN_STRING(HEXCTRL_LIBNAME)) },
+			.dwStyle { WS_POPUP | WS_OVERLAPPEDWINDOW }, .dwExStyle { WS_EX_APPWINDOW } });
+		return pHex;
+	}
+
 	[[nodiscard]] inline auto GetHexCtrl() -> IHexCtrl* {
 		static IHexCtrl* pHexCtrl = []() {
-			static auto pHex { CreateHexCtrl() };
-			pHex->Create({ .hInstRes { ::GetModuleHandleW(WIDEN_STRING(HEXCTRL_LIBNAME)) },
-				.dwStyle { WS_POPUP | WS_OVERLAPPEDWINDOW }, .dwExStyle { WS_EX_APPWINDOW } });
+			static auto pHex { CreateTestHexCtrl() };
 			pHex->SetData({ .spnData { GetDataHexCtrl(), GetTestDataSize() }, .fMutable { true } });
 			return pHex.get();
 			}(); //Immediate lambda for one time HexCtrl creation.
 		return pHexCtrl;
 	}
 
+	//HexCtrl for the tests with their own data, apart from the GetHexCtrl's one.
+	//It's created once, and the hds is set to it on every call.
+	[[nodiscard]] inline auto GetHexCtrlWithData(const HEXDATA& hds) -> IHexCtrl* {
+		static const auto pHex { CreateTestHexCtrl() };
+		pHex->SetData(hds);
+		return pHex.get();
+	}
+
 	[[nodiscard]] inline auto& GetMT19937() {
 		static std::mt19937 gen(std::random_device { }());
 		return gen;
@@ -0,0 +1,95 @@
+#include "CHexCtrlInit.h"
+#include "CppUnitTest.h"
+#include <cstring>
+#include <utility>
+#include <vector>
+
+//Edits with the HEXDATA::fPieceTable must not touch the original data until the CommitData call.
+namespace TestHexCtrl {
+	//Sets the original data to the HexCtrl, and XORs a few spans of it through the piece table.
+	//Returns the HexCtrl, and the data as it must look after the edits.
+	inline auto SetAndEditPieceData(std::vector<std::byte>& vecOrig) -> std::pair<IHexCtrl*, std::vector<std::byte>> {
+		CreateRandomTestData();
+		vecOrig.assign(GetDataReference(), GetDataReference() + GetTestDataSize());
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecOrig.data(), vecOrig.size() }, .fMutable { true },
+			.fPieceTable { true } });
+
+		auto vecEdited = vecOrig;
+		constexpr std::uint8_t u8Key { 0x5A };
+		for (const auto& hs : { HEXSPAN { 0, 16 }, HEXSPAN { 100, 77 }, HEXSPAN { 400, 77 } }) {
+			pHex->ModifyData({ .eModifyMode { MODIFY_OPERATION }, .eOperMode { OPER_XOR }, .eDataType { DATA_UINT8 },
+				.spnData { reinterpret_cast<const std::byte*>(&u8Key), sizeof(u8Key) }, .vecSpan { hs } });
+			for (auto ullOffset = hs.ullOffset; ullOffset < hs.ullOffset + hs.ullSize; ++ullOffset) {
+				vecEdited[static_cast<std::size_t>(ullOffset)] ^= static_cast<std::byte>(u8Key);
+			}
+		}
+
+		return { pHex, vecEdited };
+	}
+
+	inline void ComparePieceData(const IHexCtrl* pHex, const std::vector<std::byte>& vecExpected) {
+		const auto spnData = pHex->GetData({ 0, vecExpected.size() });
+		Assert::IsTrue(spnData.size() == vecExpected.size());
+		Assert::IsTrue(std::memcmp(vecExpected.data(), spnData.data(), vecExpected.size()) == 0);
+	}
+
+	TEST_CLASS(CPieceTable) {
+public:
+	TEST_METHOD(EditKeepsOriginal) {
+		std::vector<std::byte> vecOrig;
+		const auto [pHex, vecEdited] = SetAndEditPieceData(vecOrig);
+		Assert::IsTrue(std::memcmp(vecOrig.data(), GetDataReference(), GetTestDataSize()) == 0);
+		ComparePieceData(pHex, vecEdited);
+	}
+	TEST_METHOD(UndoRedo) {
+		std::vector<std::byte> vecOrig;
+		const auto [pHex, vecEdited] = SetAndEditPieceData(vecOrig);
+		for (auto i { 0 }; i < 3; ++i) {
+			Assert::IsTrue(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_UNDO));
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_UNDO);
+		}
+		Assert::IsFalse(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_UNDO));
+		ComparePieceData(pHex, vecOrig);
+
+		for (auto i { 0 }; i < 3; ++i) {
+			Assert::IsTrue(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_REDO));
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_REDO);
+		}
+		Assert::IsFalse(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_REDO));
+		ComparePieceData(pHex, vecEdited);
+	}
+	TEST_METHOD(Commit) {
+		std::vector<std::byte> vecOrig;
+		const auto [pHex, vecEdited] = SetAndEditPieceData(vecOrig);
+		pHex->CommitData();
+		Assert::IsTrue(vecOrig == vecEdited);
+		ComparePieceData(pHex, vecEdited);
+	}
+	TEST_METHOD(InsertRemove) {
+		std::vector<std::byte> vecOrig;
+		auto [pHex, vecEdited] = SetAndEditPieceData(vecOrig);
+		const auto vecBefore = vecEdited;
+		const auto pBkms = pHex->GetBookmarks();
+		const auto ullBkmID = pBkms->AddBkm({ .vecSpan { HEXSPAN { 300, 4 } } });
+
+		//Spans are in the offsets before the insertion, the inserted bytes are the spnData repeated.
+		const std::byte arrIns[] { std::byte { 0xAB }, std::byte { 0xCD } };
+		pHex->ModifyData({ .eModifyMode { MODIFY_INSERT }, .spnData { arrIns }, .vecSpan { { 200, 3 }, { 0, 10 } } });
+		vecEdited.insert(vecEdited.begin() + 200, { arrIns[0], arrIns[1], arrIns[0] });
+		vecEdited.insert(vecEdited.begin(), { arrIns[0], arrIns[1], arrIns[0], arrIns[1], arrIns[0], arrIns[1],
+			arrIns[0], arrIns[1], arrIns[0], arrIns[1] });
+		Assert::IsTrue(pHex->GetDataSize() == vecEdited.size());
+		ComparePieceData(pHex, vecEdited);
+		Assert::IsTrue(pBkms->GetByID(ullBkmID)->vecSpan[0].ullOffset == 313);
+		Assert::IsTrue(std::memcmp(vecOrig.data(), GetDataReference(), GetTestDataSize()) == 0);
+
+		pHex->ModifyData({ .eModifyMode { MODIFY_REMOVE }, .vecSpan { { 0, 10 }, { 210, 3 } } });
+		ComparePieceData(pHex, vecBefore);
+		Assert::IsTrue(pBkms->GetByID(ullBkmID)->vecSpan[0].ullOffset == 300);
+
+		pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_UNDO);
+		ComparePieceData(pHex, vecEdited);
+		Assert::IsTrue(pBkms->GetByID(ullBkmID)->vecSpan[0].ullOffset == 313);
+	}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,319 @@
+#include "CHexCtrlInit.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+//Search kernels are checked against the naive search.
+//In the Release builds the SEARCH_ALL throughput is also written to the tests output, the vectorized kernels that are
+//measured are the ones the HexCtrl picks on this CPU, or the HEXCTRL_FORCE_AVX1/HEXCTRL_FORCE_AVX2 it's built with.
+namespace TestHexCtrl {
+	[[nodiscard]] consteval auto GetBenchDataSize() {
+		return 8UL * 1024UL * 1024UL + 477UL; //Size deliberately not equal to power of two.
+	}
+
+	[[nodiscard]] inline auto GetBenchData() -> std::vector<std::byte>& {
+		static std::vector<std::byte> vecData(GetBenchDataSize());
+		return vecData;
+	}
+
+	[[nodiscard]] inline auto CreateBenchData(bool fText) -> IHexCtrl* {
+		auto& vecData = GetBenchData();
+		if (fText) { //Real-world-like data: text of the mixed case words, with some binary zeros in-between.
+			constexpr std::string_view arrWords[] { "HexCtrl ", "search ", "Kernel ", "DATA ", "offset ", "0x7FF96BA6 ",
+				"Virtual ", "mode ", "the ", "of ", "\r\n", { "\0\0\0\0", 4 } };
+			std::uniform_int_distribution<std::size_t> distWord(0, std::size(arrWords) - 1);
+			for (std::size_t uzOffset { 0 }; uzOffset < vecData.size();) {
+				const auto svWord = arrWords[distWord(GetMT19937())];
+				const auto uzSize = (std::min)(svWord.size(), vecData.size() - uzOffset);
+				std::memcpy(vecData.data() + uzOffset, svWord.data(), uzSize);
+				uzOffset += uzSize;
+			}
+		}
+		else {
+			std::uniform_int_distribution<std::uint64_t> distInt(0, (std::numeric_limits<std::uint64_t>::max)());
+			for (std::size_t uzOffset { 0 }; uzOffset < vecData.size(); uzOffset += sizeof(std::uint64_t)) {
+				const auto u64Data = distInt(GetMT19937());
+				std::memcpy(vecData.data() + uzOffset, &u64Data, (std::min)(sizeof(u64Data), vecData.size() - uzOffset));
+			}
+		}
+
+		return GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() } });
+	}
+
+	//Copies of the data at the random offsets, so that there is something to find in the random data too.
+	inline void PlantBenchData(std::span<const std::byte> spnFind) {
+		auto& vecData = GetBenchData();
+		std::uniform_int_distribution<std::size_t> distOffset(0, vecData.size() - spnFind.size());
+		for (auto i { 0 }; i < 100; ++i) {
+			std::memcpy(vecData.data() + distOffset(GetMT19937()), spnFind.data(), spnFind.size());
+		}
+	}
+
+	template<typename T>
+	[[nodiscard]] bool IsInRangeNaive(const std::byte* pData, const HEXSEARCH& hss) {
+		T tData; T tFrom; T tTo;
+		std::memcpy(&tData, pData, sizeof(T));
+		std::memcpy(&tFrom, hss.spnFind.data(), sizeof(T));
+		std::memcpy(&tTo, hss.spnFindTo.data(), sizeof(T));
+		return tData >= tFrom && tData <= tTo;
+	}
+
+	[[nodiscard]] inline bool IsMatchNaive(const std::byte* pData, const HEXSEARCH& hss) {
+		if (!hss.spnFindTo.empty()) {
+			switch (hss.eSearchType) {
+			case EHexSearchType::NUM_UINT8: return IsInRangeNaive<std::uint8_t>(pData, hss);
+			case EHexSearchType::NUM_INT16: return IsInRangeNaive<std::int16_t>(pData, hss);
+			case EHexSearchType::NUM_INT32: return IsInRangeNaive<std::int32_t>(pData, hss);
+			case EHexSearchType::NUM_UINT64: return IsInRangeNaive<std::uint64_t>(pData, hss);
+			case EHexSearchType::NUM_DOUBLE: return IsInRangeNaive<double>(pData, hss);
+			default: Assert::Fail(L"Numbers range type is not supported by the naive search.");
+			}
+		}
+
+		const auto lmbLower = [](std::byte byte) {
+			const auto ch = static_cast<char>(byte);
+			return (ch >= 'A' && ch <= 'Z') ? static_cast<std::byte>(ch + 32) : byte; };
+		bool fMatch { true };
+		for (std::size_t i { 0 }; i < hss.spnFind.size(); ++i) {
+			const auto byteFind = hss.spnFind[i];
+			if (hss.fWildcard && byteFind == hss.bWildcard)
+				continue;
+
+			if (hss.fMatchCase ? pData[i] != byteFind : lmbLower(pData[i]) != lmbLower(byteFind)) {
+				fMatch = false;
+				break;
+			}
+		}
+
+		return fMatch != hss.fInverted;
+	}
+
+	struct BENCHRESULT {
+		ULONGLONG ullCount { };
+		ULONGLONG ullSum { };   //Sum of all found offsets, to check the offsets along with their count.
+		ULONGLONG ullFirst { }; //First found offset, for the SEARCH_FORWARD and SEARCH_BACKWARD modes.
+	};
+
+	class CBenchResult final : public IHexSearchResult {
+	public:
+		bool OnHexSearchResult(std::span<const ULONGLONG> spnOffsets, [[maybe_unused]] std::span<const DWORD> spnPatterns)override {
+			if (m_stRes.ullCount == 0 && !spnOffsets.empty()) {
+				m_stRes.ullFirst = spnOffsets.front();
+			}
+
+			for (const auto ullOffset : spnOffsets) {
+				m_stRes.ullSum += ullOffset;
+			}
+			m_stRes.ullCount += spnOffsets.size();
+			return true;
+		}
+		[[nodiscard]] auto GetResult()const -> BENCHRESULT { return m_stRes; }
+	private:
+		BENCHRESULT m_stRes;
+	};
+
+	[[nodiscard]] inline auto GetBenchRngSize(const HEXSEARCH& hss) -> ULONGLONG {
+		return hss.stRange.ullSize > 0 ? hss.stRange.ullSize : static_cast<ULONGLONG>(GetBenchData().size());
+	}
+
+	[[nodiscard]] inline auto SearchNaive(const HEXSEARCH& hss) -> BENCHRESULT {
+		const auto& vecData = GetBenchData();
+		const auto ullRngStart = hss.stRange.ullOffset;
+		const auto ullLastOffset = ullRngStart + GetBenchRngSize(hss) - hss.spnFind.size();
+		BENCHRESULT stRes;
+		if (hss.eSearchMode == EHexSearchMode::SEARCH_BACKWARD) {
+			for (auto ullOffset = hss.ullStartFrom; ; ullOffset -= hss.ullStep) {
+				if (IsMatchNaive(vecData.data() + ullOffset, hss)) {
+					stRes = { .ullCount { 1 }, .ullSum { ullOffset }, .ullFirst { ullOffset } };
+					break;
+				}
+				if (ullOffset < ullRngStart + hss.ullStep)
+					break;
+			}
+			return stRes;
+		}
+
+		for (auto ullOffset = hss.ullStartFrom; ullOffset <= ullLastOffset; ullOffset += hss.ullStep) {
+			if (!IsMatchNaive(vecData.data() + ullOffset, hss))
+				continue;
+
+			if (stRes.ullCount == 0) {
+				stRes.ullFirst = ullOffset;
+			}
+			++stRes.ullCount;
+			stRes.ullSum += ullOffset;
+			if (hss.eSearchMode == EHexSearchMode::SEARCH_FORWARD)
+				break;
+		}
+
+		return stRes;
+	}
+
+	//Searches with the HexCtrl, and compares with the naive search.
+	inline void SearchAndCompare(IHexCtrl* pHex, std::wstring_view wsvName, HEXSEARCH hss) {
+		CBenchResult stBenchRes;
+		hss.pHexSearchRes = &stBenchRes;
+		hss.dwLimit = 0;   //No limit.
+		hss.dwThreads = 1; //The kernel itself, not the cores.
+		const auto ullFound = pHex->Search(hss);
+
+		const auto stRes = stBenchRes.GetResult();
+		const auto stResNaive = SearchNaive(hss);
+		const auto wstrName = std::format(L"{}, size {}", wsvName, hss.spnFind.size());
+		Assert::AreEqual(stResNaive.ullCount, ullFound, wstrName.data());
+		Assert::AreEqual(stResNaive.ullCount, stRes.ullCount, wstrName.data());
+		Assert::AreEqual(stResNaive.ullSum, stRes.ullSum, wstrName.data());
+		Assert::AreEqual(stResNaive.ullFirst, stRes.ullFirst, wstrName.data());
+	}
+
+#ifndef _DEBUG
+	//Writes the SEARCH_ALL throughput, the best of a few runs, the Debug builds' numbers are meaningless.
+	inline void SearchThroughput(IHexCtrl* pHex, std::wstring_view wsvName, HEXSEARCH hss) {
+		hss.dwLimit = 0;   //No limit.
+		hss.dwThreads = 1; //The kernel itself, not the cores.
+		hss.eSearchMode = EHexSearchMode::SEARCH_ALL;
+		auto dblSeconds = (std::numeric_limits<double>::max)();
+		ULONGLONG ullFound { };
+		for (auto i { 0 }; i < 3; ++i) {
+			const auto tpStart = std::chrono::steady_clock::now();
+			ullFound = pHex->Search(hss);
+			dblSeconds = (std::min)(dblSeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count());
+		}
+
+		const auto dblGBps = static_cast<double>(GetBenchRngSize(hss)) / (std::max)(dblSeconds, 1e-9) / (1024. * 1024. * 1024.);
+		Logger::WriteMessage(std::format(L"{}, size {}: {:.2f} GB/s, found {}.\n", wsvName, hss.spnFind.size(),
+			dblGBps, ullFound).data());
+	}
+#endif //^^^ !_DEBUG
+
+	//Search data that is taken from the data itself, and planted throughout it.
+	[[nodiscard]] inline auto GetBenchFind(std::size_t uzSize) -> std::vector<std::byte> {
+		const auto& vecData = GetBenchData();
+		std::uniform_int_distribution<std::size_t> distOffset(0, vecData.size() - uzSize);
+		const auto itFind = vecData.begin() + static_cast<std::ptrdiff_t>(distOffset(GetMT19937()));
+		std::vector<std::byte> vecFind(itFind, itFind + static_cast<std::ptrdiff_t>(uzSize));
+		PlantBenchData(vecFind);
+		return vecFind;
+	}
+
+	constexpr std::size_t arrBenchSizes[] { 1, 2, 4, 8, 16, 64, 256 };
+
+	TEST_CLASS(CSearchBench) {
+public:
+	TEST_METHOD(HexBytesRandom) {
+		const auto pHex = CreateBenchData(false);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"HEXBYTES random", { .spnFind { vecFind }, .eSearchMode { EHexSearchMode::SEARCH_ALL } });
+		}
+	}
+	TEST_METHOD(HexBytesText) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"HEXBYTES text", { .spnFind { vecFind }, .eSearchMode { EHexSearchMode::SEARCH_ALL } });
+		}
+	}
+	TEST_METHOD(TextMatchCase) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"TEXT_ASCII match case", { .spnFind { vecFind }, .eSearchMode { EHexSearchMode::SEARCH_ALL },
+				.eSearchType { EHexSearchType::TEXT_ASCII } });
+		}
+	}
+	TEST_METHOD(TextNoMatchCase) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"TEXT_ASCII no match case", { .spnFind { vecFind }, .eSearchMode { EHexSearchMode::SEARCH_ALL },
+				.eSearchType { EHexSearchType::TEXT_ASCII }, .fMatchCase { false } });
+		}
+	}
+	TEST_METHOD(Wildcard) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			auto vecFind = GetBenchFind(uzSize);
+			for (std::size_t i { 1 }; i < vecFind.size(); i += 3) {
+				vecFind[i] = std::byte { '?' };
+			}
+			SearchAndCompare(pHex, L"HEXBYTES wildcard", { .spnFind { vecFind }, .eSearchMode { EHexSearchMode::SEARCH_ALL },
+				.fWildcard { true } });
+		}
+	}
+	TEST_METHOD(Inverted) { //Almost every offset is found, so the range is smaller.
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"HEXBYTES inverted", { .spnFind { vecFind }, .stRange { .ullOffset { 0 },
+				.ullSize { 1024 * 1024 } }, .eSearchMode { EHexSearchMode::SEARCH_ALL }, .fInverted { true } });
+		}
+	}
+	TEST_METHOD(Step) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto ullStep : { 2ULL, 4ULL, 8ULL, 3000ULL }) {
+			for (const auto uzSize : arrBenchSizes) {
+				const auto vecFind = GetBenchFind(uzSize);
+				SearchAndCompare(pHex, std::format(L"HEXBYTES step {}", ullStep), { .spnFind { vecFind }, .ullStep { ullStep },
+					.eSearchMode { EHexSearchMode::SEARCH_ALL } });
+			}
+		}
+	}
+	TEST_METHOD(ForwardBackward) {
+		const auto pHex = CreateBenchData(false);
+		const auto ullLast = static_cast<ULONGLONG>(GetBenchDataSize() - 1);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchAndCompare(pHex, L"HEXBYTES forward", { .spnFind { vecFind }, .ullStartFrom { ullLast / 3 },
+				.eSearchMode { EHexSearchMode::SEARCH_FORWARD } });
+			SearchAndCompare(pHex, L"HEXBYTES backward", { .spnFind { vecFind }, .ullStartFrom { ullLast + 1 - uzSize },
+				.eSearchMode { EHexSearchMode::SEARCH_BACKWARD } });
+		}
+	}
+	TEST_METHOD(NumbersRange) {
+		const auto pHex = CreateBenchData(false);
+		const auto lmbRange = [pHex]<typename T>(EHexSearchType eType, T tFrom, T tTo, ULONGLONG ullStep) {
+			SearchAndCompare(pHex, L"Numbers range", { .spnFind { reinterpret_cast<const std::byte*>(&tFrom), sizeof(T) },
+				.spnFindTo { reinterpret_cast<const std::byte*>(&tTo), sizeof(T) }, .ullStep { ullStep },
+				.eSearchMode { EHexSearchMode::SEARCH_ALL }, .eSearchType { eType } });
+			};
+		lmbRange(EHexSearchType::NUM_UINT8, std::uint8_t { 0x10 }, std::uint8_t { 0x11 }, 1);
+		lmbRange(EHexSearchType::NUM_INT16, std::int16_t { -100 }, std::int16_t { 100 }, 1);
+		lmbRange(EHexSearchType::NUM_INT16, std::int16_t { -100 }, std::int16_t { 100 }, 2);
+		lmbRange(EHexSearchType::NUM_INT32, std::int32_t { -100'000 }, std::int32_t { 100'000 }, 1);
+		lmbRange(EHexSearchType::NUM_INT32, std::int32_t { -100'000 }, std::int32_t { 100'000 }, 4);
+		lmbRange(EHexSearchType::NUM_UINT64, std::uint64_t { 0 }, std::uint64_t { 0xFFFF'FFFF'FFFF }, 8);
+		lmbRange(EHexSearchType::NUM_DOUBLE, 1000.0, 2000.0, 1);
+	}
+	};
+
+#ifndef _DEBUG
+	TEST_CLASS(CSearchThroughput) {
+public:
+	TEST_METHOD(HexBytes) {
+		for (const auto fText : { false, true }) {
+			const auto pHex = CreateBenchData(fText);
+			for (const auto uzSize : arrBenchSizes) {
+				const auto vecFind = GetBenchFind(uzSize);
+				SearchThroughput(pHex, fText ? L"HEXBYTES text" : L"HEXBYTES random", { .spnFind { vecFind } });
+				SearchThroughput(pHex, fText ? L"HEXBYTES text wildcard" : L"HEXBYTES random wildcard",
+					{ .spnFind { vecFind }, .fWildcard { true } });
+			}
+		}
+	}
+	TEST_METHOD(Text) {
+		const auto pHex = CreateBenchData(true);
+		for (const auto uzSize : arrBenchSizes) {
+			const auto vecFind = GetBenchFind(uzSize);
+			SearchThroughput(pHex, L"TEXT_ASCII match case", { .spnFind { vecFind }, .eSearchType { EHexSearchType::TEXT_ASCII } });
+			SearchThroughput(pHex, L"TEXT_ASCII no match case", { .spnFind { vecFind },
+				.eSearchType { EHexSearchType::TEXT_ASCII }, .fMatchCase { false } });
+		}
+	}
+	};
+#endif //^^^ !_DEBUG
+}
\ No newline at end of file
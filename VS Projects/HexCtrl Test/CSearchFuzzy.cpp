@@ -0,0 +1,186 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+//Approximate search, of the Hamming distance and of the edit distance, is checked against the naive search:
+//the mismatches count at every offset on the step, and the dynamic programming edit distance, one match at a time.
+//The search data is planted with the random edits, across the cache chunks in the Virtual mode too.
+namespace TestHexCtrl {
+	//Only a few distinct bytes, so that the short search data is found often with a few errors.
+	constexpr std::string_view svFuzzyAlphabet { "\x00\x21\x42\x63\x84\xA5\xC6\xE7", 8 };
+
+	//Copies of the search data with the random substitutions, insertions and deletions, and the ones across the chunks.
+	inline void PlantFuzzyFind(std::vector<std::byte>& vecData, SpanCByte spnFind, DWORD dwMaxErrors, bool fEditDist) {
+		std::uniform_int_distribution<std::size_t> distOffset(0, vecData.size() - spnFind.size() - dwMaxErrors - 1);
+		std::uniform_int_distribution<std::size_t> distIdx(0, spnFind.size() - 1);
+		std::uniform_int_distribution<int> distEdit(0, fEditDist ? 2 : 0);
+		std::vector<std::size_t> vecOffsets;
+		for (auto i { 0 }; i < 100; ++i) {
+			vecOffsets.emplace_back(distOffset(GetMT19937()));
+		}
+		for (std::size_t uzChunk { 64 * 1024 }; uzChunk < vecData.size(); uzChunk += 64 * 1024) {
+			vecOffsets.emplace_back(uzChunk - spnFind.size() / 2);
+			vecOffsets.emplace_back(uzChunk - spnFind.size());
+		}
+		vecOffsets.emplace_back(vecData.size() - spnFind.size()); //Up to the data end.
+
+		for (std::size_t i { 0 }; i < vecOffsets.size(); ++i) {
+			std::vector<std::byte> vecPlant(spnFind.begin(), spnFind.end());
+			for (std::size_t uzEdit { 0 }; uzEdit < i % (dwMaxErrors + 2); ++uzEdit) { //Up to the dwMaxErrors + 1 edits.
+				const auto uzIdx = distIdx(GetMT19937()) % vecPlant.size();
+				switch (distEdit(GetMT19937())) {
+				case 0: //Substitution.
+					vecPlant[uzIdx] = ~vecPlant[uzIdx];
+					break;
+				case 1: //Insertion.
+					vecPlant.insert(vecPlant.begin() + static_cast<std::ptrdiff_t>(uzIdx), std::byte { 0x55 });
+					break;
+				default: //Deletion.
+					vecPlant.erase(vecPlant.begin() + static_cast<std::ptrdiff_t>(uzIdx));
+					break;
+				}
+			}
+			PlantSearchData(vecData, vecOffsets[i], vecPlant);
+		}
+	}
+
+	//Edit distance search by the dynamic programming, end offset by end offset: the least distances of the search data's
+	//prefixes to the data ending at the end offset, and starting anywhere past the previous match. Once the distance
+	//is no more than the dwMaxErrors, the match's end is moved on while it goes down. The match's start is the one on
+	//the step of the least distance, of the shortest data, no longer than the search data size + dwMaxErrors.
+	//The next match starts past the end of this one.
+	[[nodiscard]] inline auto SearchEditNaive(SpanCByte spnData, const HEXSEARCH& hss) -> VecSearchResult {
+		const auto uzSizeFind = hss.spnFind.size();
+		const auto dwAbove = hss.dwMaxErrors + 1;
+		std::vector<DWORD> vecCol(uzSizeFind + 1);
+		const auto lmbColumn = [&](std::vector<DWORD>& vecDist, DWORD dwTop, std::byte byte, bool fReversed) {
+			auto dwDiag = vecDist[0];
+			vecDist[0] = dwTop;
+			for (std::size_t i { 1 }; i <= uzSizeFind; ++i) {
+				const auto dwUp = vecDist[i];
+				const auto byteFind = fReversed ? hss.spnFind[uzSizeFind - i] : hss.spnFind[i - 1];
+				vecDist[i] = (std::min)({ dwDiag + (byteFind != byte ? 1UL : 0UL), dwUp + 1, vecDist[i - 1] + 1 });
+				dwDiag = dwUp;
+			}
+		};
+		std::iota(vecCol.begin(), vecCol.end(), 0UL);
+
+		ULONGLONG ullStartMin { hss.ullStartFrom };
+		ULONGLONG ullEndBest { };
+		auto dwDistBest = dwAbove;
+		const auto lmbReport = [&](VecSearchResult& vecRes) {
+			const auto uzSizeMax = static_cast<std::size_t>((std::min)(static_cast<ULONGLONG>(uzSizeFind) + hss.dwMaxErrors,
+				ullEndBest - ullStartMin + 1));
+			std::vector<DWORD> vecBack(uzSizeFind + 1); //Distances of the reversed search data's prefixes, backwards.
+			std::iota(vecBack.begin(), vecBack.end(), 0UL);
+			auto dwMin = dwAbove;
+			std::size_t uzSizeMatch { 0 };
+			for (std::size_t uzSize { 1 }; uzSize <= uzSizeMax; ++uzSize) {
+				const auto ullStart = ullEndBest + 1 - uzSize;
+				lmbColumn(vecBack, static_cast<DWORD>(uzSize), spnData[static_cast<std::size_t>(ullStart)], true);
+				if (vecBack[uzSizeFind] < dwMin && (ullStart - hss.ullStartFrom) % hss.ullStep == 0) {
+					dwMin = vecBack[uzSizeFind];
+					uzSizeMatch = uzSize;
+				}
+			}
+
+			dwDistBest = dwAbove;
+			if (uzSizeMatch == 0)
+				return false;
+
+			vecRes.emplace_back(ullEndBest + 1 - uzSizeMatch, static_cast<DWORD>(uzSizeMatch));
+			ullStartMin = ullEndBest + 1;
+			return true;
+		};
+
+		auto hssEnds = hss;
+		hssEnds.ullStep = 1; //All the end offsets.
+		auto vecResAll = SearchNaiveOffsets(spnData, hssEnds, [&](ULONGLONG ullEnd, ULONGLONG ullRngEnd, VecSearchResult& vecRes) {
+			const auto byte = spnData[static_cast<std::size_t>(ullEnd)];
+			lmbColumn(vecCol, 0, byte, false);
+			if (vecCol[uzSizeFind] < dwDistBest) {
+				ullEndBest = ullEnd;
+				dwDistBest = vecCol[uzSizeFind];
+			}
+			else if (dwDistBest < dwAbove) {
+				if (lmbReport(vecRes)) {
+					std::iota(vecCol.begin(), vecCol.end(), 0UL);
+					lmbColumn(vecCol, 0, byte, false);
+				}
+				if (vecCol[uzSizeFind] < dwAbove) {
+					ullEndBest = ullEnd;
+					dwDistBest = vecCol[uzSizeFind];
+				}
+			}
+
+			if (ullEnd == ullRngEnd && dwDistBest < dwAbove) {
+				lmbReport(vecRes);
+			} });
+
+		if (hss.eSearchMode != EHexSearchMode::SEARCH_ALL && vecResAll.size() > 1) { //The match up to the range end too.
+			vecResAll.resize(1);
+		}
+
+		return vecResAll;
+	}
+
+	[[nodiscard]] inline auto SearchFuzzyNaive(SpanCByte spnData, const HEXSEARCH& hss) -> VecSearchResult {
+		if (hss.fEditDist)
+			return SearchEditNaive(spnData, hss);
+
+		const auto uzSizeFind = hss.spnFind.size();
+		return SearchNaiveOffsets(spnData, hss, [&](ULONGLONG ullOffset, ULONGLONG ullRngEnd, VecSearchResult& vecRes) {
+			if (ullOffset + uzSizeFind > ullRngEnd + 1)
+				return;
+
+			const auto pData = spnData.data() + ullOffset;
+			const auto uzErrors = std::inner_product(pData, pData + uzSizeFind, hss.spnFind.data(), std::size_t { 0 },
+				std::plus { }, std::not_equal_to { });
+			if (uzErrors <= hss.dwMaxErrors) {
+				vecRes.emplace_back(ullOffset, static_cast<DWORD>(uzSizeFind));
+			} });
+	}
+
+	//Search data of the one and of the two Myers' words sizes, with up to four errors, planted into the data.
+	inline void SearchFuzzyAll(bool fVirtual, bool fEditDist) {
+		for (const auto uzSizeFind : { 8U, 16U, 70U }) {
+			for (const auto dwMaxErrors : { 1UL, 2UL, 4UL }) {
+				auto vecData = CreateSearchData(160 * 1024 + 477, svFuzzyAlphabet);
+				const auto vecFind = CreateSearchData(uzSizeFind, svFuzzyAlphabet);
+				PlantFuzzyFind(vecData, vecFind, dwMaxErrors, fEditDist);
+
+				CTestVirtData stVirtData(vecData);
+				const auto pHex = GetSearchHexCtrl(vecData, fVirtual ? &stVirtData : nullptr);
+				const auto ullSize = static_cast<ULONGLONG>(vecData.size());
+				const HEXSEARCH hss { .spnFind { vecFind }, .dwLimit { 0 }, .dwMaxErrors { dwMaxErrors },
+					.eSearchMode { EHexSearchMode::SEARCH_ALL }, .fEditDist { fEditDist } };
+				for (const auto& hssCase : GetSearchCases(hss, ullSize, { 1, 3, 4 }, { 0, 64 * 1024 - 100, ullSize - 100 })) {
+					SearchAndCompareNaive(pHex, hssCase, SearchFuzzyNaive(vecData, hssCase),
+						std::format(L"{}, size {}, errors {}", fEditDist ? L"edit" : L"Hamming", uzSizeFind, dwMaxErrors));
+				}
+			}
+		}
+	}
+
+	TEST_CLASS(CSearchFuzzy) {
+public:
+	TEST_METHOD(Hamming) {
+		SearchFuzzyAll(false, false);
+	}
+	TEST_METHOD(HammingVirtual) {
+		SearchFuzzyAll(true, false);
+	}
+	TEST_METHOD(EditDist) {
+		SearchFuzzyAll(false, true);
+	}
+	TEST_METHOD(EditDistVirtual) {
+		SearchFuzzyAll(true, true);
+	}
+	};
+}
\ No newline at end of file
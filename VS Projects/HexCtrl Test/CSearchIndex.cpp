@@ -0,0 +1,99 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+//Search index is checked against the naive search, for the SEARCH_FORWARD and SEARCH_BACKWARD modes,
+//while the index is being built, and when it's built. The data is of only two distinct bytes, so that the blocks'
+//filters are sparse and most of the blocks are skipped, and the search data is planted across the blocks' edges.
+namespace TestHexCtrl {
+	[[nodiscard]] consteval auto GetIndexBlockSize() {
+		return 1024ULL * 1024ULL; //The same as the HexCtrl's search index block size.
+	}
+
+	[[nodiscard]] consteval auto GetIndexDataSize() {
+		return 6UL * 1024UL * 1024UL + 477UL;
+	}
+
+	struct INDEXFIND {
+		std::string_view       svFind;
+		std::vector<ULONGLONG> vecOffsets; //Offsets the search data is planted at.
+	};
+
+	[[nodiscard]] inline auto GetIndexFinds() -> const std::vector<INDEXFIND>& {
+		constexpr auto ullBlock = GetIndexBlockSize();
+		static const std::vector<INDEXFIND> vecFinds {
+			{ "HexCtrl search index", { 0, 2 * ullBlock - 10, 4 * ullBlock, 5 * ullBlock - 1, GetIndexDataSize() - 20 } },
+			{ "HexCtrl search indeX", { 3 * ullBlock + 500 } }, //Almost the same trigrams as the first one.
+			{ "\xCC\xDD\xEE", { ullBlock + 1000, 3 * ullBlock - 2, 3 * ullBlock - 1 } } }; //The shortest one for the index.
+		return vecFinds;
+	}
+
+	[[nodiscard]] inline auto CreateIndexData() -> std::vector<std::byte> {
+		auto vecData = CreateSearchData(GetIndexDataSize(), { "\x00\x01", 2 });
+		for (const auto& stFind : GetIndexFinds()) {
+			for (const auto ullOffset : stFind.vecOffsets) {
+				PlantSearchData(vecData, static_cast<std::size_t>(ullOffset), GetSearchSpan(stFind.svFind));
+			}
+		}
+
+		return vecData;
+	}
+
+	//Forward and backward searches from the range edges, and from around every planted occurrence.
+	inline void SearchIndexAll(IHexCtrl* pHex, SpanCByte spnData, const HEXSPAN& stRange = { }) {
+		const auto ullRngStart = GetSearchRngStart({ .stRange { stRange } });
+		const auto ullRngEnd = GetSearchRngEnd(spnData, { .stRange { stRange } });
+		for (const auto& stFind : GetIndexFinds()) {
+			const auto spnFind = GetSearchSpan(stFind.svFind);
+			const auto ullLastOffset = ullRngEnd + 1 - spnFind.size();
+			std::vector<ULONGLONG> vecStarts { ullRngStart, ullLastOffset };
+			for (const auto ullOffset : stFind.vecOffsets) {
+				vecStarts.insert(vecStarts.end(), { ullOffset - 1, ullOffset, ullOffset + 1 });
+			}
+
+			for (const auto ullStartFrom : vecStarts) {
+				if (ullStartFrom < ullRngStart || ullStartFrom > ullLastOffset)
+					continue;
+
+				for (const auto ullStep : { 1ULL, 3ULL }) {
+					for (const auto eMode : { EHexSearchMode::SEARCH_FORWARD, EHexSearchMode::SEARCH_BACKWARD }) {
+						const HEXSEARCH hss { .spnFind { spnFind }, .stRange { stRange }, .ullStartFrom { ullStartFrom },
+							.ullStep { ullStep }, .eSearchMode { eMode } };
+						SearchAndCompareNaive(pHex, hss, SearchExactNaive(spnData, hss));
+					}
+				}
+			}
+		}
+	}
+
+	TEST_CLASS(CSearchIndex) {
+public:
+	TEST_METHOD(ForwardBackward) {
+		auto vecData = CreateIndexData();
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .fSearchIndex { true } });
+		SearchIndexAll(pHex, vecData); //The index is being built meanwhile.
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		SearchIndexAll(pHex, vecData);
+		SearchIndexAll(pHex, vecData, { .ullOffset { GetIndexBlockSize() + 5 }, .ullSize { 3 * GetIndexBlockSize() } });
+	}
+	TEST_METHOD(ModifyData) {
+		auto vecData = CreateIndexData();
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .fMutable { true },
+			.fSearchIndex { true } });
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		SearchIndexAll(pHex, vecData);
+
+		//Search data in the block it wasn't in, the index of the data before the modification is of no use anymore.
+		const auto spnFind = GetSearchSpan(GetIndexFinds().front().svFind);
+		pHex->ModifyData({ .eModifyMode { MODIFY_ONCE }, .spnData { spnFind },
+			.vecSpan { { 3 * GetIndexBlockSize() + 100, spnFind.size() } } });
+		SearchIndexAll(pHex, vecData);
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		SearchIndexAll(pHex, vecData);
+	}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+#include "CHexCtrlInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+//Search tests' data, and the comparison of the HexCtrl's search results with the naive search.
+namespace TestHexCtrl {
+	using VecSearchResult = std::vector<std::pair<ULONGLONG, DWORD>>; //Offsets, with their patterns' indexes or sizes.
+
+	//Virtual data over the given data, every OnHexGetData gets the copy of only the requested span,
+	//so that the reads beyond the requested span are not masked by the rest of the data.
+	class CTestVirtData final : public IHexVirtData {
+	public:
+		explicit CTestVirtData(SpanCByte spnData) : m_spnData(spnData) { }
+		void OnHexGetData(HEXDATAINFO& hdi)override {
+			const auto spnSpan = m_spnData.subspan(static_cast<std::size_t>(hdi.stHexSpan.ullOffset),
+				static_cast<std::size_t>(hdi.stHexSpan.ullSize));
+			m_vecSpan.assign(spnSpan.begin(), spnSpan.end());
+			hdi.spnData = m_vecSpan;
+		}
+		void OnHexGetOffset([[maybe_unused]] HEXDATAINFO& hdi, [[maybe_unused]] bool fGetVirt)override { }
+		void OnHexSetData([[maybe_unused]] const HEXDATAINFO& hdi)override { }
+	private:
+		SpanCByte m_spnData;
+		std::vector<std::byte> m_vecSpan;
+	};
+
+	//Search results receiver that keeps all the found offsets, with their patterns' indexes or sizes.
+	class CTestSearchResult final : public IHexSearchResult {
+	public:
+		bool OnHexSearchResult(std::span<const ULONGLONG> spnOffsets, std::span<const DWORD> spnPatterns)override {
+			m_vecOffsets.insert(m_vecOffsets.end(), spnOffsets.begin(), spnOffsets.end());
+			m_vecPatterns.insert(m_vecPatterns.end(), spnPatterns.begin(), spnPatterns.end());
+			return true;
+		}
+		[[nodiscard]] auto GetOffsets()const -> const std::vector<ULONGLONG>& { return m_vecOffsets; }
+		[[nodiscard]] auto GetPatterns()const -> const std::vector<DWORD>& { return m_vecPatterns; }
+	private:
+		std::vector<ULONGLONG> m_vecOffsets;
+		std::vector<DWORD> m_vecPatterns;
+	};
+
+	[[nodiscard]] inline auto GetSearchSpan(std::string_view sv) -> SpanCByte {
+		return { reinterpret_cast<const std::byte*>(sv.data()), sv.size() };
+	}
+
+	//Random data of the bytes from the svAlphabet, of any bytes if it's empty.
+	[[nodiscard]] inline auto CreateSearchData(std::size_t uzSize, std::string_view svAlphabet = { }) -> std::vector<std::byte> {
+		std::vector<std::byte> vecData(uzSize);
+		std::uniform_int_distribution<std::size_t> distIdx(0, svAlphabet.empty() ? 0xFF : svAlphabet.size() - 1);
+		std::generate(vecData.begin(), vecData.end(), [&]() {
+			const auto uzIdx = distIdx(GetMT19937());
+			return static_cast<std::byte>(svAlphabet.empty() ? uzIdx : static_cast<unsigned char>(svAlphabet[uzIdx])); });
+		return vecData;
+	}
+
+	//Copies the spnPlant to the data at the uzOffset, cut at the data end.
+	inline void PlantSearchData(std::vector<std::byte>& vecData, std::size_t uzOffset, SpanCByte spnPlant) {
+		std::memcpy(vecData.data() + uzOffset, spnPlant.data(), (std::min)(spnPlant.size(), vecData.size() - uzOffset));
+	}
+
+	[[nodiscard]] inline auto GetSearchRngStart(const HEXSEARCH& hss) -> ULONGLONG {
+		return hss.stRange.ullSize > 0 ? hss.stRange.ullOffset : 0ULL;
+	}
+
+	[[nodiscard]] inline auto GetSearchRngEnd(SpanCByte spnData, const HEXSEARCH& hss) -> ULONGLONG {
+		return hss.stRange.ullSize > 0 ? hss.stRange.ullOffset + hss.stRange.ullSize - 1 : spnData.size() - 1;
+	}
+
+	//Naive search, offset by offset on the step from the hss.ullStartFrom, in the hss.eSearchMode direction, up to
+	//the hss.dwLimit in the SEARCH_ALL mode. The lmbMatch(ullOffset, ullRngEnd, vecRes) adds the matches at the ullOffset.
+	template<typename TMatch>
+	[[nodiscard]] auto SearchNaiveOffsets(SpanCByte spnData, const HEXSEARCH& hss, TMatch lmbMatch) -> VecSearchResult {
+		const auto ullRngStart = GetSearchRngStart(hss);
+		const auto ullRngEnd = GetSearchRngEnd(spnData, hss);
+		VecSearchResult vecRes;
+		const auto lmbDone = [&]() {
+			return hss.eSearchMode == EHexSearchMode::SEARCH_ALL ? hss.dwLimit > 0 && vecRes.size() >= hss.dwLimit
+				: !vecRes.empty(); };
+
+		if (hss.eSearchMode == EHexSearchMode::SEARCH_BACKWARD) {
+			for (auto ullOffset = hss.ullStartFrom; !lmbDone(); ullOffset -= hss.ullStep) {
+				lmbMatch(ullOffset, ullRngEnd, vecRes);
+				if (ullOffset < ullRngStart + hss.ullStep)
+					break;
+			}
+		}
+		else {
+			for (auto ullOffset = hss.ullStartFrom; ullOffset <= ullRngEnd && !lmbDone(); ullOffset += hss.ullStep) {
+				lmbMatch(ullOffset, ullRngEnd, vecRes);
+			}
+		}
+
+		if (hss.eSearchMode == EHexSearchMode::SEARCH_ALL && hss.dwLimit > 0 && vecRes.size() > hss.dwLimit) {
+			vecRes.resize(hss.dwLimit);
+		}
+
+		return vecRes;
+	}
+
+	//Naive search of the hss.spnFind as is, the patterns are 0, as the HexCtrl reports none.
+	[[nodiscard]] inline auto SearchExactNaive(SpanCByte spnData, const HEXSEARCH& hss) -> VecSearchResult {
+		const auto pData = spnData.data();
+		const auto pFind = hss.spnFind.data();
+		const auto uzSizeFind = hss.spnFind.size();
+		return SearchNaiveOffsets(spnData, hss, [=](ULONGLONG ullOffset, ULONGLONG ullRngEnd, VecSearchResult& vecRes) {
+			//The first byte is mostly not the one, it's quicker that way.
+			if (ullOffset + uzSizeFind <= ullRngEnd + 1 && pData[ullOffset] == pFind[0]
+				&& std::memcmp(pData + ullOffset, pFind, uzSizeFind) == 0) {
+				vecRes.emplace_back(ullOffset, 0);
+			} });
+	}
+
+	[[nodiscard]] inline auto GetSearchName(const HEXSEARCH& hss) -> std::wstring {
+		constexpr const wchar_t* arrModes[] { L"forward", L"backward", L"all" };
+		return std::format(L"{}, start {}, step {}, range {}/{}, limit {}", arrModes[static_cast<std::size_t>(hss.eSearchMode)],
+			hss.ullStartFrom, hss.ullStep, hss.stRange.ullOffset, hss.stRange.ullSize, hss.dwLimit);
+	}
+
+	//Searches with the HexCtrl, its results are checked to be as many as it has found.
+	[[nodiscard]] inline auto SearchHexCtrl(IHexCtrl* pHex, HEXSEARCH hss, const std::wstring& wstrName) -> VecSearchResult {
+		CTestSearchResult stRes;
+		hss.pHexSearchRes = &stRes;
+		const auto ullFound = pHex->Search(hss);
+
+		const auto& vecOffsets = stRes.GetOffsets();
+		const auto& vecPatterns = stRes.GetPatterns();
+		Assert::AreEqual(static_cast<ULONGLONG>(vecOffsets.size()), ullFound, wstrName.data());
+		Assert::IsTrue(vecPatterns.empty() || vecPatterns.size() == vecOffsets.size(), wstrName.data());
+
+		VecSearchResult vecRes;
+		for (std::size_t i { 0 }; i < vecOffsets.size(); ++i) {
+			vecRes.emplace_back(vecOffsets[i], vecPatterns.empty() ? 0 : vecPatterns[i]);
+		}
+
+		return vecRes;
+	}
+
+	//Searches with the HexCtrl, and compares with the naive search's results.
+	inline void SearchAndCompareNaive(IHexCtrl* pHex, const HEXSEARCH& hss, const VecSearchResult& vecResNaive,
+		std::wstring_view wsvName = { }) {
+		const auto wstrName = std::format(L"{} {}", wsvName, GetSearchName(hss));
+		Assert::IsTrue(SearchHexCtrl(pHex, hss, wstrName) == vecResNaive, wstrName.data());
+	}
+
+	//Searches of the whole data and of a range, on every step, in the hss.eSearchMode,
+	//and the SEARCH_FORWARD ones from every start of the ilStartsFwd.
+	[[nodiscard]] inline auto GetSearchCases(const HEXSEARCH& hss, ULONGLONG ullDataSize, std::initializer_list<ULONGLONG> ilSteps,
+		std::initializer_list<ULONGLONG> ilStartsFwd = { }) -> std::vector<HEXSEARCH> {
+		std::vector<HEXSEARCH> vecCases;
+		for (const auto ullStep : ilSteps) {
+			auto hssStep = hss;
+			hssStep.ullStep = ullStep;
+			vecCases.emplace_back(hssStep);
+
+			auto hssRng = hssStep;
+			hssRng.stRange = { .ullOffset { 1000 }, .ullSize { ullDataSize - 5000 } };
+			hssRng.ullStartFrom = 1007;
+			vecCases.emplace_back(hssRng);
+
+			auto hssFwd = hssStep;
+			hssFwd.eSearchMode = EHexSearchMode::SEARCH_FORWARD;
+			for (const auto ullStartFrom : ilStartsFwd) {
+				hssFwd.ullStartFrom = ullStartFrom;
+				vecCases.emplace_back(hssFwd);
+			}
+		}
+
+		return vecCases;
+	}
+
+	//HexCtrl with the data in the default mode, or in the Virtual mode with the minimal cache,
+	//so that the search goes across the cache chunks.
+	[[nodiscard]] inline auto GetSearchHexCtrl(std::vector<std::byte>& vecData, CTestVirtData* pVirtData = nullptr) -> IHexCtrl* {
+		if (pVirtData == nullptr) {
+			return GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() } });
+		}
+
+		return GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .pHexVirtData { pVirtData },
+			.dwCacheSize { 64UL * 1024UL } });
+	}
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <format>
+#include <string_view>
+#include <vector>
+
+//Multi-pattern search is checked against the naive search of every pattern at every offset,
+//in the default data mode and in the Virtual mode, where the patterns' occurrences straddle the cache chunks.
+namespace TestHexCtrl {
+	//Patterns taken from the data itself, along with their prefixes and suffixes, and the ones that likely aren't there.
+	[[nodiscard]] inline auto CreateMultiPatterns(SpanCByte spnData) -> std::vector<std::vector<std::byte>> {
+		std::uniform_int_distribution<std::size_t> distSize(1, 12);
+		std::uniform_int_distribution<std::size_t> distOffset(0, spnData.size() - 12);
+		std::vector<std::vector<std::byte>> vecPatterns;
+		for (auto i { 0 }; i < 8; ++i) {
+			const auto spnPatt = spnData.subspan(distOffset(GetMT19937()), distSize(GetMT19937()));
+			vecPatterns.emplace_back(spnPatt.begin(), spnPatt.end());
+			vecPatterns.emplace_back(spnPatt.begin(), spnPatt.begin() + (spnPatt.size() + 1) / 2);
+			vecPatterns.emplace_back(spnPatt.begin() + spnPatt.size() / 2, spnPatt.end());
+		}
+		vecPatterns.emplace_back(16, std::byte { 0xFF });
+		vecPatterns.push_back(vecPatterns.front()); //The same pattern twice is found twice.
+
+		return vecPatterns;
+	}
+
+	//All the occurrences, sorted by offsets, then by patterns.
+	[[nodiscard]] inline auto SearchMultiNaive(SpanCByte spnData, const HEXSEARCH& hss) -> VecSearchResult {
+		const auto fMatchCase = hss.eSearchType != EHexSearchType::TEXT_ASCII || hss.fMatchCase;
+		const auto lmbLower = [](std::byte byte) {
+			const auto ch = static_cast<char>(byte);
+			return (ch >= 'A' && ch <= 'Z') ? static_cast<std::byte>(ch + 32) : byte; };
+		const auto lmbEqual = [fMatchCase, lmbLower](std::byte byte1, std::byte byte2) {
+			return fMatchCase ? byte1 == byte2 : lmbLower(byte1) == lmbLower(byte2); };
+
+		auto hssNoLimit = hss;
+		hssNoLimit.dwLimit = 0;
+		return SearchNaiveOffsets(spnData, hssNoLimit, [&](ULONGLONG ullOffset, ULONGLONG ullRngEnd, VecSearchResult& vecRes) {
+			for (DWORD dwPatt { 0 }; dwPatt < hss.spnFindMulti.size(); ++dwPatt) {
+				const auto spnPatt = hss.spnFindMulti[dwPatt];
+				if (ullOffset + spnPatt.size() <= ullRngEnd + 1 && std::equal(spnPatt.begin(), spnPatt.end(),
+					spnData.begin() + static_cast<std::ptrdiff_t>(ullOffset), lmbEqual)) {
+					vecRes.emplace_back(ullOffset, dwPatt);
+				}
+			} });
+	}
+
+	inline void SearchMultiAndCompare(IHexCtrl* pHex, SpanCByte spnData, std::wstring_view wsvName, const HEXSEARCH& hss) {
+		const auto wstrName = std::format(L"{} {}", wsvName, GetSearchName(hss));
+		auto vecRes = SearchHexCtrl(pHex, hss, wstrName);
+
+		//Occurrences come in the order of their ends, the order in which the data is read.
+		ULONGLONG ullEndPrev { };
+		for (const auto& [ullOffset, dwPatt] : vecRes) {
+			Assert::IsTrue(dwPatt < hss.spnFindMulti.size(), wstrName.data());
+			const auto ullEnd = ullOffset + hss.spnFindMulti[dwPatt].size();
+			Assert::IsTrue(ullEnd >= ullEndPrev, wstrName.data());
+			ullEndPrev = ullEnd;
+		}
+		std::sort(vecRes.begin(), vecRes.end());
+
+		const auto vecResNaive = SearchMultiNaive(spnData, hss);
+		if (hss.dwLimit == 0 || vecResNaive.size() <= hss.dwLimit) {
+			Assert::IsTrue(vecRes == vecResNaive, wstrName.data());
+		}
+		else { //Only the limit of the found occurrences, and every one of them is the real one.
+			Assert::AreEqual(static_cast<std::size_t>(hss.dwLimit), vecRes.size(), wstrName.data());
+			Assert::IsTrue(std::includes(vecResNaive.begin(), vecResNaive.end(), vecRes.begin(), vecRes.end()),
+				wstrName.data());
+		}
+	}
+
+	inline void SearchMultiAll(std::vector<std::byte>& vecData, std::wstring_view wsvName, const HEXSEARCH& hss) {
+		CTestVirtData stVirtData(vecData);
+		for (const auto pVirtData : { static_cast<CTestVirtData*>(nullptr), &stVirtData }) {
+			const auto pHex = GetSearchHexCtrl(vecData, pVirtData);
+			for (const auto& hssCase : GetSearchCases(hss, vecData.size(), { 1, 3 })) {
+				SearchMultiAndCompare(pHex, vecData, wsvName, hssCase);
+			}
+		}
+	}
+
+	TEST_CLASS(CSearchMulti) {
+public:
+	TEST_METHOD(HexBytes) {
+		auto vecData = CreateSearchData(300 * 1024 + 477, { "\x00\x01\x41\xFF", 4 });
+		const auto vecPatterns = CreateMultiPatterns(vecData);
+		const std::vector<SpanCByte> vecSpans(vecPatterns.begin(), vecPatterns.end());
+		SearchMultiAll(vecData, L"HEXBYTES", { .spnFindMulti { vecSpans }, .dwLimit { 0 },
+			.eSearchMode { EHexSearchMode::SEARCH_ALL } });
+	}
+	TEST_METHOD(TextNoMatchCase) {
+		auto vecData = CreateSearchData(300 * 1024 + 477, "aAbB0");
+		auto vecPatterns = CreateMultiPatterns(vecData);
+		std::bernoulli_distribution distFlip;
+		for (auto& vecPatt : vecPatterns) { //Patterns in the different case from the data.
+			for (auto& byte : vecPatt) {
+				if (const auto ch = static_cast<char>(byte); distFlip(GetMT19937()) && ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'))) {
+					byte = static_cast<std::byte>(ch ^ 0x20);
+				}
+			}
+		}
+
+		const std::vector<SpanCByte> vecSpans(vecPatterns.begin(), vecPatterns.end());
+		for (const auto fMatchCase : { true, false }) {
+			SearchMultiAll(vecData, fMatchCase ? L"TEXT_ASCII match case" : L"TEXT_ASCII no match case",
+				{ .spnFindMulti { vecSpans }, .dwLimit { 0 }, .eSearchMode { EHexSearchMode::SEARCH_ALL },
+				.eSearchType { EHexSearchType::TEXT_ASCII }, .fMatchCase { fMatchCase } });
+		}
+	}
+	TEST_METHOD(Limit) {
+		auto vecData = CreateSearchData(300 * 1024 + 477, { "\x00\x01\x41\xFF", 4 });
+		const auto vecPatterns = CreateMultiPatterns(vecData);
+		const std::vector<SpanCByte> vecSpans(vecPatterns.begin(), vecPatterns.end());
+		const auto pHex = GetSearchHexCtrl(vecData);
+		for (const auto dwLimit : { 1UL, 1023UL, 1024UL, 1025UL, 10000UL }) {
+			SearchMultiAndCompare(pHex, vecData, L"HEXBYTES", { .spnFindMulti { vecSpans }, .dwLimit { dwLimit },
+				.eSearchMode { EHexSearchMode::SEARCH_ALL } });
+		}
+	}
+	};
+}
\ No newline at end of file
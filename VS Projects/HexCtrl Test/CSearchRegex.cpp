@@ -0,0 +1,135 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//Regex search is checked against the hand-written naive matchers of the same regexes, for the longest match
+//up to the 256 bytes, on the step, where the matches don't overlap. The data has the runs longer than that,
+//and the matches across the cache chunks in the Virtual mode.
+namespace TestHexCtrl {
+	using PtrRegexNaive = std::size_t(*)(const std::byte* pData, std::size_t uzSize); //Longest match size, 0 if none.
+
+	struct REGEXNAIVE {
+		std::string_view svRegex;
+		PtrRegexNaive    pFuncNaive;
+	};
+
+	[[nodiscard]] consteval auto GetRegexSizeMax() {
+		return 256U; //Maximum match size.
+	}
+
+	//Size of the run of the bytes, from the pData, that fit the lmbIs.
+	template<typename TFunc>
+	[[nodiscard]] auto RegexNaiveRun(const std::byte* pData, std::size_t uzSize, TFunc lmbIs) -> std::size_t {
+		std::size_t uzRun { 0 };
+		while (uzRun < uzSize && lmbIs(std::to_integer<unsigned char>(pData[uzRun]))) {
+			++uzRun;
+		}
+		return uzRun;
+	}
+
+	[[nodiscard]] constexpr bool RegexNaiveIsDigit(unsigned char uch) {
+		return uch >= '0' && uch <= '9';
+	}
+
+	[[nodiscard]] constexpr bool RegexNaiveIsWord(unsigned char uch) {
+		return RegexNaiveIsDigit(uch) || (uch >= 'A' && uch <= 'Z') || (uch >= 'a' && uch <= 'z') || uch == '_';
+	}
+
+	[[nodiscard]] inline auto GetRegexNaives() -> std::span<const REGEXNAIVE> {
+		static constexpr REGEXNAIVE arrNaives[] {
+			{ R"([\x00-\x1F]{4,})", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				const auto uzRun = RegexNaiveRun(pData, uzSize, [](unsigned char uch) { return uch <= 0x1F; });
+				return uzRun >= 4 ? uzRun : 0; } },
+			{ R"(AB(CD|C)?)", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				const auto lmbIs = [=](std::size_t uzIdx, char ch) { return uzIdx < uzSize && pData[uzIdx] == static_cast<std::byte>(ch); };
+				if (!lmbIs(0, 'A') || !lmbIs(1, 'B'))
+					return 0;
+				return lmbIs(2, 'C') ? (lmbIs(3, 'D') ? 4 : 3) : 2; } },
+			{ R"(\d+\.\d{2})", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				const auto uzRun = RegexNaiveRun(pData, uzSize, RegexNaiveIsDigit);
+				if (uzRun == 0 || uzRun + 3 > uzSize || pData[uzRun] != std::byte { '.' }
+					|| !RegexNaiveIsDigit(std::to_integer<unsigned char>(pData[uzRun + 1]))
+					|| !RegexNaiveIsDigit(std::to_integer<unsigned char>(pData[uzRun + 2])))
+					return 0;
+				return uzRun + 3; } },
+			{ R"(\w+@\w+)", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				const auto uzRun = RegexNaiveRun(pData, uzSize, RegexNaiveIsWord);
+				if (uzRun == 0 || uzRun + 2 > uzSize || pData[uzRun] != std::byte { '@' })
+					return 0;
+				const auto uzRun2 = RegexNaiveRun(pData + uzRun + 1, uzSize - uzRun - 1, RegexNaiveIsWord);
+				return uzRun2 > 0 ? uzRun + 1 + uzRun2 : 0; } },
+			{ R"(\xCA.{3}\xFE|A{2,5})", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				if (pData[0] == std::byte { 0xCA })
+					return uzSize >= 5 && pData[4] == std::byte { 0xFE } ? 5 : 0;
+				const auto uzRun = RegexNaiveRun(pData, (std::min)(uzSize, std::size_t { 5 }),
+					[](unsigned char uch) { return uch == 'A'; });
+				return uzRun >= 2 ? uzRun : 0; } },
+			{ R"([^\x00-\x7F]+)", [](const std::byte* pData, std::size_t uzSize)->std::size_t {
+				return RegexNaiveRun(pData, uzSize, [](unsigned char uch) { return uch >= 0x80; }); } } };
+		return arrNaives;
+	}
+
+	[[nodiscard]] inline auto CreateRegexData() -> std::vector<std::byte> {
+		auto vecData = CreateSearchData(300 * 1024 + 477, { "\x00\x01\x1F\x20" "ABCD19.@_x\xCA\xFE\xFF\x80", 18 });
+		std::uniform_int_distribution<std::size_t> distOffset(0, vecData.size() - 16);
+		for (auto i { 0 }; i < 200; ++i) {
+			for (const auto sv : { "12.34", "123456.78", "foo@bar", "ABCD", "\xCA\x01\x02\x03\xFE", "AAAAAAA" }) {
+				PlantSearchData(vecData, distOffset(GetMT19937()), GetSearchSpan(sv));
+			}
+		}
+
+		//Runs longer than the maximum match size, across the cache chunks' edges.
+		std::fill_n(vecData.begin() + 64 * 1024 - 500, 1000, std::byte { 0 });
+		std::fill_n(vecData.begin() + 128 * 1024 - 300, 600, std::byte { 0xFF });
+		std::fill_n(vecData.begin() + 192 * 1024 - 150, 300, std::byte { '1' });
+		PlantSearchData(vecData, 192 * 1024 + 150, GetSearchSpan(".23"));
+		std::fill_n(vecData.begin() + 256 * 1024 - 300, 300, std::byte { 'w' });
+		PlantSearchData(vecData, 256 * 1024, GetSearchSpan("@"));
+		std::fill_n(vecData.begin() + 256 * 1024 + 1, 300, std::byte { 'w' });
+		std::fill(vecData.end() - 300, vecData.end(), std::byte { 0x1F }); //Up to the data end.
+
+		return vecData;
+	}
+
+	[[nodiscard]] inline auto SearchRegexNaive(SpanCByte spnData, const HEXSEARCH& hss, PtrRegexNaive pFuncNaive) -> VecSearchResult {
+		ULONGLONG ullMatchEnd { 0 }; //Offsets within the last match are not searched.
+		return SearchNaiveOffsets(spnData, hss, [=, &ullMatchEnd](ULONGLONG ullOffset, ULONGLONG ullRngEnd, VecSearchResult& vecRes) {
+			if (ullOffset < ullMatchEnd)
+				return;
+
+			const auto uzSize = static_cast<std::size_t>((std::min)(ullRngEnd - ullOffset + 1, ULONGLONG { GetRegexSizeMax() }));
+			if (const auto uzSizeMatch = pFuncNaive(spnData.data() + ullOffset, uzSize); uzSizeMatch > 0) {
+				vecRes.emplace_back(ullOffset, static_cast<DWORD>(uzSizeMatch));
+				ullMatchEnd = ullOffset + uzSizeMatch;
+			} });
+	}
+
+	inline void SearchRegexAll(IHexCtrl* pHex, std::vector<std::byte>& vecData) {
+		const auto ullSize = static_cast<ULONGLONG>(vecData.size());
+		for (const auto& stNaive : GetRegexNaives()) {
+			const HEXSEARCH hss { .spnFind { GetSearchSpan(stNaive.svRegex) }, .dwLimit { 0 },
+				.eSearchMode { EHexSearchMode::SEARCH_ALL }, .fRegex { true } };
+			for (const auto& hssCase : GetSearchCases(hss, ullSize, { 1, 3 }, { 0, 64 * 1024 - 10, 128 * 1024, ullSize - 100 })) {
+				SearchAndCompareNaive(pHex, hssCase, SearchRegexNaive(vecData, hssCase, stNaive.pFuncNaive),
+					std::wstring(stNaive.svRegex.begin(), stNaive.svRegex.end()));
+			}
+		}
+	}
+
+	TEST_CLASS(CSearchRegex) {
+public:
+	TEST_METHOD(Default) {
+		auto vecData = CreateRegexData();
+		SearchRegexAll(GetSearchHexCtrl(vecData), vecData);
+	}
+	TEST_METHOD(Virtual) {
+		auto vecData = CreateRegexData();
+		CTestVirtData stVirtData(vecData);
+		SearchRegexAll(GetSearchHexCtrl(vecData, &stVirtData), vecData);
+	}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include "../../HexCtrl/src/res/HexCtrlRes.h"
+#include <CommCtrl.h>
+#include <cwchar>
+#include <format>
+#include <string>
+#include <vector>
+
+//Search dialog's list of the found occurrences is checked against the naive search. The occurrences are apart
+//by the deltas of all LEB128 encoded sizes, and the Find Next ones, that are inserted in between the Find All ones,
+//split the list's blocks. Every list item is decoded on its own, through the list's LVN_GETDISPINFO.
+namespace TestHexCtrl {
+	constexpr std::byte arrResultsFind[] { std::byte { 0xDE }, std::byte { 0xAD }, std::byte { 0xBE }, std::byte { 0xEF } };
+	constexpr auto pwszResultsFind { L"DEADBEEF" };
+
+	[[nodiscard]] inline auto CreateResultsData() -> std::vector<std::byte> {
+		std::vector<std::byte> vecData(4 * 1024 * 1024 + 477);
+
+		//Occurrences at the even and odd offsets, one and two bytes deltas, then three and four bytes ones.
+		std::uniform_int_distribution<std::size_t> distDelta(sizeof(arrResultsFind), 300);
+		std::size_t uzOffset { 1 };
+		for (auto i { 0 }; i < 1000; ++i, uzOffset += distDelta(GetMT19937())) {
+			PlantSearchData(vecData, uzOffset, arrResultsFind);
+		}
+		for (const auto uzDelta : { 20'000U, 300'000U, 2'500'000U }) {
+			uzOffset += uzDelta;
+			PlantSearchData(vecData, uzOffset, arrResultsFind);
+		}
+		PlantSearchData(vecData, vecData.size() - sizeof(arrResultsFind), arrResultsFind); //The last offset.
+
+		return vecData;
+	}
+
+	[[nodiscard]] inline auto SearchResultsNaive(SpanCByte spnData, ULONGLONG ullStep) -> std::vector<ULONGLONG> {
+		std::vector<ULONGLONG> vecOffsets;
+		for (const auto& pairRes : SearchExactNaive(spnData, { .spnFind { arrResultsFind }, .ullStep { ullStep },
+			.dwLimit { 0 }, .eSearchMode { EHexSearchMode::SEARCH_ALL } })) {
+			vecOffsets.emplace_back(pairRes.first);
+		}
+
+		return vecOffsets;
+	}
+
+	inline void ResultsDlgClick(HWND hWndDlg, int iIDCtrl) {
+		::SendMessageW(hWndDlg, WM_COMMAND, MAKEWPARAM(iIDCtrl, BN_CLICKED),
+			reinterpret_cast<LPARAM>(::GetDlgItem(hWndDlg, iIDCtrl)));
+	}
+
+	[[nodiscard]] inline auto ResultsDlgGetText(HWND hWnd) -> std::wstring {
+		wchar_t buff[64] { };
+		::GetWindowTextW(hWnd, buff, static_cast<int>(std::size(buff)));
+		return buff;
+	}
+
+	//All the list's offsets, as they are shown.
+	[[nodiscard]] inline auto ResultsDlgGetList(HWND hWndDlg) -> std::vector<ULONGLONG> {
+		const auto hWndList = ::GetDlgItem(hWndDlg, IDC_HEXCTRL_SEARCH_LIST);
+		const auto iCount = static_cast<int>(::SendMessageW(hWndList, LVM_GETITEMCOUNT, 0, 0));
+		std::vector<ULONGLONG> vecOffsets;
+		for (auto iItem { 0 }; iItem < iCount; ++iItem) {
+			wchar_t buff[64] { };
+			LVITEMW lvi { .iSubItem { 1 }, .pszText { buff }, .cchTextMax { static_cast<int>(std::size(buff)) } };
+			::SendMessageW(hWndList, LVM_GETITEMTEXTW, static_cast<WPARAM>(iItem), reinterpret_cast<LPARAM>(&lvi));
+			vecOffsets.emplace_back(std::wcstoull(buff, nullptr, 16)); //"0x" prefix is accepted.
+		}
+
+		return vecOffsets;
+	}
+
+	//Search dialog of the new HexCtrl with the data, in the "Hex Bytes" mode.
+	[[nodiscard]] inline auto CreateResultsDlg(IHexCtrl* pHex, std::vector<std::byte>& vecData) -> HWND {
+		pHex->SetData({ .spnData { vecData.data(), vecData.size() } });
+		const auto hWndDlg = pHex->GetWndHandle(EHexWnd::DLG_SEARCH);
+		Assert::IsNotNull(hWndDlg);
+		::SetWindowTextW(pHex->GetDlgItemHandle(EHexDlgItem::SEARCH_COMBO_FIND), pwszResultsFind);
+		::SetWindowTextW(pHex->GetDlgItemHandle(EHexDlgItem::SEARCH_EDIT_LIMIT), L"10000");
+		return hWndDlg;
+	}
+
+	TEST_CLASS(CSearchResults) {
+public:
+	TEST_METHOD(FindAll) {
+		auto vecData = CreateResultsData();
+		const auto pHex = CreateTestHexCtrl();
+		const auto hWndDlg = CreateResultsDlg(pHex.get(), vecData);
+		for (const auto ullStep : { 1ULL, 2ULL, 3ULL }) {
+			::SetWindowTextW(pHex->GetDlgItemHandle(EHexDlgItem::SEARCH_EDIT_STEP), std::format(L"{}", ullStep).data());
+			ResultsDlgClick(hWndDlg, IDC_HEXCTRL_SEARCH_BTN_FINDALL);
+			Assert::IsTrue(ResultsDlgGetList(hWndDlg) == SearchResultsNaive(vecData, ullStep),
+				std::format(L"step {}", ullStep).data());
+		}
+	}
+	TEST_METHOD(FindNextInsert) {
+		auto vecData = CreateResultsData();
+		const auto pHex = CreateTestHexCtrl();
+		const auto hWndDlg = CreateResultsDlg(pHex.get(), vecData);
+		const auto hWndStart = pHex->GetDlgItemHandle(EHexDlgItem::SEARCH_EDIT_START);
+		const auto hWndStep = pHex->GetDlgItemHandle(EHexDlgItem::SEARCH_EDIT_STEP);
+
+		//Find All of the even offsets only.
+		::SetWindowTextW(hWndStep, L"2");
+		ResultsDlgClick(hWndDlg, IDC_HEXCTRL_SEARCH_BTN_FINDALL);
+		Assert::IsTrue(ResultsDlgGetList(hWndDlg) == SearchResultsNaive(vecData, 2));
+
+		//Find Next over all offsets, the odd ones are inserted in between the even ones, the even ones are found in the list.
+		const auto vecResNaive = SearchResultsNaive(vecData, 1);
+		::SetWindowTextW(hWndStep, L"1");
+		::SetWindowTextW(hWndStart, L"0");
+		for (const auto ullOffset : vecResNaive) {
+			ResultsDlgClick(hWndDlg, IDC_HEXCTRL_SEARCH_BTN_SEARCHF);
+			Assert::AreEqual(std::format(L"0x{:X}", ullOffset).data(), ResultsDlgGetText(hWndStart).data());
+		}
+		Assert::IsTrue(ResultsDlgGetList(hWndDlg) == vecResNaive);
+	}
+	};
+}
\ No newline at end of file
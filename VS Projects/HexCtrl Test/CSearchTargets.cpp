@@ -0,0 +1,75 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <format>
+#include <vector>
+
+//Search in a few data sets at once, default and Virtual, is checked against the naive search in every data set,
+//and against every data set's own Search.
+namespace TestHexCtrl {
+	TEST_CLASS(CSearchTargets) {
+public:
+	TEST_METHOD(SearchTargets) {
+		constexpr std::byte arrFind[] { std::byte { 'H' }, std::byte { 'e' }, std::byte { 'x' }, std::byte { 'C' },
+			std::byte { 't' }, std::byte { 'r' }, std::byte { 'l' } };
+		constexpr std::size_t arrSizes[] { GetTestDataSize(), 64UL * 1024UL + 1UL, 1024UL * 1024UL + 477UL,
+			3UL * 1024UL * 1024UL + 3UL, 300UL * 1024UL + 477UL };
+		constexpr std::size_t uzVirtIdx { 4 }; //The last data set is in the Virtual mode.
+
+		std::vector<std::vector<std::byte>> vecData;
+		for (const auto uzSize : arrSizes) {
+			auto& refData = vecData.emplace_back(CreateSearchData(uzSize));
+			std::uniform_int_distribution<std::size_t> distOffset(0, uzSize - sizeof(arrFind));
+			for (auto i { 0 }; i < 200; ++i) {
+				PlantSearchData(refData, distOffset(GetMT19937()), arrFind);
+			}
+			PlantSearchData(refData, 0, arrFind);
+			PlantSearchData(refData, uzSize - sizeof(arrFind), arrFind);
+		}
+
+		CTestVirtData stVirtData(vecData[uzVirtIdx]);
+		std::vector<IHexCtrlPtr> vecHex;
+		for (std::size_t i { 0 }; i < vecData.size(); ++i) {
+			vecHex.emplace_back(CreateTestHexCtrl());
+			if (i == uzVirtIdx) {
+				vecHex[i]->SetData({ .spnData { vecData[i].data(), vecData[i].size() }, .pHexVirtData { &stVirtData },
+					.dwCacheSize { 64UL * 1024UL } });
+			}
+			else {
+				vecHex[i]->SetData({ .spnData { vecData[i].data(), vecData[i].size() } });
+			}
+		}
+
+		for (const auto ullStep : { 1ULL, 3ULL }) {
+			for (const auto dwThreads : { 0UL, 1UL, 2UL }) {
+				const HEXSEARCH hss { .spnFind { arrFind }, .ullStep { ullStep }, .dwLimit { 0 }, .dwThreads { dwThreads },
+					.eSearchMode { EHexSearchMode::SEARCH_ALL } };
+				std::vector<CTestSearchResult> vecRes(vecHex.size());
+				std::vector<HEXSEARCHTARGET> vecTargets;
+				for (std::size_t i { 0 }; i < vecHex.size(); ++i) {
+					vecTargets.emplace_back(HEXSEARCHTARGET { .pHexCtrl { vecHex[i].get() }, .pHexSearchRes { &vecRes[i] } });
+				}
+
+				const auto ullFound = SearchTargets(vecTargets, hss);
+				ULONGLONG ullFoundSum { 0 };
+				for (std::size_t i { 0 }; i < vecHex.size(); ++i) {
+					const auto wstrName = std::format(L"data set {}, threads {}, {}", i, dwThreads, GetSearchName(hss));
+					VecSearchResult vecResTarget;
+					for (const auto ullOffset : vecRes[i].GetOffsets()) {
+						vecResTarget.emplace_back(ullOffset, 0);
+					}
+					std::sort(vecResTarget.begin(), vecResTarget.end());
+
+					const auto vecResNaive = SearchExactNaive(vecData[i], hss);
+					Assert::AreEqual(static_cast<ULONGLONG>(vecResNaive.size()), vecTargets[i].ullFound, wstrName.data());
+					Assert::IsTrue(vecResTarget == vecResNaive, wstrName.data());
+					Assert::IsTrue(SearchHexCtrl(vecHex[i].get(), hss, wstrName) == vecResNaive, wstrName.data());
+					ullFoundSum += vecTargets[i].ullFound;
+				}
+				Assert::AreEqual(ullFoundSum, ullFound);
+			}
+		}
+	}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "CHexCtrlInit.h"
+#include "CSearchInit.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+//Find All with the suffix array is checked against the naive search, in the read-only data of the random bytes,
+//long runs of the same byte, and periodic sequences, that are the hardest ones for the suffix array's construction.
+namespace TestHexCtrl {
+	[[nodiscard]] inline auto CreateSAData() -> std::vector<std::byte> {
+		auto vecData = CreateSearchData(1024 * 1024 + 477);
+		std::fill_n(vecData.begin() + 100'000, 70'000, std::byte { 0 });
+		for (std::size_t i { 300'000 }; i < 400'000; ++i) {
+			vecData[i] = static_cast<std::byte>("HexCtrl"[i % 7]);
+		}
+		for (std::size_t i { 600'000 }; i < 650'000; ++i) {
+			vecData[i] = static_cast<std::byte>(i % 2);
+		}
+		std::fill(vecData.end() - 300, vecData.end(), std::byte { 0 }); //The same byte up to the data end.
+
+		return vecData;
+	}
+
+	//Search data from the random, from the repeated, and from the very end of the data, and the data that isn't there.
+	inline void SearchSAAll(IHexCtrl* pHex, SpanCByte spnData) {
+		std::vector<std::vector<std::byte>> vecFinds;
+		std::uniform_int_distribution<std::size_t> distOffset(0, spnData.size() - 256);
+		for (const auto uzOffset : { distOffset(GetMT19937()), std::size_t { 100'000 }, std::size_t { 300'003 },
+			std::size_t { 600'001 } }) {
+			for (const auto uzSize : { 1U, 2U, 3U, 8U, 64U, 256U }) {
+				vecFinds.emplace_back(spnData.begin() + uzOffset, spnData.begin() + uzOffset + uzSize);
+			}
+		}
+		for (const auto uzSize : { 1U, 7U, 300U }) {
+			vecFinds.emplace_back(spnData.end() - uzSize, spnData.end());
+		}
+		vecFinds.emplace_back(spnData.end() - 301, spnData.end()); //One byte before the last zeros.
+		vecFinds.emplace_back(256, std::byte { 0 }); //Only in the middle zeros.
+		vecFinds.push_back({ std::byte { 'H' }, std::byte { 'e' }, std::byte { 'X' } });
+
+		for (const auto& vecFind : vecFinds) {
+			const HEXSEARCH hss { .spnFind { vecFind }, .dwLimit { 0 }, .eSearchMode { EHexSearchMode::SEARCH_ALL } };
+			auto vecCases = GetSearchCases(hss, spnData.size(), { 1, 3 });
+			for (const auto ullStep : { 1ULL, 3ULL }) {
+				vecCases.push_back({ .spnFind { vecFind }, .ullStartFrom { 100'001 }, .ullStep { ullStep }, .dwLimit { 100 },
+					.eSearchMode { EHexSearchMode::SEARCH_ALL } });
+			}
+
+			for (const auto& hssCase : vecCases) {
+				SearchAndCompareNaive(pHex, hssCase, SearchExactNaive(spnData, hssCase));
+			}
+		}
+	}
+
+	TEST_CLASS(CSuffixArray) {
+public:
+	TEST_METHOD(FindAll) {
+		auto vecData = CreateSAData();
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .fSuffixArray { true } });
+		SearchSAAll(pHex, vecData); //The suffix array is being built meanwhile.
+		std::this_thread::sleep_for(std::chrono::seconds(5));
+		SearchSAAll(pHex, vecData);
+	}
+	TEST_METHOD(SetDataWhileBuilding) {
+		auto vecData1 = CreateSAData();
+		auto vecData2 = CreateSAData();
+		GetHexCtrlWithData({ .spnData { vecData1.data(), vecData1.size() }, .fSuffixArray { true } });
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData2.data(), vecData2.size() }, .fSuffixArray { true } });
+		std::this_thread::sleep_for(std::chrono::seconds(5));
+		SearchSAAll(pHex, vecData2);
+	}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "CHexCtrlInit.h"
+#include "CppUnitTest.h"
+#include <cstring>
+#include <vector>
+
+//Undo/Redo journal in the default data mode, within the HEXDATA::ullUndoBudget, or in the temporary file.
+namespace TestHexCtrl {
+	//Undoes all the steps, returns how many of them there were.
+	inline auto UndoAll(IHexCtrl* pHex) -> ULONGLONG {
+		ULONGLONG ullSteps { };
+		for (; pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_UNDO); ++ullSteps) {
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_UNDO);
+		}
+		return ullSteps;
+	}
+
+	//Redoes all the steps, returns how many of them there were.
+	inline auto RedoAll(IHexCtrl* pHex) -> ULONGLONG {
+		ULONGLONG ullSteps { };
+		for (; pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_REDO); ++ullSteps) {
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_REDO);
+		}
+		return ullSteps;
+	}
+
+	TEST_CLASS(CUndo) {
+public:
+	TEST_METHOD(UndoRedo) {
+		CreateRandomTestData();
+		std::vector<std::byte> vecData(GetDataReference(), GetDataReference() + GetTestDataSize());
+		const auto vecOrig = vecData;
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .fMutable { true } });
+
+		//Self-inverse operation, fill with one byte, and random data: three different kinds of Undo steps.
+		constexpr std::uint8_t u8Key { 0x5A };
+		const std::byte arrFill[] { std::byte { 0xFF } };
+		pHex->ModifyData({ .eModifyMode { MODIFY_OPERATION }, .eOperMode { OPER_XOR }, .eDataType { DATA_UINT8 },
+			.spnData { reinterpret_cast<const std::byte*>(&u8Key), sizeof(u8Key) }, .vecSpan { { 0, 200 } } });
+		pHex->ModifyData({ .eModifyMode { MODIFY_REPEAT }, .spnData { arrFill }, .vecSpan { { 100, 300 } } });
+		pHex->ModifyData({ .eModifyMode { MODIFY_RAND_MT19937 }, .vecSpan { { 50, 100 }, { 350, 100 } } });
+		const auto vecEdited = vecData;
+
+		for (auto i { 0 }; i < 3; ++i) {
+			Assert::IsTrue(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_UNDO));
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_UNDO);
+		}
+		Assert::IsFalse(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_UNDO));
+		Assert::IsTrue(vecData == vecOrig);
+
+		for (auto i { 0 }; i < 3; ++i) {
+			Assert::IsTrue(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_REDO));
+			pHex->ExecuteCmd(EHexCmd::CMD_MODIFY_REDO);
+		}
+		Assert::IsFalse(pHex->IsCmdAvail(EHexCmd::CMD_MODIFY_REDO));
+		Assert::IsTrue(vecData == vecEdited);
+	}
+	TEST_METHOD(Budget) {
+		CreateRandomTestData();
+		std::vector<std::byte> vecData(GetDataReference(), GetDataReference() + GetTestDataSize());
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .ullUndoBudget { 1024 },
+			.fMutable { true } });
+
+		//Random data to be put back takes its whole size, the one byte fill takes just that byte, both fit.
+		const std::byte arrFill[] { std::byte { 0 } };
+		pHex->ModifyData({ .eModifyMode { MODIFY_REPEAT }, .spnData { arrFill }, .vecSpan { { 0, 400 } } });
+		pHex->ModifyData({ .eModifyMode { MODIFY_RAND_MT19937 }, .vecSpan { { 0, 400 } } });
+		Assert::AreEqual(2ULL, UndoAll(pHex));
+		Assert::IsTrue(vecData == std::vector(GetDataReference(), GetDataReference() + GetTestDataSize()));
+
+		//Steps of 300 random bytes, with the steps' own bookkeeping, only two of them fit into the budget.
+		std::vector<std::vector<std::byte>> vecStates { vecData };
+		for (auto i { 0 }; i < 4; ++i) {
+			pHex->ModifyData({ .eModifyMode { MODIFY_RAND_MT19937 }, .vecSpan { { 50, 300 } } });
+			vecStates.emplace_back(vecData);
+		}
+		Assert::AreEqual(2ULL, UndoAll(pHex));
+		Assert::IsTrue(vecData == vecStates[2]);
+		Assert::AreEqual(2ULL, RedoAll(pHex));
+		Assert::IsTrue(vecData == vecStates[4]);
+	}
+	TEST_METHOD(StepsMax) {
+		CreateRandomTestData();
+		std::vector<std::byte> vecData(GetDataReference(), GetDataReference() + GetTestDataSize());
+		const auto vecOrig = vecData;
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .ullUndoBudget { 64 * 1024 },
+			.fMutable { true } });
+
+		//Self-inverse operations are stored without the data, so it's the steps limit that drops the oldest ones,
+		//with the data stored it'd be the budget, at about a hundred steps.
+		constexpr auto iSteps { 600 };
+		constexpr auto iStepsMax { 512 };
+		std::uint8_t u8KeyKept { }; //All the keys XORed, of the steps that are dropped.
+		for (auto i { 0 }; i < iSteps; ++i) {
+			const auto u8Key = static_cast<std::uint8_t>(i * 7 + 1);
+			pHex->ModifyData({ .eModifyMode { MODIFY_OPERATION }, .eOperMode { OPER_XOR }, .eDataType { DATA_UINT8 },
+				.spnData { reinterpret_cast<const std::byte*>(&u8Key), sizeof(u8Key) }, .vecSpan { { 0, GetTestDataSize() } } });
+			u8KeyKept ^= i < iSteps - iStepsMax ? u8Key : 0;
+		}
+		const auto vecEdited = vecData;
+
+		Assert::AreEqual(static_cast<ULONGLONG>(iStepsMax), UndoAll(pHex));
+		for (std::size_t i { 0 }; i < vecData.size(); ++i) {
+			Assert::AreEqual(std::to_integer<int>(vecOrig[i] ^ std::byte { u8KeyKept }), std::to_integer<int>(vecData[i]));
+		}
+		Assert::AreEqual(static_cast<ULONGLONG>(iStepsMax), RedoAll(pHex));
+		Assert::IsTrue(vecData == vecEdited);
+	}
+	TEST_METHOD(File) {
+		CreateRandomTestData();
+		std::vector<std::byte> vecData(GetDataReference(), GetDataReference() + GetTestDataSize());
+		const auto vecBefore = vecData;
+		const auto pHex = GetHexCtrlWithData({ .spnData { vecData.data(), vecData.size() }, .ullUndoBudget { 300 },
+			.fMutable { true } });
+
+		//Data over the budget goes to the temporary file, and is swapped with the data there on every Undo/Redo.
+		pHex->ModifyData({ .eModifyMode { MODIFY_RAND_MT19937 }, .vecSpan { { 0, 400 } } });
+		const auto vecEdited = vecData;
+		for (auto i { 0 }; i < 3; ++i) {
+			Assert::AreEqual(1ULL, UndoAll(pHex));
+			Assert::IsTrue(vecData == vecBefore);
+			Assert::AreEqual(1ULL, RedoAll(pHex));
+			Assert::IsTrue(vecData == vecEdited);
+		}
+	}
+	};
+}
\ No newline at end of file